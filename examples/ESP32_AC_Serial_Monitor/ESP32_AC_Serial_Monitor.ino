@@ -293,6 +293,12 @@ void captureJob()
                 printData(dataPkt->data, (dataPkt->bitLen + 7) / 8);
                 Serial.println("AC control library initialization using received data  **SUCCESS** !!! ");
             }
+            else if (ac.checkCapture() != CAPTURE_OK)        // No protocol has such a signal
+            {
+                Serial.print("Received signal is not an A/C command (check result ");
+                Serial.print(ac.checkCapture());
+                Serial.println("), possibly interference or an incomplete capture. Please try again");
+            }
             else        // Initialization failed
             {
                 Serial.println("AC control library initialization using received data **FAILED**, "
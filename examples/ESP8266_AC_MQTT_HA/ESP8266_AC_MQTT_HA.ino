@@ -19,9 +19,13 @@
  *   power-up ─► load config from EEPROM
  *            ├─► found  ─► WORKING (parsing + MQTT control)
  *            └─► none   ─► PAIRING (wait for IR)
- *   WORKING + MQTT cmd arrives ─► stop parsing ─► send IR ─► back to WORKING
+ *   WORKING + MQTT cmd settled ─► stop parsing ─► send IR ─► back to WORKING
  *   WORKING + long-press FLASH ─► stop parsing ─► PAIRING
  *
+ * The Home Assistant side is handled by BC7215ACBridge: the state is published as one
+ * JSON message on HA_BASE/state, commands arriving together (e.g. mode and fan speed)
+ * are sent as one IR command.
+ *
  * --------------------------------------------------------------------------
  *  NOTE on BC7215 serial:
  *  ESP8266 has only one full hardware UART, which is normally reserved for
@@ -47,6 +51,7 @@
 #include <EEPROM.h>
 #include <bc7215.h>
 #include <bc7215ac.h>
+#include <bc7215acbridge.h>
 
 // ======= WiFi / MQTT / Home Assistant configuration =======
 //#define MY_WIFI_SSID     "******"                   // Replace with your WiFi SSID
@@ -83,71 +88,7 @@ const char*    MQTT_HOST         = MY_MQTT_IP_ADDR;
 const uint16_t MQTT_PORT         = 1883;
 const char*    MQTT_CLIENT_ID    = MY_UUID;
 const char*    MQTT_LWT          = HA_BASE "/available";
-const char*    TEMP_SET_TOPIC    = HA_BASE "/temperature/set";
-const char*    TEMP_STATE_TOPIC  = HA_BASE "/temperature/state";
-const char*    MODE_SET_TOPIC    = HA_BASE "/mode/set";
-const char*    MODE_STATE_TOPIC  = HA_BASE "/mode/state";
-const char*    FAN_SET_TOPIC     = HA_BASE "/fan/set";
-const char*    FAN_STATE_TOPIC   = HA_BASE "/fan/state";
-const char*    HA_MODES[]        = { "auto", "cool", "heat", "dry", "fan_only" };
-const char*    HA_FANSPEED[]     = { "auto", "low", "medium", "high" };
-const char*    HA_DISCOVERY_TOPIC = "homeassistant/climate/bc7215_ac/config";
-
-const char* HA_DISCOVERY_INFO_C = R"(
-{
-    "name": "Bedroom AC",
-    "unique_id": "bc7215_ac_01",
-    "~": "home/ac/bc7215",
-    "mode_command_topic": "~/mode/set",
-    "mode_state_topic": "~/mode/state",
-    "modes": ["off", "auto", "cool", "heat", "dry", "fan_only"],
-    "temperature_command_topic": "~/temperature/set",
-    "temperature_state_topic": "~/temperature/state",
-    "min_temp": 16,
-    "max_temp": 30,
-    "temp_step": 1,
-    "fan_mode_command_topic": "~/fan/set",
-    "fan_mode_state_topic": "~/fan/state",
-    "fan_modes": ["auto", "low", "medium", "high"],
-    "availability_topic": "~/available",
-    "payload_available": "online",
-    "payload_not_available": "offline",
-    "device":
-    {
-        "identifiers": ["bc7215_ac_01"],
-        "name": "BC7215_AC_CONTROLLER",
-        "manufacturer": "DIY",
-        "model": "ESP8266_BC7215_AC"
-    }
-})";
-const char*	HA_DISCOVERY_INFO_F = R"(
-{
-	"name": "Bedrood AC",
-	"unique_id": "bc7215_ac_01",
-	"~": "home/ac/bc7215",
-	"mode_command_topic": "~/mode/set",
-	"mode_state_topic": "~/mode/state",
-	"modes": ["off", "auto", "cool", "heat", "dry", "fan_only"],
-	"temperature_command_topic": "~/temperature/set",
-	"temperature_state_topic": "~/temperature/state",
-	"temperature_unit": "F",
-	"min_temp": 60,
-	"max_temp": 88,
-	"temp_step": 1,
-	"fan_mode_command_topic": "~/fan/set",
-	"fan_mode_state_topic": "~/fan/state",
-	"fan_modes": ["auto", "low", "medium", "high"],
-	"availability_topic": "~/available",
-	"payload_available": "online",
-	"payload_not_available": "offline",
-	"device": 
-	{
-		"identifiers": ["bc7215_ac_01"],
-		"name": "BC7215_AC_CONTROLLER",
-		"manufacturer": "DIY",
-		"model": "ESP32_BC7215_AC"
-	}
-})";
+const char*    HA_NAME           = "Bedroom AC";
 
 // ======= State machine =======
 enum L1_STATE
@@ -195,6 +136,17 @@ BC7215AC       ac(bc7215Board);
 WiFiClient     espWiFi;
 PubSubClient   mqtt(espWiFi);
 
+// Transport of the Home Assistant bridge over PubSubClient
+class MqttLink : public BC7215ACBridgeLink
+{
+public:
+    bool publish(const char* topic, const char* payload, bool retained) { return mqtt.publish(topic, payload, retained); }
+    bool subscribe(const char* topic) { return mqtt.subscribe(topic); }
+};
+
+MqttLink       mqttLink;
+BC7215ACBridge haBridge(ac, mqttLink, HA_BASE);
+
 // ======= Global state =======
 L1_STATE   mainState;
 L1_STATE   retState;          // state to return to after IR_SENDING
@@ -202,15 +154,8 @@ L2_STATE   l2State;
 NET_STATUS wifiState;
 NET_STATUS mqttState;
 
-// AC control variables
-int    temp      = 25;        // current temperature setpoint
-int    mode      = 1;         // 0=auto 1=cool 2=heat 3=dry 4=fan
-int    fan       = 1;         // 0=auto 1=low 2=med 3=high
-int    remoteBtn = 0;         // last button: 0=Temp- 1=Temp+ 2=Mode 3=Fan
+// AC control variables (the A/C state is kept by haBridge)
 int8_t matchCnt  = 0;
-bool   acPowerOn = true;
-bool   mqttCmd   = false;
-bool   irSending = false;
 
 // Timing
 unsigned long startTime        = 0;
@@ -246,7 +191,7 @@ void enterPairing();
 void enterWorking();
 bool loadInitInfo();
 void saveInitInfo();
-void acStatPublish();
+void sendBridgeCmd();
 void handleHeartbeat(unsigned long now);
 
 // =====================================================================
@@ -293,6 +238,10 @@ void loop()
     wifiConnect();
     mqttConnect();
     updateButton();
+    if (mqttState == CONNECTED)
+    {
+        haBridge.poll();        // publish the A/C state when it has changed
+    }
 
     delay(interval);
 }
@@ -365,9 +314,7 @@ void powerup()
                 }
             }
 
-            temp = ac.isCelsius() ? 25 : 78;
-            mode = 1;
-            fan  = 1;
+            haBridge.report(ac.isCelsius() ? 25 : 78, MODE_COOL, FAN_LOW, 1);
             Serial.println(F("[BOOT] Saved remote loaded, entering WORKING"));
             enterWorking();
         }
@@ -409,9 +356,7 @@ void doPairing()
             saveInitInfo();
 
             // Reset default setpoints after pairing
-            temp = ac.isCelsius() ? 25 : 78;
-            mode = 1;
-            fan  = 1;
+            haBridge.report(ac.isCelsius() ? 25 : 78, MODE_COOL, FAN_LOW, 1);
 
             // Flash LED "OFF" clearly so user sees the transition
             LED_OFF();
@@ -420,7 +365,6 @@ void doPairing()
             if (mqttState == CONNECTED)
             {
 				mqttOnlineAction();
-                acStatPublish();
             }
 
             enterWorking();
@@ -443,6 +387,13 @@ void doWorking()
 
     handleHeartbeat(now);
 
+    // Command from Home Assistant settled?
+    if (haBridge.commandDue())
+    {
+        sendBridgeCmd();
+        return;
+    }
+
     // IR signal received?
     if (ac.signalCaptured())
     {
@@ -454,48 +405,7 @@ void doWorking()
         {
             Serial.printf("[RX] T=%d M=%d F=%d P=%d\n", T, M, F, P);
 
-            // Temperature (accept only in-range values)
-            bool tempOK = (ac.isCelsius()  && (T >= 16) && (T <= 30)) ||
-                          (!ac.isCelsius() && (T >= 60) && (T <= 88));
-            if (tempOK && mqttState == CONNECTED)
-            {
-                mqtt.publish(TEMP_STATE_TOPIC, String(T).c_str());
-                temp = T;
-            }
-
-            // Mode
-            if (M >= 0 && M <= 4)
-            {
-                mode = M;
-                if (mqttState == CONNECTED)
-                {
-                    mqtt.publish(MODE_STATE_TOPIC, HA_MODES[M]);
-                }
-            }
-
-            // Fan speed
-            if (F >= 0 && F <= 3)
-            {
-                fan = F;
-                if (mqttState == CONNECTED)
-                {
-                    mqtt.publish(FAN_STATE_TOPIC, HA_FANSPEED[F]);
-                }
-            }
-
-            // Power (0=off, 1=on)
-            if (P == 0)
-            {
-                acPowerOn = false;
-                if (mqttState == CONNECTED)
-                {
-                    mqtt.publish(MODE_STATE_TOPIC, "off");
-                }
-            }
-            else if (P == 1)
-            {
-                acPowerOn = true;
-            }
+            haBridge.report(T, M, F, P);        // published by haBridge.poll(), values out of range are ignored
         }
         else
         {
@@ -535,9 +445,12 @@ void doIrSending()
     // While sending, LED stays on (set when we entered this state)
     if (!ac.isBusy() || (millis() - startTime > 3000))
     {
+        if (haBridge.send())        // settings following a power on frame
+        {
+            startTime = millis();
+            return;
+        }
         LED_OFF();
-        irSending = false;
-        mqttCmd   = false;
 
         mainState = retState;
 
@@ -718,49 +631,35 @@ void mqttConnect()
 // =====================================================================
 void mqttOnlineAction()
 {
-	bool result;
     Serial.println(F("[MQTT] Online"));
-	if (ac.isCelsius())
-	{
-		result = mqtt.publish(HA_DISCOVERY_TOPIC, HA_DISCOVERY_INFO_C, true);
-	}
-	else
-	{
-		result = mqtt.publish(HA_DISCOVERY_TOPIC, HA_DISCOVERY_INFO_F, true);
-	}
-	if (result)
+    if (haBridge.publishDiscovery(MY_UUID, HA_NAME))
     {
         Serial.println(F("[MQTT] HA discovery published"));
     }
-    mqtt.publish(MQTT_LWT, "online", true);
-
-    if (ac.initOK)
-    {
-        acStatPublish();
-    }
-
-    mqtt.subscribe(TEMP_SET_TOPIC);
-    mqtt.subscribe(MODE_SET_TOPIC);
-    mqtt.subscribe(FAN_SET_TOPIC);
+    haBridge.online();        // availability, command topics and state
 }
 
 // =====================================================================
-// Publish current temp/mode/fan to MQTT
+// Send the command merged by haBridge:
+//   stop parsing -> send IR -> IR_SENDING (LED on) -> back to WORKING
 // =====================================================================
-void acStatPublish()
+void sendBridgeCmd()
 {
-    if (mqttState != CONNECTED) return;
-    mqtt.publish(TEMP_STATE_TOPIC, String(temp).c_str());
-    mqtt.publish(MODE_STATE_TOPIC, HA_MODES[mode]);
-    mqtt.publish(FAN_STATE_TOPIC,  HA_FANSPEED[fan]);
-	Serial.println("[MQTT] AC state published");
+    ac.stopCapture();
+    LED_ON();                           // TX indicator (steady while sending)
+    haBridge.send();
+    Serial.printf("[MQTT] Sent temp=%d mode=%d fan=%d power=%d\n", haBridge.temp(), haBridge.mode(), haBridge.fan(),
+                  haBridge.power());
+
+    startTime = millis();
+    retState  = WORKING;
+    mainState = IR_SENDING;
 }
 
 // =====================================================================
 // MQTT incoming message callback
-// Any command while in WORKING state:
-//   stop parsing -> send IR -> IR_SENDING (LED on) -> back to WORKING
-// Commands are ignored while pairing / sending / not-connected.
+// Commands are taken while in WORKING state and sent once they have settled,
+// they are ignored while pairing / sending / not-connected.
 // =====================================================================
 void processMqtt(char* topic, byte* payload, unsigned int length)
 {
@@ -771,118 +670,7 @@ void processMqtt(char* topic, byte* payload, unsigned int length)
     if (mainState != WORKING) return;
     if (!ac.initOK)           return;
 
-    char val[length + 1];
-    memcpy(val, payload, length);
-    val[length] = '\0';
-    int value = atoi(val);
-
-    bool doSend = false;
-    bool specialPower = false;        // separate "on()" / "off()" vs. "setTo()"
-    bool powerOn = false;
-
-    if (strcmp(topic, TEMP_SET_TOPIC) == 0)
-    {
-        bool tempOK = (ac.isCelsius()  && (value >= 16) && (value <= 30)) ||
-                      (!ac.isCelsius() && (value >= 60) && (value <= 88));
-        if (tempOK)
-        {
-            temp      = value;
-            remoteBtn = (value > temp) ? 1 : 0;     // cosmetic; safe default
-            doSend    = true;
-            Serial.printf("[MQTT] Set temp=%d\n", temp);
-        }
-        else
-        {
-            Serial.println(F("[MQTT] Invalid temperature"));
-        }
-    }
-    else if (strcmp(topic, MODE_SET_TOPIC) == 0)
-    {
-        if (strcmp(val, "off") == 0)
-        {
-            specialPower = true;
-            powerOn      = false;
-            acPowerOn    = false;
-            if (mqttState == CONNECTED)
-            {
-                mqtt.publish(MODE_STATE_TOPIC, "off");
-            }
-            Serial.println(F("[MQTT] Power OFF"));
-        }
-        else
-        {
-            int i;
-            for (i = 0; i < 5; i++)
-            {
-                if (strcmp(val, HA_MODES[i]) == 0)
-                {
-                    mode = i;
-                    break;
-                }
-            }
-            if (i < 5)
-            {
-                if (!acPowerOn)
-                {
-                    specialPower = true;
-                    powerOn      = true;
-                    acPowerOn    = true;
-                    Serial.println(F("[MQTT] Power ON"));
-                }
-                else
-                {
-                    remoteBtn = 2;                  // MODE button
-                    doSend    = true;
-                    Serial.printf("[MQTT] Set mode=%s\n", HA_MODES[mode]);
-                }
-            }
-        }
-    }
-    else if (strcmp(topic, FAN_SET_TOPIC) == 0)
-    {
-        int i;
-        for (i = 0; i < 4; i++)
-        {
-            if (strcmp(val, HA_FANSPEED[i]) == 0)
-            {
-                fan = i;
-                break;
-            }
-        }
-        if (i < 4)
-        {
-            remoteBtn = 3;                          // FAN button
-            doSend    = true;
-            Serial.printf("[MQTT] Set fan=%s\n", HA_FANSPEED[fan]);
-        }
-        else
-        {
-            Serial.println(F("[MQTT] Invalid fan value"));
-        }
-    }
-
-    if (!doSend && !specialPower) return;
-
-    // Leave parsing mode, start transmit, switch to IR_SENDING
-    ac.stopCapture();
-    LED_ON();                           // TX indicator (steady while sending)
-
-    if (specialPower)
-    {
-        if (powerOn) ac.on();
-        else         ac.off();
-    }
-    else
-    {
-        ac.setTo(temp, mode, fan, remoteBtn);
-        acStatPublish();                // echo state back to HA
-    }
-
-    irSending = true;
-    mqttCmd   = true;
-    startTime = millis();
-    retState  = WORKING;
-    mainState = IR_SENDING;
+    haBridge.received(topic, payload, length);
 }
 
 // =====================================================================
@@ -0,0 +1,99 @@
+/*
+	BC7215 capture archive example
+
+	This example records every IR frame received by BC7215 (status, format
+	and data) into a binary capture archive on an SD card, instead of printing
+	hex dumps to the serial monitor. Send 'q' from the serial monitor to close
+	the archive before removing the card.
+	The archive can be read on a PC with extras/tools/archive_dump.c, or by
+	any tool using extras/tools/bc7215_archive_reader.c. The file format is
+	described in bc7215_archive.h.
+
+	The circuit:
+	  BC7215 connected as in the ir_decoder example (MOD tied to VCC, BUSY not
+	  connected), SD card module on the SPI bus with CS on pin SD_CS.
+
+	Created: October 2026
+	by Bitcode
+
+*/
+
+#include <SD.h>
+#include <bc7215.h>
+#include <bc7215archive.h>
+
+#define IR_SERIAL 		Serial1        // Define the serial port used for BC7215
+
+const int SD_CS = 4;		// chip select of the SD card
+
+// Offsets of the first INDEX_SIZE records are kept for the index written on close,
+// for longer recordings the reader rebuilds the index from the records
+#if defined(__AVR__)
+const uint32_t INDEX_SIZE = 32;
+#else
+const uint32_t INDEX_SIZE = 1024;
+#endif
+
+BC7215 irModule(IR_SERIAL, BC7215::MOD_HIGH, BC7215::BUSY_NC);        // define BC7215 connection
+
+File                archiveFile;
+uint32_t            recordIndex[INDEX_SIZE];
+BC7215ArchiveWriter archive(archiveFile, recordIndex, INDEX_SIZE);
+bool                recording = false;
+
+bc7215DataMaxPkt_t rcvdData;
+bc7215FormatPkt_t  rcvdFormat;
+
+void setup()
+{
+    Serial.begin(115200);
+    IR_SERIAL.begin(19200, SERIAL_8N2);		// initialized BC7215 serial port
+
+    if (!SD.begin(SD_CS))
+    {
+        Serial.println("SD card not found");
+        return;
+    }
+    SD.remove("/ir.bca");
+    archiveFile = SD.open("/ir.bca", FILE_WRITE);
+    if (archiveFile && archive.begin())
+    {
+        recording = true;
+        irModule.setRxMode(1);		// receive format packets as well
+        irModule.clrData();
+        irModule.clrFormat();
+        Serial.println("Recording, send 'q' to close the archive");
+    }
+}
+
+void loop()
+{
+    if (!recording)
+    {
+        return;
+    }
+    if (irModule.formatReady())        // format packet is sent after the data packet
+    {
+        uint8_t status;
+        irModule.getFormat(rcvdFormat);
+        status = irModule.getData(rcvdData);
+        if (!archive.add(status, rcvdData, &rcvdFormat, millis()))
+        {
+            Serial.println("write error");
+        }
+        Serial.print("frame ");
+        Serial.print(archive.count());
+        Serial.print(", ");
+        Serial.print(rcvdData.bitLen);
+        Serial.println(" bits");
+    }
+    if (Serial.read() == 'q')
+    {
+        archive.end();
+        archiveFile.close();
+        recording = false;
+        Serial.print("Archive closed, ");
+        Serial.print(archive.count());
+        Serial.println(" frames");
+    }
+}
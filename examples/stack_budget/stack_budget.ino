@@ -0,0 +1,204 @@
+/*
+ * stack_budget.ino
+ *
+ * Description: Reports the worst stack depth of every public A/C library function and the
+ * static RAM taken by the library objects, so the task calling the library can be sized
+ * from measured numbers.
+ * The stack below the caller is painted with a pattern before each call, and the number of
+ * bytes overwritten afterwards is the depth that call reached. Every built-in protocol is
+ * paired in both temperature units and all its matched protocols are walked, the largest
+ * depth seen for each function is reported.
+ * No BC7215 board is needed, the functions measured here do not transmit. BC7215AC methods
+ * use a few bytes more than the C function they call.
+ * For host side figures (per function frames, call graph and static RAM of the C library)
+ * see extras/tools/stack_usage.sh
+ * Hardware: any Arduino board with a serial monitor
+ * Dependencies: bc7215.h, bc7215ac.h
+ * Author: Bitcode
+ * Date: 2026-10-18
+ */
+
+#include <bc7215.h>
+#include <bc7215ac.h>
+
+// Bytes of stack painted below setup(), must be larger than the deepest call measured
+#if defined(__AVR__)
+const size_t PROBE_SIZE = 600;
+#else
+const size_t PROBE_SIZE = 2048;
+#endif
+const uint8_t PAINT = 0xa5;
+
+enum API_INDEX
+{
+    API_INIT,
+    API_INIT_F,
+    API_INIT2,
+    API_INIT2_F,
+    API_FIND_NEXT,
+    API_SET,
+    API_SET_F,
+    API_ON,
+    API_OFF,
+    API_PARSE,
+    API_PARSE_F,
+    API_REPLACE_BASE,
+    API_PREDEF_DATA,
+    API_NEED_EXTRA,
+    API_COUNT
+};
+
+const char* const API_NAMES[API_COUNT] = { "bc7215_ac_init", "bc7215_ac_init_f", "bc7215_ac_init2", "bc7215_ac_init2_f",
+    "bc7215_ac_find_next", "bc7215_ac_set", "bc7215_ac_set_f", "bc7215_ac_on", "bc7215_ac_off", "bc7215_ac_parse",
+    "bc7215_ac_parse_f", "bc7215_ac_replace_base", "bc7215_ac_predefined_data", "bc7215_ac_need_extra_sample" };
+
+size_t             maxDepth[API_COUNT];
+bc7215DataMaxPkt_t sampleData;
+bc7215FormatPkt_t  sampleFormat;
+bc7215CombinedMsg_t message;
+
+volatile uint8_t*  probeArea;        // painted area, left below the caller's stack pointer
+
+// Fill the stack area below the caller with the pattern
+void __attribute__((noinline)) paintStack()
+{
+    volatile uint8_t area[PROBE_SIZE];
+    for (size_t i = 0; i < PROBE_SIZE; i++)
+    {
+        area[i] = PAINT;
+    }
+    probeArea = area;
+}
+
+// Count the painted bytes which have been overwritten since paintStack()
+size_t __attribute__((noinline)) stackUsed()
+{
+    size_t i = 0;
+    while ((i < PROBE_SIZE) && (probeArea[i] == PAINT))        // stack grows downwards, probeArea[0] is the deepest byte
+    {
+        i++;
+    }
+    return PROBE_SIZE - i;
+}
+
+#define MEASURE(index, call)                 \
+    do                                       \
+    {                                        \
+        size_t used;                         \
+        paintStack();                        \
+        call;                                \
+        used = stackUsed();                  \
+        if (used > maxDepth[index])          \
+        {                                    \
+            maxDepth[index] = used;          \
+        }                                    \
+    } while (0)
+
+// Exercise every function on the protocol currently paired
+void measurePaired(bool fahrenheit)
+{
+    int8_t                    temp, mode, fan, power;
+    const bc7215DataVarPkt_t* result;
+
+    for (int8_t key = KEY_PLUS; key <= KEY_FAN; key++)
+    {
+        for (int8_t t = 0; t <= (fahrenheit ? 28 : 14); t += (fahrenheit ? 7 : 4))
+        {
+            if (fahrenheit)
+            {
+                MEASURE(API_SET_F, result = bc7215_ac_set_f(t, MODE_HOT, FAN_HIGH, key));
+            }
+            else
+            {
+                MEASURE(API_SET, result = bc7215_ac_set(t, MODE_HOT, FAN_HIGH, key));
+            }
+        }
+    }
+    MEASURE(API_ON, result = bc7215_ac_on());
+    MEASURE(API_OFF, result = bc7215_ac_off());
+    if (fahrenheit)
+    {
+        MEASURE(API_PARSE_F, bc7215_ac_parse_f(&temp, &mode, &fan, &power));
+    }
+    else
+    {
+        MEASURE(API_PARSE, bc7215_ac_parse(&temp, &mode, &fan, &power));
+    }
+    MEASURE(API_NEED_EXTRA, bc7215_ac_need_extra_sample());
+    MEASURE(API_REPLACE_BASE, bc7215_ac_replace_base(sampleFormat.signature.inByte, bc7215_ac_get_base_data()));
+    (void)result;
+}
+
+void measurePredef(uint8_t index, bool fahrenheit)
+{
+    const bc7215DataVarPkt_t* data;
+    bool                      found;
+
+    MEASURE(API_PREDEF_DATA, data = fahrenheit ? bc7215_ac_predefined_data_f(index) : bc7215_ac_predefined_data(index));
+    memcpy(&sampleData, data, (data->bitLen + 7) / 8 + 2);
+    memcpy(&sampleFormat, bc7215_ac_predefined_fmt(index), sizeof(sampleFormat));
+    message.bitLen = 0;
+    message.body.msg.datPkt = reinterpret_cast<const bc7215DataVarPkt_t*>(&sampleData);
+    message.body.msg.fmt = &sampleFormat;
+
+    if (fahrenheit)
+    {
+        MEASURE(API_INIT2_F, bc7215_ac_init2_f(1, &message, 0));
+        MEASURE(API_INIT_F, found = bc7215_ac_init_f(sampleFormat.signature.inByte, reinterpret_cast<const bc7215DataVarPkt_t*>(&message)));
+    }
+    else
+    {
+        MEASURE(API_INIT2, bc7215_ac_init2(1, &message, 0));
+        MEASURE(API_INIT, found = bc7215_ac_init(sampleFormat.signature.inByte, reinterpret_cast<const bc7215DataVarPkt_t*>(&message)));
+    }
+    while (found)
+    {
+        measurePaired(fahrenheit);
+        MEASURE(API_FIND_NEXT, found = bc7215_ac_find_next());
+    }
+}
+
+void setup()
+{
+    Serial.begin(115200);
+    while (!Serial)
+    {
+    }
+    Serial.println(F("BC7215 A/C library stack & RAM budget"));
+    Serial.print(F("A/C library "));
+    Serial.println(bc7215_ac_get_ver());
+
+    for (uint8_t i = 0; i < bc7215_ac_predefined_cnt(); i++)
+    {
+        measurePredef(i, false);
+        measurePredef(i, true);
+    }
+
+    Serial.println();
+    Serial.println(F("Function                        max stack (bytes)"));
+    for (uint8_t i = 0; i < API_COUNT; i++)
+    {
+        Serial.print(API_NAMES[i]);
+        for (size_t n = strlen(API_NAMES[i]); n < 32; n++)
+        {
+            Serial.print(' ');
+        }
+        Serial.println(maxDepth[i]);
+    }
+    Serial.print(F("(stack probe size "));
+    Serial.print(PROBE_SIZE);
+    Serial.println(F(" bytes, a value equal to it means the probe is too small)"));
+
+    Serial.println();
+    Serial.println(F("Object                          static RAM (bytes)"));
+    Serial.print(F("BC7215                          "));
+    Serial.println(sizeof(BC7215));
+    Serial.print(F("BC7215AC                        "));
+    Serial.println(sizeof(BC7215AC));
+    Serial.print(F("BC7215_MAX_RX_DATA_SIZE         "));
+    Serial.println(BC7215_MAX_RX_DATA_SIZE);
+}
+
+void loop()
+{
+}
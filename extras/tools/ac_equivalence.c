@@ -0,0 +1,412 @@
+/*
+ * ac_equivalence.c
+ *
+ * Description: Dumps everything the A/C control library emits, one line per section with a
+ * hash of the bytes, so two builds of bc7215_ac_lib.c can be compared with diff.
+ * Used by ac_equivalence.sh, which builds it once against a frozen reference of the library
+ * and once against the working tree.
+ *
+ * For every predefined entry (Celsius and Fahrenheit data) and for a base synthesized from
+ * every protocol descriptor, the library is initialized and all matched protocols are walked
+ * with bc7215_ac_find_next(). For each match the whole set/set_f grid (temperature, mode, fan
+ * and key, including -1 "keep"), on(), off(), parse() and need_extra_sample() are dumped.
+ * Key-toggle protocols are dumped again with their 2nd base saved, with the same and with the
+ * opposite REV bit as the base. Every frame is also received inverted (REV status), and the base
+ * of every multi-segment descriptor is split into its segments and passed to bc7215_ac_init2().
+ * bc7215_ac_check_capture() and bc7215_ac_segs_complete() (also with the segments merged as BC7215
+ * merges them) are checked against the results on the way, any broken claim is reported on stderr
+ * and fails the run.
+ * Data and format packets are dumped completely, except the bits after bitLen in the last data
+ * byte, which are not transmitted (same rule as BC7215::compareDpkt()).
+ *
+ * The library source is included directly (AC_LIB_SOURCE), the synthesized bases need a few
+ * of its internal variables. If they are renamed, update synthesizeBase().
+ *
+ * Author: Bitcode
+ * Date: 2026-10-18
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include AC_LIB_SOURCE
+
+#define MAX_MATCHES 64
+
+static uint64_t hash;
+static uint8_t  curSig;
+
+// FNV-1a, 64 bits
+static void emit(const void* data, size_t len)
+{
+    const uint8_t* p = (const uint8_t*)data;
+    while (len--)
+    {
+        hash = (hash ^ *p++) * 0x100000001b3ULL;
+    }
+}
+
+static void emitU8(uint8_t value) { emit(&value, 1); }
+
+static void beginSection(void) { hash = 0xcbf29ce484222325ULL; }
+
+static void endSection(const char* name, int index, int fahrenheit, const char* part, int partIndex)
+{
+    printf("%s %d %c %s %d %016llx\n", name, index, fahrenheit ? 'F' : 'C', part, partIndex, (unsigned long long)hash);
+}
+
+static void emitPkt(const bc7215DataVarPkt_t* pkt)
+{
+    uint16_t len;
+    uint8_t  bits, mask;
+    if (pkt == NULL)
+    {
+        emitU8(0xee);
+        return;
+    }
+    if (pkt->bitLen == 0)        // combined message, format + data
+    {
+        const bc7215CombinedMsg_t* msg = (const bc7215CombinedMsg_t*)pkt;
+        emitU8(0xcc);
+        emit(msg->body.msg.fmt, sizeof(bc7215FormatPkt_t));
+        curSig = msg->body.msg.fmt->signature.inByte;
+        pkt = msg->body.msg.datPkt;
+    }
+    else
+    {
+        emitU8(0xdd);
+        emit(bc7215_ac_get_base_fmt(), sizeof(bc7215FormatPkt_t));
+        curSig = bc7215_ac_get_base_fmt()->signature.inByte;
+    }
+    emit(&pkt->bitLen, 2);
+    len = pkt->bitLen / 8;
+    bits = pkt->bitLen & 0x07;
+    emit(pkt->data, len);
+    if (bits != 0)
+    {
+        mask = ((curSig & 0x30) == 0x30) ? (uint8_t)((1 << bits) - 1) : (uint8_t)(0xff << (8 - bits));
+        emitU8(pkt->data[len] & mask);
+    }
+}
+
+static void dumpMatch(int fahrenheit)
+{
+    int    temp, mode, fan, key;
+    int8_t t, m, f, p;
+    bool   result;
+    for (temp = -1; temp <= (fahrenheit ? 28 : 14); temp++)
+    {
+        for (mode = -1; mode <= MODE_FAN; mode++)
+        {
+            for (fan = -1; fan <= FAN_HIGH; fan++)
+            {
+                for (key = -1; key <= KEY_FAN; key++)
+                {
+                    emitPkt(fahrenheit ? bc7215_ac_set_f(temp, mode, fan, key) : bc7215_ac_set(temp, mode, fan, key));
+                }
+            }
+        }
+    }
+    emitPkt(bc7215_ac_on());
+    emitPkt(bc7215_ac_off());
+    result = fahrenheit ? bc7215_ac_parse_f(&t, &m, &f, &p) : bc7215_ac_parse(&t, &m, &f, &p);
+    emitU8(result);
+    emitU8(t);
+    emitU8(m);
+    emitU8(f);
+    emitU8(p);
+    emitU8(bc7215_ac_need_extra_sample());
+}
+
+// Save the 2nd base of a key-toggle protocol again and dump the match with it. With rev, the REV bit
+// of its status is the opposite of the base's, as a 2nd sample received inverted would be
+static void dumpSecondBase(const char* name, int index, int fahrenheit, const char* part, int match, int rev)
+{
+    char                      partName[32];
+    static bc7215FormatPkt_t  fmt;
+    static bc7215DataMaxPkt_t dat;
+    bc7215CombinedMsg_t       msg;
+    uint8_t                   status;
+
+    msg = bc7215_ac_get_2nd_base();
+    fmt = *msg.body.msg.fmt;
+    memcpy(&dat, msg.body.msg.datPkt, (msg.body.msg.datPkt->bitLen + 7) / 8 + 2);
+    msg.body.msg.fmt = &fmt;
+    msg.body.msg.datPkt = (const bc7215DataVarPkt_t*)&dat;
+    status = fmt.signature.bits.sig | ((rev ? ~ymndlmvtogxm : ymndlmvtogxm) & 0x40);
+    beginSection();
+    emitU8(bc7215_ac_save_2nd_base(status, &msg));
+    dumpMatch(fahrenheit);
+    snprintf(partName, sizeof(partName), rev ? "%s-rev-2nd-base" : "%s-2nd-base", part);
+    endSection(name, index, fahrenheit, partName, match);
+}
+
+// Claims of the library checked on every capture, reported on stderr so they never change the
+// compared output. Skipped when the reference has no such functions.
+static int claimsBroken;
+
+static void checkCapture(const char* name, int index, int fahrenheit, const char* part, uint8_t msgCnt,
+                         const uint8_t status[], const bc7215CombinedMsg_t msgs[], bool found)
+{
+#ifdef CAPTURE_OK
+    uint8_t reason = bc7215_ac_check_capture(msgCnt, status, msgs);
+    if (found && (reason != CAPTURE_OK))
+    {
+        fprintf(stderr, "%s %d %c %s: matched, but bc7215_ac_check_capture() rejects it (%u)\n", name, index,
+                fahrenheit ? 'F' : 'C', part, reason);
+        claimsBroken++;
+    }
+#else
+    (void)name; (void)index; (void)fahrenheit; (void)part; (void)msgCnt; (void)status; (void)msgs; (void)found;
+#endif
+}
+
+// Every way BC7215 can merge the segments of a descriptor (consecutive ones received as one) is
+// checked, none of the captures short of the whole frame may be taken as complete
+static void checkSegments(int index, const struct vsghnouiwbyk* desc, uint8_t segCnt)
+{
+#ifdef BC7215_AC_STREAM_PAIRING
+    uint16_t groupBits[4];
+    uint8_t  merge, seg, groupCnt, k;
+    for (merge = 0; merge < (1 << (segCnt - 1)); merge++)        // bit s set: segment s+1 merged into s
+    {
+        groupCnt = 0;
+        for (seg = 0; seg < segCnt; seg++)
+        {
+            if ((seg == 0) || !(merge & (1 << (seg - 1))))
+            {
+                groupBits[groupCnt++] = 0;
+            }
+            groupBits[groupCnt - 1] += desc->kbuoarkttzag[seg];
+        }
+        for (k = 1; k < groupCnt; k++)
+        {
+            if (bc7215_ac_segs_complete(k, groupBits))
+            {
+                fprintf(stderr, "descriptor %d: bc7215_ac_segs_complete() ends the capture after %u of %u segments",
+                        index, k, groupCnt);
+                for (seg = 0; seg < groupCnt; seg++)
+                {
+                    fprintf(stderr, " %u", groupBits[seg]);
+                }
+                fprintf(stderr, "\n");
+                claimsBroken++;
+            }
+        }
+    }
+#else
+    (void)index; (void)desc; (void)segCnt;
+#endif
+}
+
+// Pair-encoded protocols leave the bits they cannot decode (e.g. of an inverted frame) as the
+// previous frame left them in the scratch frame, so it is cleared before each init, otherwise
+// the result depends on what ran before
+static void clearScratch(void)
+{
+    memset(&iukuxevqncnf, 0, sizeof(iukuxevqncnf));
+}
+
+// Walk all matches of an init, part names the sections
+static void dumpMatches(const char* name, int index, int fahrenheit, bool found, const char* part)
+{
+    char partName[32];
+    int  n;
+
+    for (n = 0; found && (n < MAX_MATCHES); n++)
+    {
+        beginSection();
+        emit(&pasvjyeomvil, sizeof(pasvjyeomvil));
+        dumpMatch(fahrenheit);
+        endSection(name, index, fahrenheit, part, n);
+        if ((bc7215_ac_need_extra_sample() >= 1) && (bc7215_ac_need_extra_sample() <= 3))
+        {
+            dumpSecondBase(name, index, fahrenheit, part, n, 0);
+            dumpSecondBase(name, index, fahrenheit, part, n, 1);
+        }
+        found = bc7215_ac_find_next();
+    }
+    if (n == 0)
+    {
+        snprintf(partName, sizeof(partName), "no-%s", part);
+        beginSection();
+        endSection(name, index, fahrenheit, partName, 0);
+    }
+}
+
+// Init with a single frame, as received and with the REV bit set and the data inverted
+static void dumpInit(const char* name, int index, const bc7215FormatPkt_t* format, const bc7215DataVarPkt_t* data, int fahrenheit)
+{
+    static bc7215FormatPkt_t  fmt;
+    static bc7215DataMaxPkt_t dat;
+    bc7215CombinedMsg_t       msg;
+    uint8_t                   status;
+    uint16_t                  i;
+    int                       rev;
+    bool                      found;
+
+    for (rev = 0; rev < 2; rev++)
+    {
+        fmt = *format;
+        memcpy(&dat, data, (data->bitLen + 7) / 8 + 2);
+        status = fmt.signature.inByte;
+        if (rev)
+        {
+            status |= 0x40;
+            for (i = 0; i < (dat.bitLen + 7) / 8; i++)
+            {
+                dat.data[i] = ~dat.data[i];
+            }
+        }
+        msg.bitLen = 0;
+        msg.body.msg.fmt = &fmt;
+        msg.body.msg.datPkt = (const bc7215DataVarPkt_t*)&dat;
+        clearScratch();
+        found = fahrenheit ? bc7215_ac_init_f(status, (const bc7215DataVarPkt_t*)&msg)
+                           : bc7215_ac_init(status, (const bc7215DataVarPkt_t*)&msg);
+        checkCapture(name, index, fahrenheit, rev ? "rev-match" : "match", 1, &status, &msg, found);
+        dumpMatches(name, index, fahrenheit, found, rev ? "rev-match" : "match");
+    }
+}
+
+// Split a synthesized base of a multi-segment descriptor into its segments and init with them,
+// the format signature is chosen so that init2 converts it back to the descriptor's
+static void dumpSegments(int index, const bc7215FormatPkt_t* format, const bc7215DataVarPkt_t* data, int fahrenheit)
+{
+    static bc7215FormatPkt_t  fmt;
+    static bc7215DataMaxPkt_t seg[4];
+    const struct vsghnouiwbyk* desc = jywzwyhwwlhx[index];
+    bc7215CombinedMsg_t       msgs[4];
+    uint8_t                   status[4];
+    uint8_t                   segCnt, s, special;
+    uint16_t                  bit, pos, b0;
+    bool                      found;
+
+    for (segCnt = 0; (segCnt < 4) && (desc->kbuoarkttzag[segCnt] != 0); segCnt++)
+        ;
+    if (segCnt < 2)
+    {
+        return;
+    }
+    if (!fahrenheit)
+    {
+        checkSegments(index, desc, segCnt);
+    }
+    fmt = *format;
+    for (b0 = 0; b0 < 256; b0++)
+    {
+        special = ((b0 & 0x07) ^ 0x05) * segCnt + segCnt - 1;
+        if ((special <= 8) && ((((b0 & 0xf8) + (special ^ 0x05)) & 0x3f) == (desc->signature & 0x3f)))
+        {
+            break;
+        }
+    }
+    if (b0 == 256)
+    {
+        beginSection();
+        endSection("descriptor", index, fahrenheit, "no-seg-format", 0);
+        return;
+    }
+    ((uint8_t*)&fmt)[0] = (uint8_t)b0;
+    memset(seg, 0, sizeof(seg));
+    pos = 0;
+    for (s = 0; s < segCnt; s++)
+    {
+        seg[s].bitLen = desc->kbuoarkttzag[s];
+        for (bit = 0; (bit < seg[s].bitLen) && (pos < data->bitLen); bit++, pos++)
+        {
+            if (data->data[pos / 8] & (1 << (pos % 8)))
+            {
+                seg[s].data[bit / 8] |= 1 << (bit % 8);
+            }
+        }
+        status[s] = fmt.signature.inByte;
+        msgs[s].bitLen = 0;
+        msgs[s].body.msg.fmt = &fmt;
+        msgs[s].body.msg.datPkt = (const bc7215DataVarPkt_t*)&seg[s];
+    }
+    clearScratch();
+    found = fahrenheit ? bc7215_ac_init2_f(segCnt, msgs, 60) : bc7215_ac_init2(segCnt, msgs, 60);
+    checkCapture("descriptor", index, fahrenheit, "seg-match", segCnt, status, msgs, found);
+    dumpMatches("descriptor", index, fahrenheit, found, "seg-match");
+}
+
+// Build a 25C(78F)/Cool/Auto frame of a descriptor from an all-zero base, as its own remote would send
+static const bc7215DataVarPkt_t* synthesizeBase(uint16_t index, int fahrenheit, bc7215FormatPkt_t* fmt, bc7215DataMaxPkt_t* base)
+{
+    const struct vsghnouiwbyk* desc = jywzwyhwwlhx[index];
+    const bc7215DataVarPkt_t*  pkt;
+
+    *fmt = *bc7215_ac_predefined_fmt(0);
+    fmt->signature.inByte = desc->signature;
+    fmt->format[8] = 0x1c;        // timing every format extender accepts
+    fahrenheitInit = fahrenheit;
+    ylalbobacimq = desc;
+    pasvjyeomvil = index;
+    altProtocolUsing = false;
+    formatLoaded = true;
+    secFmtLoaded = false;
+    dayyhlonocwg = *fmt;
+    ymndlmvtogxm = desc->signature;
+    memset(gqikxxqqjecf, 0, sizeof(gqikxxqqjecf));        // merging reads one byte past each segment
+    memset(base, 0, sizeof(*base));
+    base->bitLen = desc->bitLen;
+    bc7215_ac_replace_base(desc->signature, (const bc7215DataVarPkt_t*)base);
+    pkt = fahrenheit ? bc7215_ac_set_f(78 - 60, MODE_COOL, FAN_AUTO, KEY_PLUS) : bc7215_ac_set(25 - 16, MODE_COOL, FAN_AUTO, KEY_PLUS);
+    if (pkt == NULL)
+    {
+        return NULL;
+    }
+    if (pkt->bitLen == 0)
+    {
+        *fmt = *((const bc7215CombinedMsg_t*)pkt)->body.msg.fmt;
+        pkt = ((const bc7215CombinedMsg_t*)pkt)->body.msg.datPkt;
+    }
+    memcpy(base, pkt, (pkt->bitLen + 7) / 8 + 2);
+    return (const bc7215DataVarPkt_t*)base;
+}
+
+int main(void)
+{
+    bc7215FormatPkt_t         fmt;
+    bc7215DataMaxPkt_t        base;
+    const bc7215DataVarPkt_t* pkt;
+    uint16_t                  i;
+    int                       fahrenheit;
+
+    printf("version %s descriptors %u\n", bc7215_ac_get_ver(), kbyuvmrshpgh);
+    for (i = 0; i < bc7215_ac_predefined_cnt(); i++)
+    {
+        fmt = *bc7215_ac_predefined_fmt(i);
+        for (fahrenheit = 0; fahrenheit < 2; fahrenheit++)
+        {
+            pkt = fahrenheit ? bc7215_ac_predefined_data_f(i) : bc7215_ac_predefined_data(i);
+            memcpy(&base, pkt, (pkt->bitLen + 7) / 8 + 2);
+            beginSection();
+            emitPkt((const bc7215DataVarPkt_t*)&base);
+            endSection("predefined", i, fahrenheit, "data", 0);
+            dumpInit("predefined", i, &fmt, (const bc7215DataVarPkt_t*)&base, fahrenheit);
+        }
+    }
+    for (i = 0; i < kbyuvmrshpgh; i++)
+    {
+        for (fahrenheit = 0; fahrenheit < 2; fahrenheit++)
+        {
+            pkt = synthesizeBase(i, fahrenheit, &fmt, &base);
+            beginSection();
+            emitPkt(pkt);
+            endSection("descriptor", i, fahrenheit, "base", 0);
+            if (pkt != NULL)
+            {
+                dumpInit("descriptor", i, &fmt, pkt, fahrenheit);
+                dumpSegments(i, &fmt, pkt, fahrenheit);
+            }
+        }
+    }
+    if (claimsBroken != 0)
+    {
+        fprintf(stderr, "%d library claims broken\n", claimsBroken);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,67 @@
+#!/bin/sh
+#
+# ac_equivalence.sh
+#
+# Description: Checks that the working tree copy of the A/C control library (src/bc7215_ac_lib.c)
+# produces exactly the same frames as a frozen reference, the same file taken from git at a fixed
+# commit (the baseline release, ca3e70c).
+# ac_equivalence.c is built against each of them with the same compiler and flags, both are run
+# and their outputs (one hash per predefined entry / descriptor, unit and matched protocol) are
+# compared. The first differing sections are printed and the exit status is 1 if any differ.
+# Run it before committing any change of bc7215_ac_lib.c or bc7215_lib_config.h, e.g.
+#     extras/tools/ac_equivalence.sh                 reference is the baseline release
+#     REF=HEAD extras/tools/ac_equivalence.sh        reference is any tag or commit
+# Options of bc7215_lib_config.h which change the output on purpose and which the reference
+# does not have are turned off in the working tree build (BC7215_AC_ANY_STATE_INIT matches
+# protocols the reference cannot), so the default comparison stays exact.
+# The library reads a few bytes past some of its buffers, so results may depend on memory
+# layout. Always compare builds made with the same CFLAGS.
+# bc7215_types.h is taken from the working tree and copied next to each library, so that its
+# include of bc7215_lib_config.h picks the configuration of that library.
+# Requires gcc (or CC) and git.
+#
+# Author: Bitcode
+# Date: 2026-10-18
+#
+
+CC=${CC:-gcc}
+CFLAGS=${CFLAGS:--O1}
+REF=${REF:-ca3e70c}
+
+TOOL_DIR=$(cd "$(dirname "$0")" && pwd)
+SRC_DIR=$(cd "$TOOL_DIR/../../src" && pwd)
+WORK_DIR=$(mktemp -d)
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+mkdir "$WORK_DIR/src" "$WORK_DIR/tree"
+for f in bc7215_ac_lib.c bc7215_ac_lib.h bc7215_lib_config.h; do
+    (cd "$SRC_DIR" && git show "$REF:./$f") > "$WORK_DIR/src/$f" || exit 1
+    cp "$SRC_DIR/$f" "$WORK_DIR/tree/$f" || exit 1
+done
+cp "$SRC_DIR/bc7215_types.h" "$WORK_DIR/src/" && cp "$SRC_DIR/bc7215_types.h" "$WORK_DIR/tree/" || exit 1
+for opt in BC7215_AC_ANY_STATE_INIT; do
+    if ! grep -q "#define $opt " "$WORK_DIR/src/bc7215_lib_config.h"; then
+        sed -i "s/#define $opt .*/#define $opt 0/" "$WORK_DIR/tree/bc7215_lib_config.h"
+        echo "$opt is not in $REF, off in the working tree build"
+    fi
+done
+
+build()
+{
+    $CC $CFLAGS -std=gnu99 -w -I"$2" -I"$SRC_DIR" -DAC_LIB_SOURCE="\"$2/bc7215_ac_lib.c\"" \
+        "$TOOL_DIR/ac_equivalence.c" -o "$WORK_DIR/$1" || exit 1
+}
+build ref "$WORK_DIR/src"
+build new "$WORK_DIR/tree"
+"$WORK_DIR/ref" > "$WORK_DIR/ref.txt" || exit 1
+"$WORK_DIR/new" > "$WORK_DIR/new.txt" || exit 1
+
+echo "A/C library equivalence, $REF against working tree ($CC $CFLAGS)"
+echo "$(wc -l < "$WORK_DIR/ref.txt") sections compared"
+if cmp -s "$WORK_DIR/ref.txt" "$WORK_DIR/new.txt"; then
+    echo "identical"
+    exit 0
+fi
+echo "$(diff "$WORK_DIR/ref.txt" "$WORK_DIR/new.txt" | grep -c '^<') sections differ, first ones:"
+diff "$WORK_DIR/ref.txt" "$WORK_DIR/new.txt" | grep '^[<>]' | head -20
+exit 1
@@ -0,0 +1,106 @@
+#!/bin/sh
+#
+# ac_flash_report.sh
+#
+# Description: Flash used by the A/C control library (bc7215_ac_lib.c), split into code and the
+# classes of protocol tables, and how far the tables could be compressed at best.
+# Only value tables and data blobs (base and predefined packets, formats) hold no pointers,
+# descriptors, field records and rule lists point to functions, tables and other descriptors and
+# can not be stored compressed. Their "deflate -9" size is a lower bound for any compressed
+# storage, the decompressor and its RAM buffer are not counted.
+# Figures depend on the compiler and the CPU, run it with the cross compiler of the target,
+# e.g.
+#     CC=xtensa-lx106-elf-gcc extras/tools/ac_flash_report.sh
+#     CC=arm-none-eabi-gcc CFLAGS="-Os -mcpu=cortex-m0plus -mthumb" extras/tools/ac_flash_report.sh
+# Requires gcc (or CC), nm, objcopy, gzip and awk.
+#
+# Author: Bitcode
+# Date: 2026-10-18
+#
+
+CC=${CC:-gcc}
+CFLAGS=${CFLAGS:--Os}
+NM=${NM:-$(echo "$CC" | sed 's/gcc$/nm/')}
+OBJCOPY=${OBJCOPY:-$(echo "$CC" | sed 's/gcc$/objcopy/')}
+
+SRC_DIR=$(cd "$(dirname "$0")/../../src" && pwd)
+WORK_DIR=$(mktemp -d)
+trap 'rm -rf "$WORK_DIR"' EXIT
+OBJ="$WORK_DIR/bc7215_ac_lib.o"
+
+$CC $CFLAGS -std=gnu99 -I"$SRC_DIR" -ffunction-sections -fdata-sections \
+    -c "$SRC_DIR/bc7215_ac_lib.c" -o "$OBJ" || exit 1
+
+# class of every constant table, from its definition
+awk '
+{
+    while (match($0, /\(bc7215DataVarPkt_t\*\)[A-Za-z0-9_]+/))
+    {
+        blob[substr($0, RSTART + 21, RLENGTH - 21)] = 1;
+        $0 = substr($0, RSTART + RLENGTH);
+    }
+}
+END { for (n in blob) print n, "blob" }' "$SRC_DIR/bc7215_ac_lib.c" > "$WORK_DIR/blobs"
+awk '
+/^static const struct (vsghnouiwbyk|sxpegamfsrfd) / { print $5, "descriptor"; next }
+/^static const lieoifkbswcz / { sub(/\[.*/, "", $4); print $4, "field"; next }
+/^static const struct tbacqdqyhzjl / { sub(/\[.*/, "", $5); print $5, "rule"; next }
+/^static const uint8_t [A-Za-z0-9_]+\[/ { sub(/\[.*/, "", $4); print $4, "value"; next }
+/^static const bc7215FormatPkt_t / { sub(/\[.*/, "", $4); print $4, "blob"; next }' \
+    "$SRC_DIR/bc7215_ac_lib.c" > "$WORK_DIR/classes"
+
+"$NM" -S --defined-only "$OBJ" | awk -v classes="$WORK_DIR/classes" -v blobs="$WORK_DIR/blobs" '
+BEGIN {
+    while ((getline line < classes) > 0) { split(line, f, " "); class[f[1]] = f[2] }
+    while ((getline line < blobs) > 0) { split(line, f, " "); if (class[f[1]] == "value") class[f[1]] = "blob" }
+}
+NF == 4 {
+    size = 0;
+    for (i = 1; i <= length($2); i++)
+    {
+        size = size * 16 + index("0123456789abcdef", tolower(substr($2, i, 1))) - 1;
+    }
+    if ($3 ~ /[tT]/) c = "code";
+    else if ($4 in class) c = class[$4];
+    else if ($3 ~ /[rR]/) c = "other";
+    else next;                      # RAM
+    print c, $4, size;
+}' > "$WORK_DIR/symbols"
+
+# pointer free tables, in order of definition, for the compression bound
+for c in value blob; do
+    awk -v c=$c '$1 == c { print $2 }' "$WORK_DIR/symbols" | while read -r name; do
+        for s in ".rodata.$name" ".data.rel.ro.local.$name" ".data.rel.ro.$name"; do
+            if "$OBJCOPY" -O binary --only-section="$s" "$OBJ" "$WORK_DIR/sym" 2>/dev/null && [ -s "$WORK_DIR/sym" ]; then
+                cat "$WORK_DIR/sym"
+                break
+            fi
+        done
+    done > "$WORK_DIR/$c.bin"
+done
+
+deflated()
+{
+    # gzip adds 18 bytes of header and trailer
+    echo $(( $(gzip -9 -n < "$1" | wc -c) - 18 ))
+}
+
+echo "BC7215 A/C library flash ($CC $CFLAGS)"
+echo
+awk -v value_z="$(deflated "$WORK_DIR/value.bin")" -v blob_z="$(deflated "$WORK_DIR/blob.bin")" '
+{ count[$1]++; bytes[$1] += $3; total += $3 }
+END {
+    split("code descriptor field rule value blob other", order, " ");
+    split("code|descriptors|field records|checksum rule lists|value tables|data blobs|other tables", title, "|");
+    printf("%-22s %8s %8s %12s\n", "", "symbols", "bytes", "deflate -9");
+    for (i = 1; i <= 7; i++)
+    {
+        c = order[i];
+        z = (c == "value") ? value_z : ((c == "blob") ? blob_z : "-");
+        printf("%-22s %8d %8d %12s\n", title[i], count[c], bytes[c], z);
+    }
+    printf("%-22s %8s %8d\n", "total", "", total);
+    free = bytes["value"] + bytes["blob"];
+    printf("\npointer free tables: %d bytes, compressed at best to %d (%d bytes saved before the decompressor)\n",
+           free, value_z + blob_z, free - value_z - blob_z);
+}' "$WORK_DIR/symbols"
@@ -0,0 +1,362 @@
+/*
+ * ac_table_dedup.c
+ *
+ * Description: Merges the duplicate tables of the A/C control library (bc7215_ac_lib.c) and
+ * prints the compacted source. Value tables (static const uint8_t x[]) that are identical to,
+ * or contained in, a longer one and checksum rule lists (static const struct tbacqdqyhzjl x[])
+ * that are identical to, or the tail of, a longer one are removed and their references point
+ * into the table that is kept, e.g. (qlbsybjbuuwq+2). Tables referenced with & or sizeof, or
+ * before the kept table is defined, are left alone. Only one-line definitions are handled, the
+ * output of a run is not changed by running it again.
+ * The merged source must produce the same frames, check it with ac_equivalence.sh before
+ * committing it.
+ * Build:
+ *     cc -O2 ac_table_dedup.c -o ac_table_dedup
+ * Usage:
+ *     ac_table_dedup ../../src/bc7215_ac_lib.c > bc7215_ac_lib.c.new
+ * Every table must hold all the values the library reads from it, a table read past its end
+ * would read another one after merging.
+ * A summary of the merged tables and the bytes saved (per byte / pointer) goes to stderr.
+ *
+ * Author: Bitcode
+ * Date: 2026-10-18
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LINES   8192
+#define MAX_TABLES  1024
+#define MAX_ITEMS   256
+#define MAX_NAME    64
+
+enum { VALUE_TABLE, RULE_LIST };
+
+typedef struct
+{
+    char  name[MAX_NAME];
+    int   kind;
+    int   line;                 // line of the definition
+    int   firstRef;             // first line referencing it, other than the definition
+    int   fixed;                // referenced with & or sizeof
+    int   count;                // bytes or rules (with the terminating one)
+    char* item[MAX_ITEMS];      // normalized rules / values
+    int   keeper;               // table it is merged into, -1 = kept
+    int   offset;               // position in the keeper
+} table_t;
+
+static char*   line[MAX_LINES];
+static int     lineCnt;
+static table_t table[MAX_TABLES];
+static int     tableCnt;
+
+static char* dupRange(const char* from, const char* to)
+{
+    char* s = malloc(to - from + 1);
+    int   n = 0;
+    while (from < to)
+    {
+        if (!isspace((unsigned char)*from))
+        {
+            s[n++] = *from;
+        }
+        from++;
+    }
+    s[n] = '\0';
+    return s;
+}
+
+// 'static const uint8_t name[...] = {0x01, ...};', values are stored as decimal strings
+static int parseValueTable(const char* s, table_t* t)
+{
+    const char* p;
+    char*       end;
+    int         n = 0;
+    if ((sscanf(s, "static const uint8_t %63[A-Za-z0-9_]%n", t->name, &n) != 1) || (s[n] != '['))
+    {
+        return 0;
+    }
+    p = strchr(s, '{');
+    if ((p == NULL) || (strstr(p, "};") == NULL) || (strchr(p + 1, '{') != NULL))
+    {
+        return 0;
+    }
+    t->kind = VALUE_TABLE;
+    t->count = 0;
+    p++;
+    while (*p != '}')
+    {
+        long value = strtol(p, &end, 0);
+        char buf[8];
+        if ((end == p) || (t->count == MAX_ITEMS))
+        {
+            return 0;
+        }
+        snprintf(buf, sizeof(buf), "%ld", value);
+        t->item[t->count++] = strdup(buf);
+        p = end;
+        while (isspace((unsigned char)*p) || (*p == ','))
+        {
+            p++;
+        }
+    }
+    return t->count != 0;
+}
+
+// 'static const struct tbacqdqyhzjl name[] = { { f, &x }, ..., {NULL, NULL} };'
+static int parseRuleList(const char* s, table_t* t)
+{
+    const char* p;
+    const char* close;
+    int         n = 0;
+    if ((sscanf(s, "static const struct tbacqdqyhzjl %63[A-Za-z0-9_]%n", t->name, &n) != 1) || (s[n] != '['))
+    {
+        return 0;
+    }
+    p = strchr(s, '{');
+    if ((p == NULL) || (strstr(p, "};") == NULL))
+    {
+        return 0;
+    }
+    t->kind = RULE_LIST;
+    t->count = 0;
+    while ((p = strchr(p + 1, '{')) != NULL)
+    {
+        close = strchr(p, '}');
+        if ((close == NULL) || (t->count == MAX_ITEMS))
+        {
+            return 0;
+        }
+        t->item[t->count++] = dupRange(p, close + 1);
+        p = close;
+    }
+    return (t->count != 0) && (strcmp(t->item[t->count - 1], "{NULL,NULL}") == 0);
+}
+
+static int isIdent(char c) { return isalnum((unsigned char)c) || (c == '_'); }
+
+// Position of 'name' as a whole identifier in 's' at or after 'from', NULL if none
+static const char* findIdent(const char* s, const char* from, const char* name)
+{
+    size_t len = strlen(name);
+    while ((from = strstr(from, name)) != NULL)
+    {
+        if (((from == s) || !isIdent(from[-1])) && !isIdent(from[len]))
+        {
+            return from;
+        }
+        from += len;
+    }
+    return NULL;
+}
+
+static void scanReferences(table_t* t)
+{
+    int         i;
+    const char* p;
+    const char* q;
+    t->firstRef = -1;
+    t->fixed = 0;
+    for (i = 0; i < lineCnt; i++)
+    {
+        if (i == t->line)
+        {
+            continue;
+        }
+        for (p = findIdent(line[i], line[i], t->name); p != NULL; p = findIdent(line[i], p + 1, t->name))
+        {
+            if (t->firstRef < 0)
+            {
+                t->firstRef = i;
+            }
+            for (q = p; (q > line[i]) && isspace((unsigned char)q[-1]); q--)
+                ;
+            if (((q > line[i]) && (q[-1] == '&')) || ((q - line[i] >= 7) && (strncmp(q - 7, "sizeof(", 7) == 0)))
+            {
+                t->fixed = 1;
+            }
+        }
+    }
+}
+
+// Position of the items of 'a' in 'b', -1 if not contained. Rule lists only at the tail
+static int contains(const table_t* b, const table_t* a)
+{
+    int k, i;
+    for (k = 0; k + a->count <= b->count; k++)
+    {
+        if ((a->kind == RULE_LIST) && (k + a->count != b->count))
+        {
+            continue;
+        }
+        for (i = 0; i < a->count; i++)
+        {
+            if (strcmp(a->item[i], b->item[k + i]) != 0)
+            {
+                break;
+            }
+        }
+        if (i == a->count)
+        {
+            return k;
+        }
+    }
+    return -1;
+}
+
+// Longer tables first, then in order of definition, so the kept one of identical tables is the first
+static int order[MAX_TABLES];
+
+static int byLength(const void* x, const void* y)
+{
+    const table_t* a = &table[*(const int*)x];
+    const table_t* b = &table[*(const int*)y];
+    if (a->count != b->count)
+    {
+        return b->count - a->count;
+    }
+    return a->line - b->line;
+}
+
+static void merge(void)
+{
+    int i, j, k;
+    for (i = 0; i < tableCnt; i++)
+    {
+        order[i] = i;
+    }
+    qsort(order, tableCnt, sizeof(order[0]), byLength);
+    for (i = 0; i < tableCnt; i++)
+    {
+        table_t* a = &table[order[i]];
+        if (a->fixed || (a->firstRef < 0))
+        {
+            continue;
+        }
+        for (j = 0; j < i; j++)
+        {
+            table_t* b = &table[order[j]];
+            if ((b->keeper >= 0) || (b->kind != a->kind) || (b->line > a->firstRef)
+                || ((b->count == a->count) && (a->line < b->line)))
+            {
+                continue;
+            }
+            k = contains(b, a);
+            if (k >= 0)
+            {
+                a->keeper = order[j];
+                a->offset = k;
+                break;
+            }
+        }
+    }
+}
+
+static void printLine(const char* s)
+{
+    const char* p = s;
+    int         i;
+    while (*p != '\0')
+    {
+        if (isIdent(*p) && ((p == s) || !isIdent(p[-1])))
+        {
+            const char* end = p;
+            while (isIdent(*end))
+            {
+                end++;
+            }
+            for (i = 0; i < tableCnt; i++)
+            {
+                if ((table[i].keeper >= 0) && (strlen(table[i].name) == (size_t)(end - p))
+                    && (strncmp(table[i].name, p, end - p) == 0))
+                {
+                    break;
+                }
+            }
+            if (i < tableCnt)
+            {
+                if (table[i].offset == 0)
+                {
+                    fputs(table[table[i].keeper].name, stdout);
+                }
+                else
+                {
+                    printf("(%s+%d)", table[table[i].keeper].name, table[i].offset);
+                }
+            }
+            else
+            {
+                fwrite(p, 1, end - p, stdout);
+            }
+            p = end;
+        }
+        else
+        {
+            putchar(*p++);
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    FILE* f;
+    char  buf[65536];
+    int   i, removed[2] = {0, 0}, saved[2] = {0, 0};
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s bc7215_ac_lib.c > output\n", argv[0]);
+        return 2;
+    }
+    f = fopen(argv[1], "r");
+    if (f == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+    while (fgets(buf, sizeof(buf), f) != NULL)
+    {
+        if (lineCnt == MAX_LINES)
+        {
+            fprintf(stderr, "%s: too many lines\n", argv[1]);
+            return 1;
+        }
+        line[lineCnt] = strdup(buf);
+        if ((tableCnt < MAX_TABLES) && (parseValueTable(buf, &table[tableCnt]) || parseRuleList(buf, &table[tableCnt])))
+        {
+            table[tableCnt].line = lineCnt;
+            table[tableCnt].keeper = -1;
+            tableCnt++;
+        }
+        lineCnt++;
+    }
+    fclose(f);
+
+    for (i = 0; i < tableCnt; i++)
+    {
+        scanReferences(&table[i]);
+    }
+    merge();
+
+    for (i = 0; i < tableCnt; i++)
+    {
+        if (table[i].keeper >= 0)
+        {
+            line[table[i].line] = NULL;
+            removed[table[i].kind]++;
+            saved[table[i].kind] += table[i].count;
+            fprintf(stderr, "%s -> %s+%d\n", table[i].name, table[table[i].keeper].name, table[i].offset);
+        }
+    }
+    for (i = 0; i < lineCnt; i++)
+    {
+        if (line[i] != NULL)
+        {
+            printLine(line[i]);
+        }
+    }
+    fprintf(stderr, "%d value tables merged, %d bytes saved\n", removed[VALUE_TABLE], saved[VALUE_TABLE]);
+    fprintf(stderr, "%d rule lists merged, %d rules saved (2 pointers each)\n", removed[RULE_LIST], saved[RULE_LIST]);
+    return 0;
+}
@@ -0,0 +1,96 @@
+/*
+ * archive_dump.c
+ *
+ * Description: Prints the records of BC7215 capture archives (written by BC7215ArchiveWriter),
+ * one line per frame in the same style as the ir_decoder example, captures of several segments
+ * are printed as one group. With -s only the number of records and captures is printed.
+ * Also an example of using bc7215_archive_reader.c.
+ * Build:
+ *     cc -O2 -I../../src archive_dump.c bc7215_archive_reader.c -o archive_dump
+ * Usage:
+ *     archive_dump [-s] file...
+ *
+ * Author: Bitcode
+ * Date: 2026-10-18
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include "bc7215_archive_reader.h"
+
+static void printRecord(uint32_t n, const bc7215ArchiveRecord_t* record)
+{
+    uint16_t i;
+    printf("#%u  %u ms  status %02X  %u bits:", n, record->timestamp, record->status, record->bitLen);
+    for (i = 0; i < (record->bitLen + 7) / 8; i++)
+    {
+        printf(" %02X", record->data[i]);
+    }
+    printf("\n");
+    if (record->format != NULL)
+    {
+        printf("    format:");
+        for (i = 0; i < BC7215_ARCHIVE_FORMAT_SIZE; i++)
+        {
+            printf(" %02X", record->format[i]);
+        }
+        printf("\n");
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    bc7215Archive_t       archive;
+    bc7215ArchiveRecord_t record;
+    uint32_t              n, end, captures;
+    int                   i, summary = 0, result = 0;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-s") == 0)
+        {
+            summary = 1;
+            continue;
+        }
+        if (bc7215_archive_open(&archive, argv[i]) != 0)
+        {
+            fprintf(stderr, "%s: %s\n", argv[i], strerror(errno));
+            result = 1;
+            continue;
+        }
+        captures = 0;
+        for (n = 0; n < archive.count; n = end)
+        {
+            end = bc7215_archive_group_end(&archive, n);
+            if (end == n)        // damaged record
+            {
+                fprintf(stderr, "%s: record %u is damaged\n", argv[i], n);
+                result = 1;
+                break;
+            }
+            captures++;
+            if (!summary)
+            {
+                if (end - n > 1)
+                {
+                    printf("capture of %u segments\n", end - n);
+                }
+                for (; n < end; n++)
+                {
+                    bc7215_archive_record(&archive, n, &record);
+                    printRecord(n, &record);
+                }
+            }
+        }
+        printf("%s: %u records, %u captures, index %s\n", argv[i], archive.count, captures,
+               archive.fileIndex != NULL ? "from file" : "rebuilt");
+        bc7215_archive_close(&archive);
+    }
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s [-s] file...\n", argv[0]);
+        result = 2;
+    }
+    return result;
+}
@@ -0,0 +1,180 @@
+/*
+ * bc7215_archive_reader.c
+ *
+ * Description: mmap() based reader of BC7215 capture archives, see bc7215_archive_reader.h
+ *
+ * Author: Bitcode
+ * Date: 2026-10-18
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "bc7215_archive_reader.h"
+
+static uint32_t getU32(const uint8_t* p) { return p[0] | (p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+/* Size of the record at 'offset', 0 if it does not fit in 'end' */
+static size_t recordSize(const uint8_t* base, size_t offset, size_t end)
+{
+    size_t size;
+    if (offset + BC7215_ARCHIVE_REC_HEADER_SIZE > end)
+    {
+        return 0;
+    }
+    size = BC7215_ARCHIVE_REC_HEADER_SIZE + (base[offset + 6] + (base[offset + 7] << 8) + 7) / 8;
+    if (base[offset + 5] & BC7215_ARCHIVE_REC_FORMAT)
+    {
+        size += BC7215_ARCHIVE_FORMAT_SIZE;
+    }
+    return (offset + size <= end) ? size : 0;
+}
+
+static int rebuildIndex(bc7215Archive_t* archive, size_t end)
+{
+    size_t   offset, size;
+    uint32_t capacity = 1024;
+
+    archive->builtIndex = malloc(capacity * sizeof(uint32_t));
+    archive->count = 0;
+    offset = archive->base[10] | (archive->base[11] << 8);        // header size
+    while ((archive->builtIndex != NULL) && ((size = recordSize(archive->base, offset, end)) != 0))
+    {
+        if (archive->count == capacity)
+        {
+            uint32_t* grown = realloc(archive->builtIndex, 2 * capacity * sizeof(uint32_t));
+            if (grown == NULL)
+            {
+                break;
+            }
+            archive->builtIndex = grown;
+            capacity *= 2;
+        }
+        archive->builtIndex[archive->count++] = (uint32_t)offset;
+        offset += size;
+    }
+    if (archive->builtIndex == NULL)
+    {
+        errno = ENOMEM;
+        return -1;
+    }
+    return 0;
+}
+
+int bc7215_archive_open(bc7215Archive_t* archive, const char* path)
+{
+    struct stat st;
+    size_t      end;
+    uint32_t    indexOffset;
+    int         fd;
+
+    memset(archive, 0, sizeof(*archive));
+    fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return -1;
+    }
+    if (fstat(fd, &st) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+    archive->size = st.st_size;
+    if (archive->size >= BC7215_ARCHIVE_HEADER_SIZE)
+    {
+        archive->base = mmap(NULL, archive->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+    if ((archive->base == NULL) || (archive->base == MAP_FAILED) || (memcmp(archive->base, BC7215_ARCHIVE_MAGIC, 8) != 0))
+    {
+        if ((archive->base != NULL) && (archive->base != MAP_FAILED))
+        {
+            munmap((void*)archive->base, archive->size);
+        }
+        archive->base = NULL;
+        errno = EINVAL;
+        return -1;
+    }
+    madvise((void*)archive->base, archive->size, MADV_SEQUENTIAL);
+
+    end = archive->size;
+    if ((end >= BC7215_ARCHIVE_HEADER_SIZE + BC7215_ARCHIVE_TRAILER_SIZE)
+        && (memcmp(archive->base + end - BC7215_ARCHIVE_TRAILER_SIZE, BC7215_ARCHIVE_INDEX_MAGIC, 8) == 0))
+    {
+        archive->count = getU32(archive->base + end - 8);
+        indexOffset = getU32(archive->base + end - 4);
+        end -= BC7215_ARCHIVE_TRAILER_SIZE;
+        if ((indexOffset != 0) && ((uint64_t)indexOffset + 4ull * archive->count == end))
+        {
+            archive->fileIndex = archive->base + indexOffset;
+            return 0;
+        }
+        if (indexOffset != 0)
+        {
+            end = indexOffset;
+        }
+    }
+    if (rebuildIndex(archive, end) != 0)
+    {
+        bc7215_archive_close(archive);
+        return -1;
+    }
+    return 0;
+}
+
+void bc7215_archive_close(bc7215Archive_t* archive)
+{
+    if (archive->base != NULL)
+    {
+        munmap((void*)archive->base, archive->size);
+    }
+    free(archive->builtIndex);
+    memset(archive, 0, sizeof(*archive));
+}
+
+bool bc7215_archive_record(const bc7215Archive_t* archive, uint32_t n, bc7215ArchiveRecord_t* record)
+{
+    const uint8_t* p;
+    uint32_t       offset;
+    if (n >= archive->count)
+    {
+        return false;
+    }
+    offset = (archive->fileIndex != NULL) ? getU32(archive->fileIndex + 4 * n) : archive->builtIndex[n];
+    if (recordSize(archive->base, offset, archive->size) == 0)        // index pointing outside the file
+    {
+        return false;
+    }
+    p = archive->base + offset;
+    record->timestamp = getU32(p);
+    record->status = p[4];
+    record->flags = p[5];
+    record->bitLen = p[6] | (p[7] << 8);
+    p += BC7215_ARCHIVE_REC_HEADER_SIZE;
+    record->format = NULL;
+    if (record->flags & BC7215_ARCHIVE_REC_FORMAT)
+    {
+        record->format = p;
+        p += BC7215_ARCHIVE_FORMAT_SIZE;
+    }
+    record->data = p;
+    return true;
+}
+
+uint32_t bc7215_archive_group_end(const bc7215Archive_t* archive, uint32_t n)
+{
+    bc7215ArchiveRecord_t record;
+    while (bc7215_archive_record(archive, n, &record))
+    {
+        n++;
+        if (!(record.flags & BC7215_ARCHIVE_REC_MORE))
+        {
+            break;
+        }
+    }
+    return n;
+}
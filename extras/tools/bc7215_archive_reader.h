@@ -0,0 +1,51 @@
+/*
+ * bc7215_archive_reader.h
+ *
+ * Description: Host side reader of BC7215 capture archives (format in src/bc7215_archive.h).
+ * The file is mapped with mmap() and records are returned as pointers into the mapping, no
+ * record is copied or parsed before it is asked for. The index written by the device is used
+ * when present, otherwise it is rebuilt with one walk over the records (archive not closed,
+ * or the device had no room to keep the offsets). A truncated last record is dropped.
+ * POSIX only.
+ *
+ * Author: Bitcode
+ * Date: 2026-10-18
+ */
+
+#ifndef BC7215_ARCHIVE_READER_H
+#define BC7215_ARCHIVE_READER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "bc7215_archive.h"
+
+typedef struct
+{
+    const uint8_t* base;            /* mapped file */
+    size_t         size;
+    uint32_t       count;           /* number of records */
+    const uint8_t* fileIndex;       /* index in the file (little-endian), or NULL */
+    uint32_t*      builtIndex;      /* index rebuilt by the reader, or NULL */
+} bc7215Archive_t;
+
+typedef struct
+{
+    uint32_t       timestamp;       /* ms, as given to the writer */
+    uint8_t        status;          /* status byte reported by BC7215 */
+    uint8_t        flags;           /* BC7215_ARCHIVE_REC_xxx */
+    uint16_t       bitLen;
+    const uint8_t* format;          /* 33 byte format packet, or NULL */
+    const uint8_t* data;            /* (bitLen + 7) / 8 bytes */
+} bc7215ArchiveRecord_t;
+
+/* Map an archive, 0 on success, -1 (errno set) if the file can not be read or is not an archive */
+int  bc7215_archive_open(bc7215Archive_t* archive, const char* path);
+void bc7215_archive_close(bc7215Archive_t* archive);
+
+/* Get record 'n', false if out of range */
+bool bc7215_archive_record(const bc7215Archive_t* archive, uint32_t n, bc7215ArchiveRecord_t* record);
+
+/* Index of the first record after the capture record 'n' belongs to */
+uint32_t bc7215_archive_group_end(const bc7215Archive_t* archive, uint32_t n);
+
+#endif
@@ -0,0 +1,80 @@
+#
+# bench_history.sh
+#
+# Description: History handling shared by the host benches (driver_bench.sh, latency_bench.sh),
+# sourced by them, not run. Results are "name value unit" lines, history lines are
+#     date,commit,host,compiler,name,value,unit
+# The history is kept outside the source tree by default, in
+# ${XDG_STATE_HOME:-~/.local/state}/bc7215/<bench>_history.csv, set HISTORY to use another file
+# or HISTORY=/dev/null to keep none.
+# Requires awk, and git for the commit id.
+#
+# Author: Bitcode
+# Date: 2026-10-18
+#
+
+# bench_history_file BENCH
+# Sets HISTORY to the default history file of BENCH unless it is already set
+bench_history_file()
+{
+    if [ -z "$HISTORY" ]; then
+        HISTORY="${XDG_STATE_HOME:-$HOME/.local/state}/bc7215/$1_history.csv"
+        mkdir -p "$(dirname "$HISTORY")" 2> /dev/null
+    fi
+}
+
+# bench_commit SRC_DIR
+# Sets COMMIT to the short commit id of SRC_DIR, followed by + if it has uncommitted changes
+bench_commit()
+{
+    COMMIT=$(cd "$1" && git rev-parse --short HEAD 2> /dev/null || echo unknown)
+    if [ -n "$(cd "$1" && git status --porcelain -- . 2> /dev/null)" ]; then
+        COMMIT="$COMMIT+"        # uncommitted changes in src
+    fi
+}
+
+# bench_compare RESULTS CHANGE [HOST COMPILER]
+# Prints every result next to the last value of the same test in HISTORY, taken from runs made
+# with HOST and COMPILER if given. CHANGE is "percent" (relative change, always shown) or
+# "delta" (difference, shown only when the value changed)
+bench_compare()
+{
+    touch "$HISTORY" 2> /dev/null
+    awk -v change="$2" -v host="$3" -v compiler="$4" '
+    FILENAME == ARGV[1] {           # history, keep the last value of every test
+        n = split($0, f, ",");
+        if ((n == 7) && ((host == "") || ((f[3] == host) && (f[4] == compiler))))
+        {
+            prev[f[5]] = f[6];
+            prevCommit = f[2];
+        }
+        next;
+    }
+    {
+        if (FNR == 1)
+        {
+            printf("%-24s %12s %6s %12s %8s\n", "test", "result", "", prevCommit != "" ? "previous " prevCommit : "previous", "change");
+        }
+        if (($1 in prev) && (change == "percent"))
+        {
+            printf("%-24s %12.2f %-6s %12.2f %+7.1f%%\n", $1, $2, $3, prev[$1], prev[$1] != 0 ? ($2 - prev[$1]) * 100 / prev[$1] : 0);
+        }
+        else if (($1 in prev) && (prev[$1] != $2))
+        {
+            printf("%-24s %12.2f %-6s %12.2f %+8.2f\n", $1, $2, $3, prev[$1], $2 - prev[$1]);
+        }
+        else
+        {
+            printf("%-24s %12.2f %-6s\n", $1, $2, $3);
+        }
+    }
+    ' "$HISTORY" "$1"
+}
+
+# bench_append RESULTS HOST COMPILER
+# Appends the results to HISTORY, stamped with the date, COMMIT, HOST and COMPILER
+bench_append()
+{
+    awk -v prefix="$(date +%Y-%m-%dT%H:%M:%S),$COMMIT,$2,$3" '{ printf("%s,%s,%s,%s\n", prefix, $1, $2, $3) }' \
+        "$1" >> "$HISTORY"
+}
@@ -0,0 +1,29 @@
+// Minimal Arduino API for building the BC7215 driver on a PC, only what bc7215.cpp uses.
+// Pins are not simulated: digitalRead() always returns LOW.
+
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <chrono>
+
+#define HIGH   1
+#define LOW    0
+#define INPUT  0
+#define OUTPUT 1
+
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+inline int  digitalRead(int) { return LOW; }
+
+inline unsigned long millis()
+{
+    return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#include "Stream.h"
+
+#endif
@@ -0,0 +1,388 @@
+/*
+ * driver_bench.cpp
+ *
+ * Description: Host benchmark of the BC7215 driver (src/bc7215.cpp) alone, run by driver_bench.sh.
+ * A mock Stream feeds the driver, so the numbers are the cost of the driver code itself:
+ *   rx_*        receive parsing through processData(), in bytes per second on the UART, for
+ *               clean traffic and for traffic where every payload byte is 0x7a or 0x7b (stuffed)
+ *   tx_*        byte stuffing of irTx(), in payload bytes per second
+ *   getData/getRaw/getFormat
+ *               time per call against packet size, with the packet contiguous in the circular
+ *               buffer or wrapping around its end
+ *   compareDpkt time per call, LSB and MSB first protocols with padding bits
+ *   crc8        time per call
+ * Each result is printed as "name value unit", one per line. The flood guard is checked first:
+ * normal data + format packets at the flood threshold must not flood it, malformed ones must.
+ * A failed check ends the run with an error.
+ * Every run of a test is repeated for at least MIN_TIME_MS, the best of RUNS runs is reported.
+ *
+ * Author: Bitcode
+ * Date: 2026-10-18
+ */
+
+#include <chrono>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include "bc7215.h"
+
+const int    RUNS = 3;
+const double MIN_TIME_MS = 20;
+
+// Plays back a byte sequence in a loop as the UART receive side, counts what is written
+class MockStream : public Stream
+{
+public:
+    const uint8_t* rx = NULL;
+    size_t         rxLen = 0;
+    size_t         rxPos = 0;
+    size_t         remaining = 0;        // bytes left to deliver
+    size_t         txCount = 0;
+    uint8_t        txSum = 0;
+
+    void play(const uint8_t* data, size_t len, size_t total)
+    {
+        rx = data;
+        rxLen = len;
+        rxPos = 0;
+        remaining = total;
+    }
+    int available() { return remaining > 0x7fff ? 0x7fff : (int)remaining; }
+    int read()
+    {
+        uint8_t data;
+        if (remaining == 0)
+        {
+            return -1;
+        }
+        remaining--;
+        data = rx[rxPos];
+        if (++rxPos == rxLen)
+        {
+            rxPos = 0;
+        }
+        return data;
+    }
+    int    peek() { return remaining ? rx[rxPos] : -1; }
+    size_t write(uint8_t data)
+    {
+        txCount++;
+        txSum += data;
+        return 1;
+    }
+    size_t write(const uint8_t* buffer, size_t size)        // UART drivers take a whole buffer in one call
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            txSum += buffer[i];
+        }
+        txCount += size;
+        return size;
+    }
+};
+
+MockStream mockUart;
+
+// BC7215 objects are global in sketches, so their state starts zeroed
+alignas(BC7215) static uint8_t protoStorage[sizeof(BC7215)];
+alignas(BC7215) static uint8_t workStorage[sizeof(BC7215)];
+
+static BC7215* freshDriver(uint8_t* storage, BC7215::MODConnect mod)
+{
+    memset(storage, 0, sizeof(BC7215));
+    return new (storage) BC7215(mockUart, mod, BC7215::BUSY_NC);
+}
+
+// ns per call of f(), best of RUNS
+template <typename F> static double timeCall(F f)
+{
+    double best = 1e30;
+    for (int run = 0; run < RUNS; run++)
+    {
+        long   calls = 0;
+        long   batch = 1;
+        double elapsed = 0;
+        auto   start = std::chrono::steady_clock::now();
+        while (elapsed < MIN_TIME_MS * 1e6)
+        {
+            for (long i = 0; i < batch; i++)
+            {
+                f();
+            }
+            calls += batch;
+            batch *= 2;
+            elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        }
+        if (elapsed / calls < best)
+        {
+            best = elapsed / calls;
+        }
+    }
+    return best;
+}
+
+static void stuff(uint8_t* wire, size_t& len, uint8_t data)
+{
+    if ((data == 0x7a) || (data == 0x7b))
+    {
+        wire[len++] = 0x7b;
+        wire[len++] = data | 0x80;
+    }
+    else
+    {
+        wire[len++] = data;
+    }
+}
+
+// Wire bytes of a received data packet, optionally followed by its format packet
+static size_t rxFrame(uint8_t* wire, const uint8_t* data, uint16_t bytes, bool withFormat)
+{
+    size_t  len = 0;
+    uint16_t bitLen = bytes * 8;
+    for (uint16_t i = 0; i < bytes; i++)
+    {
+        stuff(wire, len, data[i]);
+    }
+    stuff(wire, len, 0x34);        // status
+    stuff(wire, len, bitLen & 0xff);
+    stuff(wire, len, bitLen >> 8);
+    wire[len++] = 0x7a;
+    if (withFormat)
+    {
+        for (uint8_t i = 0; i < 33; i++)
+        {
+            stuff(wire, len, 0x10 + i);
+        }
+        wire[len++] = 0x7a;
+        wire[len++] = 0x7a;
+    }
+    return len;
+}
+
+static void fillClean(uint8_t* data, uint16_t bytes)
+{
+    for (uint16_t i = 0; i < bytes; i++)
+    {
+        data[i] = (i * 37 + 11) & 0xff;
+        if ((data[i] == 0x7a) || (data[i] == 0x7b))
+        {
+            data[i] = 0x55;
+        }
+    }
+}
+
+static void fillEscapes(uint8_t* data, uint16_t bytes)
+{
+    for (uint16_t i = 0; i < bytes; i++)
+    {
+        data[i] = 0x7a + (i & 1);
+    }
+}
+
+static void report(const char* name, double value, const char* unit) { printf("%s %.2f %s\n", name, value, unit); }
+
+static void benchRx(const char* name, bool escapes)
+{
+    static uint8_t wire[(BC7215_MAX_RX_DATA_SIZE + 3 + 33) * 2 + 3];
+    uint8_t        data[BC7215_MAX_RX_DATA_SIZE];
+    const size_t   chunk = 64 * 1024;
+    size_t         len;
+    double         ns;
+    BC7215*        driver = freshDriver(protoStorage, BC7215::MOD_HIGH);
+
+    escapes ? fillEscapes(data, sizeof(data)) : fillClean(data, sizeof(data));
+    len = rxFrame(wire, data, sizeof(data), true);
+    ns = timeCall([&]() {
+        mockUart.play(wire, len, chunk);
+        driver->dataReady();
+    });
+    report(name, chunk / ns * 1e3, "MB/s");
+}
+
+static void benchTx(const char* name, bool escapes)
+{
+    static bc7215DataMaxPkt_t pkt;
+    double                    ns;
+    BC7215*                   driver = freshDriver(protoStorage, BC7215::MOD_LOW);
+
+    escapes ? fillEscapes(pkt.data, sizeof(pkt.data)) : fillClean(pkt.data, sizeof(pkt.data));
+    pkt.bitLen = sizeof(pkt.data) * 8;
+    ns = timeCall([&]() { driver->irTx(pkt); });
+    report(name, sizeof(pkt.data) / ns * 1e3, "MB/s");
+}
+
+// Driver holding a received packet of 'bytes' data bytes which starts at 'start' in the circular buffer
+static BC7215* primedDriver(uint16_t bytes, uint16_t start, bool withFormat)
+{
+    static uint8_t wire[(BC7215_BUFFER_SIZE + 3 + 33) * 2 + 3];
+    uint8_t        data[BC7215_MAX_RX_DATA_SIZE];
+    size_t         len = 0;
+    BC7215*        driver = freshDriver(protoStorage, BC7215::MOD_HIGH);
+
+    fillClean(data, bytes);
+    if (start > 1)        // filler bytes to move the write position, packet starts after the last one written
+    {
+        memset(wire, 0x55, start - 1);
+        len = start - 1;
+        wire[len++] = 0x7a;
+    }
+    len += rxFrame(wire + len, data, bytes, withFormat);
+    mockUart.play(wire, len, len);
+    if (!driver->dataReady() || (withFormat && !driver->formatReady()))
+    {
+        fprintf(stderr, "packet of %u bytes at %u not received\n", bytes, start);
+        exit(1);
+    }
+    return driver;
+}
+
+#if BC7215_FLOOD_GUARD == 1
+// Wire bytes of a packet whose bit count does not match its length
+static size_t rxJunk(uint8_t* wire)
+{
+    memset(wire, 0x55, 4);
+    wire[4] = 0x7a;
+    return 5;
+}
+
+static void checkFlood()
+{
+    // malformed packets one short of a flood once the last packet reaches BC7215_FLOOD_PACKETS
+    const int      junk = (BC7215_FLOOD_PACKETS * BC7215_FLOOD_BAD_PERCENT + 99) / 100 - 1;
+    static uint8_t wire[(BC7215_FLOOD_PACKETS + 1) * 64];
+    uint8_t        data[12];
+    size_t         len = 0;
+    BC7215*        driver = freshDriver(protoStorage, BC7215::MOD_HIGH);
+
+    // noisy channel, then data + format packets up to the threshold: the format packets are not
+    // packets of their own, so the window holds one packet less than a flood
+    fillClean(data, sizeof(data));
+    for (int i = 0; i < junk; i++)
+    {
+        len += rxJunk(wire + len);
+    }
+    for (int i = junk; i < BC7215_FLOOD_PACKETS - 1; i++)
+    {
+        len += rxFrame(wire + len, data, sizeof(data), true);
+    }
+    mockUart.play(wire, len, len);
+    if (!driver->dataReady() || !driver->formatReady() || driver->isFlooded())
+    {
+        fprintf(stderr, "data + format packets flooded the receiver\n");
+        exit(1);
+    }
+
+    // malformed packets only, the last one is counted when the next starts
+    driver = freshDriver(protoStorage, BC7215::MOD_HIGH);
+    len = 0;
+    for (int i = 0; i <= BC7215_FLOOD_PACKETS; i++)
+    {
+        len += rxJunk(wire + len);
+    }
+    mockUart.play(wire, len, len);
+    if (driver->dataReady() || !driver->isFlooded())
+    {
+        fprintf(stderr, "%u malformed packets did not flood the receiver\n", BC7215_FLOOD_PACKETS);
+        exit(1);
+    }
+}
+#endif
+
+// ns of one call of get() on a copy of 'proto', the cost of copying the driver is taken out
+template <typename F> static double timeGet(BC7215* proto, F get)
+{
+    double withGet = timeCall([&]() { get(new (workStorage) BC7215(*proto)); });
+    double copyOnly = timeCall([&]() {
+        BC7215* driver = new (workStorage) BC7215(*proto);
+        asm volatile("" : : "r"(driver) : "memory");
+    });
+    return withGet > copyOnly ? withGet - copyOnly : 0;
+}
+
+static void benchGet()
+{
+    static const uint16_t sizes[] = { 8, 16, 32, 48 };
+    static bc7215DataMaxPkt_t target;
+    static bc7215FormatPkt_t  format;
+    char                      name[48];
+
+    for (uint16_t size : sizes)
+    {
+        for (int wrap = 0; wrap < 2; wrap++)
+        {
+            // wrapped: packet starts before the end of the buffer and continues at its beginning
+            uint16_t start = wrap ? BC7215_BUFFER_SIZE - (size + 3) / 2 : 1;
+            BC7215*  proto = primedDriver(size, start, false);
+            snprintf(name, sizeof(name), "getData_%u_%s", size, wrap ? "wrap" : "flat");
+            report(name, timeGet(proto, [](BC7215* d) { d->getData(target); }), "ns");
+            snprintf(name, sizeof(name), "getRaw_%u_%s", size, wrap ? "wrap" : "flat");
+            report(name, timeGet(proto, [](BC7215* d) { d->getRaw(target.data, sizeof(target.data)); }), "ns");
+        }
+    }
+    for (int wrap = 0; wrap < 2; wrap++)
+    {
+        // data packet of 12 bytes (15 stored) is followed by the format packet
+        BC7215* proto = primedDriver(12, wrap ? BC7215_BUFFER_SIZE - 15 - 16 : 1, true);
+        report(wrap ? "getFormat_wrap" : "getFormat_flat", timeGet(proto, [](BC7215* d) { d->getFormat(format); }), "ns");
+    }
+}
+
+static void benchCompare()
+{
+    static const uint16_t sizes[] = { 12, BC7215_MAX_RX_DATA_SIZE };
+    static bc7215DataMaxPkt_t pkt1, pkt2;
+    char                      name[48];
+    volatile bool             result;
+
+    for (uint16_t size : sizes)
+    {
+        for (int msb = 0; msb < 2; msb++)
+        {
+            // 3 padding bits in the last byte, different in the two packets which are still equal
+            fillClean(pkt1.data, size);
+            memcpy(pkt2.data, pkt1.data, size);
+            pkt1.bitLen = pkt2.bitLen = size * 8 - 3;
+            pkt1.data[size - 1] ^= msb ? 0x80 : 0x04;
+            pkt2.data[size - 1] ^= msb ? 0x40 : 0x02;
+            if (!BC7215::compareDpkt(msb ? 0x34 : 0x21, pkt1, pkt2))
+            {
+                fprintf(stderr, "compareDpkt failed\n");
+                exit(1);
+            }
+            snprintf(name, sizeof(name), "compareDpkt_%u_%s", size, msb ? "msb" : "lsb");
+            report(name, timeCall([&]() { result = BC7215::compareDpkt(msb ? 0x34 : 0x21, pkt1, pkt2); }), "ns");
+        }
+    }
+    (void)result;
+}
+
+static void benchCrc()
+{
+    static const uint16_t sizes[] = { 33, BC7215_MAX_RX_DATA_SIZE };
+    static uint8_t        data[BC7215_MAX_RX_DATA_SIZE];
+    char                  name[48];
+    volatile uint8_t      crc;
+
+    fillClean(data, sizeof(data));
+    for (uint16_t size : sizes)
+    {
+        snprintf(name, sizeof(name), "crc8_%u", size);
+        report(name, timeCall([&]() { crc = BC7215::crc8(data, size); }), "ns");
+    }
+    (void)crc;
+}
+
+int main()
+{
+#if BC7215_FLOOD_GUARD == 1
+    checkFlood();
+#endif
+    benchRx("rx_clean", false);
+    benchRx("rx_escapes", true);
+    benchTx("tx_clean", false);
+    benchTx("tx_escapes", true);
+    benchGet();
+    benchCompare();
+    benchCrc();
+    return 0;
+}
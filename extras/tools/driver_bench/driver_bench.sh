@@ -0,0 +1,40 @@
+#!/bin/sh
+#
+# driver_bench.sh
+#
+# Description: Builds and runs the host benchmark of the BC7215 driver (driver_bench.cpp with
+# src/bc7215.cpp and the minimal Arduino headers in this directory), prints every result next
+# to the previous run made on the same host with the same compiler, and appends the results to
+# a history file so the per-byte paths of the driver can be tracked from commit to commit, e.g.
+#     extras/tools/driver_bench/driver_bench.sh
+#     CXX=clang++ CXXFLAGS=-O3 extras/tools/driver_bench/driver_bench.sh
+# The history (see ../bench_history.sh) is kept outside the tree, set HISTORY to use another
+# history file, or HISTORY=/dev/null to keep none.
+# Requires a C++11 compiler, awk, and git for the commit id.
+#
+# Author: Bitcode
+# Date: 2026-10-18
+#
+
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:--O2}
+
+BENCH_DIR=$(cd "$(dirname "$0")" && pwd)
+SRC_DIR=$(cd "$BENCH_DIR/../../../src" && pwd)
+. "$BENCH_DIR/../bench_history.sh"
+bench_history_file driver_bench
+WORK_DIR=$(mktemp -d)
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+$CXX $CXXFLAGS -std=c++11 -w -I"$BENCH_DIR" -I"$SRC_DIR" \
+    "$BENCH_DIR/driver_bench.cpp" "$SRC_DIR/bc7215.cpp" -o "$WORK_DIR/driver_bench" || exit 1
+"$WORK_DIR/driver_bench" > "$WORK_DIR/results.txt" || exit 1
+
+bench_commit "$SRC_DIR"
+HOST=$(uname -n)
+COMPILER="$CXX $CXXFLAGS"
+
+echo "BC7215 driver benchmark, $COMMIT on $HOST ($COMPILER)"
+echo
+bench_compare "$WORK_DIR/results.txt" percent "$HOST" "$COMPILER"
+bench_append "$WORK_DIR/results.txt" "$HOST" "$COMPILER"
@@ -0,0 +1,74 @@
+#!/bin/sh
+#
+# iram_report.sh
+#
+# Description: Fast RAM cost of the hot-path placement (BC7215_HOT_PLACEMENT in bc7215_lib_config.h),
+# every function and table placed by BC7215_HOT_CODE / BC7215_HOT_DATA with its size, and the totals.
+# Without arguments the driver (bc7215.cpp) and the A/C library (bc7215_ac_lib.c) are compiled with
+# the placement enabled into a marker section, run it with the cross compiler of the target for
+# its figures, e.g.
+#     CC=xtensa-esp32-elf-gcc CXX=xtensa-esp32-elf-g++ CFLAGS=-Os extras/tools/iram_report.sh
+# With arguments, the given object files, or all bc7215 objects under the given directories (e.g.
+# the build path of an Arduino build with BC7215_HOT_PLACEMENT 1), are read instead and the sizes
+# of the library symbols in IRAM/DRAM/ITCM/DTCM sections (or SECTIONS, an awk regex) are reported,
+#     OBJDUMP=xtensa-esp32-elf-objdump extras/tools/iram_report.sh /tmp/arduino/sketches/XXXX
+# Requires gcc/g++ (or CC/CXX), objdump and awk.
+#
+# Author: Bitcode
+# Date: 2026-10-18
+#
+
+CC=${CC:-gcc}
+CXX=${CXX:-$(echo "$CC" | sed 's/gcc$/g++/')}
+CFLAGS=${CFLAGS:--Os}
+OBJDUMP=${OBJDUMP:-$(echo "$CC" | sed 's/gcc$/objdump/')}
+
+TOOL_DIR=$(cd "$(dirname "$0")" && pwd)
+SRC_DIR=$(cd "$TOOL_DIR/../../src" && pwd)
+WORK_DIR=$(mktemp -d)
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+if [ $# -eq 0 ]; then
+    SECTIONS=${SECTIONS:-'^\.bc7215_hot'}
+    cp "$SRC_DIR"/*.h "$SRC_DIR"/bc7215.cpp "$SRC_DIR"/bc7215_ac_lib.c "$WORK_DIR"/
+    sed -i 's/^#define BC7215_HOT_PLACEMENT .*/#define BC7215_HOT_PLACEMENT 1\n#define BC7215_HOT_SECTION ".bc7215_hot.text"\n#define BC7215_HOT_DATA_SECTION ".bc7215_hot.data"/' \
+        "$WORK_DIR/bc7215_lib_config.h"
+    # minimal Arduino headers of the driver benchmark, the driver only needs Stream and pin functions
+    $CXX $CFLAGS -std=c++11 -w -I"$WORK_DIR" -I"$TOOL_DIR/driver_bench" -c "$WORK_DIR/bc7215.cpp" -o "$WORK_DIR/bc7215.o" || exit 1
+    $CC $CFLAGS -std=gnu99 -w -I"$WORK_DIR" -c "$WORK_DIR/bc7215_ac_lib.c" -o "$WORK_DIR/bc7215_ac_lib.o" || exit 1
+    OBJECTS="$WORK_DIR/bc7215.o $WORK_DIR/bc7215_ac_lib.o"
+    echo "BC7215 hot-path placement cost ($CC $CFLAGS)"
+else
+    SECTIONS=${SECTIONS:-'^\.(iram|dram|itcm|dtcm)'}
+    OBJECTS=$(find "$@" -name 'bc7215*.o' 2> /dev/null)
+    if [ -z "$OBJECTS" ]; then
+        echo "no bc7215 object files found in $*"
+        exit 1
+    fi
+    echo "BC7215 hot-path placement cost ($OBJDUMP)"
+fi
+echo
+
+FILT=$(command -v c++filt || echo cat)
+for obj in $OBJECTS; do
+    "$OBJDUMP" -t "$obj" || exit 1
+done | awk -v sections="$SECTIONS" '
+function hex(s,    i, v)
+{
+    v = 0;
+    for (i = 1; i <= length(s); i++)
+    {
+        v = v * 16 + index("0123456789abcdef", substr(s, i, 1)) - 1;
+    }
+    return v;
+}
+# symbol table lines: address flags section size name
+(NF >= 5) && ($(NF - 2) ~ sections) && ($(NF - 1) ~ /^[0-9a-f]+$/) && (hex($(NF - 1)) != 0) {
+    size = hex($(NF - 1));
+    kind = ($(NF - 2) ~ /data|dram|dtcm/) ? "data" : "code";
+    total[kind] += size;
+    printf("%-6s %6d  %s\n", kind, size, $NF);
+}
+END {
+    printf("total  code %d bytes, data %d bytes\n", total["code"], total["data"]);
+}' | "$FILT" | sort -k1,1 -k2,2nr | awk '/^total/ { last = $0; next } { print } END { print ""; sub(/^total  /, "", last); print last }'
@@ -0,0 +1,34 @@
+// Minimal Arduino API for running the BC7215 A/C stack on a PC in virtual time, only what the
+// library uses. millis() and micros() read benchMicros, which only the bench and delay() advance,
+// so every run gives the same figures. Pins are not simulated: digitalRead() always returns LOW.
+// Print and Stream come from ../driver_bench/Stream.h.
+
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HIGH   1
+#define LOW    0
+#define INPUT  0
+#define OUTPUT 1
+
+typedef uint8_t byte;
+
+extern unsigned long long benchMicros;
+
+inline void          pinMode(int, int) {}
+inline void          digitalWrite(int, int) {}
+inline int           digitalRead(int) { return LOW; }
+inline unsigned long millis() { return (unsigned long)(benchMicros / 1000); }
+inline unsigned long micros() { return (unsigned long)benchMicros; }
+inline void          delay(unsigned long ms) { benchMicros += ms * 1000ULL; }
+inline void          yield() {}
+
+#include "Stream.h"
+
+#endif
@@ -0,0 +1,424 @@
+/*
+ * latency_bench.cpp
+ *
+ * Description: End-to-end command latency of the Home Assistant stack (BC7215ACBridge, BC7215AC,
+ * the A/C library and the BC7215 driver), run by latency_bench.sh. Everything runs in virtual
+ * time on a PC, so a run gives the same figures on any host:
+ *   - a local broker stand-in delivers the command messages of a scenario to the bridges of
+ *     ROOMS rooms, BROKER_DELAY_US after they are published
+ *   - every room runs the loop of a sketch every LOOP_US: messages in, bridge.send(), bridge.poll()
+ *   - a BC7215 emulator per room takes the UART bytes at 19200 baud 8N2, destuffs the format and
+ *     data commands, "sends" the IR frame once the data command is in and answers 0x7a on the
+ *     UART after the last bit. Frames are timed as NEC like PWM frames (9ms + 4.5ms leader,
+ *     0.56ms marks, 0.56ms / 1.69ms spaces, 0.56ms trailer): the timing bytes of a format packet
+ *     are not documented, the real frames of most A/C protocols are within 20% of this.
+ * The latency of a message is the time from its delivery to the bridge to the last IR bit of
+ * the frame which carries it. The time the MCU spends encoding is not counted.
+ * Scenarios:
+ *   single      one temperature change at a time, room 0
+ *   slider      temperature slider dragged 18 -> 28 -> 18, a message every 40ms, room 0
+ *   scene       scenes for all rooms at once: off, then cool / 24 / high fan (ON frame + setting)
+ *   reconnect   after a reconnection the broker delivers a backlog of 12 messages per room in 12ms
+ * For every scenario: messages, IR frames, state messages published, messages coalesced into a
+ * frame carrying others, messages changing nothing (noop), messages not sent at all (dropped),
+ * and the 50/90/99th percentile and maximum of the latency.
+ * Then the cost profile of room 0 (BC7215AC::costProfile()): longest command written to BC7215,
+ * its UART time and the IR airtime measured through isBusy().
+ * Each result is printed as "name value unit", one per line.
+ *
+ * Author: Bitcode
+ * Date: 2026-10-18
+ */
+
+#include <algorithm>
+#include <deque>
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "bc7215.h"
+#include "bc7215ac.h"
+#include "bc7215acbridge.h"
+
+unsigned long long benchMicros = 0;
+
+const int                ROOMS = 4;
+const unsigned long long LOOP_US = 1000;
+const unsigned long long BROKER_DELAY_US = 1000;
+const unsigned long long UART_BYTE_US = 11 * 1000000ULL / 19200;        // start, 8 data and 2 stop bits
+
+// BC7215 in transmit mode (MOD tied low, BUSY not connected) seen from its UART
+class ChipEmulator : public Stream
+{
+public:
+    std::deque<unsigned long long> frameEnds;        // last IR bit of the frames sent, for the bench
+    unsigned long long             lineFree = 0;     // end of the last byte on the host -> BC7215 line
+    unsigned long long             irEnd = 0;        // end of the last IR frame
+    std::deque<unsigned long long> replies;          // arrival of the 0x7a replies at the host
+
+    size_t write(uint8_t data)
+    {
+        lineFree = std::max(lineFree, benchMicros) + UART_BYTE_US;
+        parse(data);
+        return 1;
+    }
+    int available() { return (!replies.empty() && (replies.front() <= benchMicros)) ? 1 : 0; }
+    int read()
+    {
+        if (!available())
+        {
+            return -1;
+        }
+        replies.pop_front();
+        return 0x7a;
+    }
+    int peek() { return available() ? 0x7a : -1; }
+
+private:
+    enum {IDLE, COMMAND, FORMAT, BITLEN, DATA} state = IDLE;
+    bool     escaped = false;
+    uint8_t  command = 0;
+    uint16_t count = 0;
+    uint16_t bitLen = 0;
+    uint8_t  data[512];
+
+    void parse(uint8_t byte)
+    {
+        if (byte == 0x7b)
+        {
+            escaped = true;
+            return;
+        }
+        if (escaped)
+        {
+            byte &= 0x7f;
+            escaped = false;
+        }
+        switch (state)
+        {
+            case IDLE:
+                command = byte;
+                state = ((byte == 0xf5) || (byte == 0xf6)) ? COMMAND : IDLE;
+                break;
+            case COMMAND:
+                count = 0;
+                state = (command == 0xf6) ? FORMAT : BITLEN;
+                break;
+            case FORMAT:        // signature and 32 timing bytes, kept by the chip for the next frame
+                if (++count == 33)
+                {
+                    state = IDLE;
+                }
+                break;
+            case BITLEN:
+                if (count++ == 0)
+                {
+                    bitLen = byte;
+                }
+                else
+                {
+                    bitLen |= byte << 8;
+                    count = 0;
+                    state = ((bitLen + 7) / 8 == 0) ? IDLE : DATA;
+                }
+                break;
+            case DATA:
+                data[count++] = byte;
+                if (count == (bitLen + 7) / 8)
+                {
+                    sendFrame();
+                    state = IDLE;
+                }
+                break;
+        }
+    }
+
+    void sendFrame()
+    {
+        unsigned long long duration = 9000 + 4500 + 560;
+        for (uint16_t i = 0; i < bitLen; i++)
+        {
+            duration += 560 + (((data[i / 8] >> (i % 8)) & 1) ? 1690 : 560);
+        }
+        irEnd = std::max(lineFree, irEnd) + duration;
+        frameEnds.push_back(irEnd);
+        replies.push_back(irEnd + UART_BYTE_US);
+    }
+};
+
+// Broker stand-in: delivers the published commands in order, counts the state messages
+class Broker : public BC7215ACBridgeLink
+{
+public:
+    struct Message
+    {
+        unsigned long long time;        // delivery
+        int                room;
+        std::string        topic;
+        std::string        payload;
+    };
+    std::deque<Message> queue;
+    int                 stateMessages = 0;
+
+    void command(unsigned long long at, int room, const char* subTopic, const char* payload)
+    {
+        char topic[64];
+        snprintf(topic, sizeof(topic), "home/ac/room%d/%s/set", room, subTopic);
+        Message msg = {at + BROKER_DELAY_US, room, topic, payload};
+        auto    pos = std::upper_bound(queue.begin(), queue.end(), msg,
+            [](const Message& a, const Message& b) { return a.time < b.time; });
+        queue.insert(pos, msg);
+    }
+    bool publish(const char* topic, const char*, bool)
+    {
+        if (strstr(topic, "/state") != NULL)
+        {
+            stateMessages++;
+        }
+        return true;
+    }
+    bool subscribe(const char*) { return true; }
+};
+
+Broker broker;
+
+struct Room
+{
+    char                            base[24];        // before the bridge, which is given it when constructed
+    ChipEmulator                    uart;
+    BC7215                          chip;
+    BC7215AC                        ac;
+    BC7215ACBridge                  bridge;
+    std::vector<unsigned long long> waiting;        // delivery of the messages not sent yet
+    std::vector<unsigned long long> inFlight;       // delivery of the messages carried by the frame being sent
+
+    Room(int index) : chip(uart, BC7215::MOD_LOW, BC7215::BUSY_NC), ac(chip), bridge(ac, broker, makeBase(index)) {}
+    const char* makeBase(int index)
+    {
+        snprintf(base, sizeof(base), "home/ac/room%d", index);
+        return base;
+    }
+};
+
+Room* room[ROOMS];
+
+struct Stats
+{
+    int                             messages = 0;
+    int                             frames = 0;
+    int                             coalesced = 0;
+    int                             noop = 0;
+    std::vector<unsigned long long> latency;
+};
+
+// Run the loops of all rooms until 'until', or until nothing is left to do if 'until' is 0
+static void run(Stats& stats, unsigned long long until)
+{
+    while (true)
+    {
+        bool busy = !broker.queue.empty();
+        while (!broker.queue.empty() && (broker.queue.front().time <= benchMicros))
+        {
+            Broker::Message& msg = broker.queue.front();
+            Room*            r = room[msg.room];
+            bool             before = r->bridge.commandPending();
+            int              temp = r->bridge.temp(), mode = r->bridge.mode(), fan = r->bridge.fan();
+            bool             power = r->bridge.power();
+
+            r->bridge.received(msg.topic.c_str(), (const uint8_t*)msg.payload.data(), msg.payload.size());
+            stats.messages++;
+            if ((temp == r->bridge.temp()) && (mode == r->bridge.mode()) && (fan == r->bridge.fan())
+                && (power == r->bridge.power()))
+            {
+                stats.noop++;
+            }
+            else
+            {
+                if (before && !r->waiting.empty())
+                {
+                    stats.coalesced++;
+                }
+                r->waiting.push_back(msg.time);
+            }
+            broker.queue.pop_front();
+        }
+        for (int i = 0; i < ROOMS; i++)
+        {
+            Room* r = room[i];
+            while (!r->uart.frameEnds.empty() && (r->uart.frameEnds.front() <= benchMicros))
+            {
+                unsigned long long end = r->uart.frameEnds.front();
+                r->uart.frameEnds.pop_front();
+                if (r->uart.frameEnds.empty() && !(r->bridge.commandPending() && r->waiting.empty()))
+                {
+                    for (unsigned long long delivered : r->inFlight)        // carried by this frame
+                    {
+                        stats.latency.push_back(end - delivered);
+                    }
+                    r->inFlight.clear();
+                }
+            }
+            if (r->bridge.send())
+            {
+                stats.frames++;
+                r->inFlight.insert(r->inFlight.end(), r->waiting.begin(), r->waiting.end());
+                r->waiting.clear();
+            }
+            if (!r->bridge.commandPending() && r->inFlight.empty())        // changes undone before being sent
+            {
+                for (unsigned long long delivered : r->waiting)
+                {
+                    stats.latency.push_back(benchMicros - delivered);
+                }
+                r->waiting.clear();
+            }
+            r->bridge.poll();
+            busy = busy || r->bridge.commandPending() || !r->inFlight.empty() || r->ac.isBusy();
+        }
+        if ((until != 0) ? (benchMicros >= until) : !busy)
+        {
+            return;
+        }
+        benchMicros += LOOP_US;
+    }
+}
+
+static void report(const char* scenario, const char* name, double value, const char* unit)
+{
+    printf("%s_%s %.2f %s\n", scenario, name, value, unit);
+}
+
+static void scenario(const char* name, void (*publish)(unsigned long long start))
+{
+    Stats stats;
+    int   dropped;
+    int   published = broker.stateMessages;
+
+    run(stats, benchMicros + 5000000);        // settle, state messages of the previous scenario out
+    published = broker.stateMessages;
+    publish(benchMicros);
+    run(stats, 0);
+    run(stats, benchMicros + 5000000);
+    dropped = stats.messages - stats.noop - (int)stats.latency.size();
+    std::sort(stats.latency.begin(), stats.latency.end());
+    report(name, "messages", stats.messages, "msgs");
+    report(name, "frames", stats.frames, "frames");
+    report(name, "state_msgs", broker.stateMessages - published, "msgs");
+    report(name, "coalesced", stats.coalesced, "msgs");
+    report(name, "noop", stats.noop, "msgs");
+    report(name, "dropped", dropped, "msgs");
+    if (!stats.latency.empty())
+    {
+        const double p[] = {50, 90, 99};
+        const char*  pName[] = {"p50", "p90", "p99"};
+        for (int i = 0; i < 3; i++)
+        {
+            size_t k = (size_t)(p[i] / 100 * (stats.latency.size() - 1) + 0.5);
+            report(name, pName[i], stats.latency[k] / 1000.0, "ms");
+        }
+        report(name, "max", stats.latency.back() / 1000.0, "ms");
+    }
+}
+
+static void single(unsigned long long start)
+{
+    char temp[8];
+    for (int i = 0; i < 20; i++)
+    {
+        snprintf(temp, sizeof(temp), "%d", 18 + (i % 2) * 6 + i % 5);
+        broker.command(start + i * 2000000ULL, 0, "temperature", temp);
+    }
+}
+
+static void slider(unsigned long long start)
+{
+    char temp[8];
+    int  n = 0;
+    for (int drag = 0; drag < 3; drag++)
+    {
+        for (int t = 18; t <= 28; t++)
+        {
+            snprintf(temp, sizeof(temp), "%d", t);
+            broker.command(start + n++ * 40000ULL, 0, "temperature", temp);
+        }
+        for (int t = 27; t >= 18; t--)
+        {
+            snprintf(temp, sizeof(temp), "%d", t);
+            broker.command(start + n++ * 40000ULL, 0, "temperature", temp);
+        }
+        n += 50;        // 2s between drags
+    }
+}
+
+static void scene(unsigned long long start)
+{
+    for (int i = 0; i < 10; i++)
+    {
+        unsigned long long at = start + i * 3000000ULL;
+        for (int r = 0; r < ROOMS; r++)
+        {
+            if (i % 2 == 0)
+            {
+                broker.command(at, r, "mode", "off");
+            }
+            else
+            {
+                broker.command(at, r, "mode", "cool");
+                broker.command(at, r, "temperature", (i % 4 == 1) ? "24" : "22");
+                broker.command(at, r, "fan", (i % 4 == 1) ? "high" : "low");
+            }
+        }
+    }
+}
+
+static void reconnect(unsigned long long start)
+{
+    static const char* const MODES[] = {"auto", "cool", "heat", "dry"};
+    static const char* const FANS[] = {"auto", "low", "medium", "high"};
+    char                     temp[8];
+    for (int i = 0; i < 5; i++)
+    {
+        unsigned long long at = start + i * 4000000ULL;
+        for (int k = 0; k < 12; k++)
+        {
+            for (int r = 0; r < ROOMS; r++)
+            {
+                switch (k % 3)
+                {
+                    case 0:
+                        snprintf(temp, sizeof(temp), "%d", 20 + (k + i + r) % 8);
+                        broker.command(at + k * 1000, r, "temperature", temp);
+                        break;
+                    case 1:
+                        broker.command(at + k * 1000, r, "mode", MODES[(k + i) % 4]);
+                        break;
+                    default:
+                        broker.command(at + k * 1000, r, "fan", FANS[(k + r) % 4]);
+                        break;
+                }
+            }
+        }
+    }
+}
+
+int main()
+{
+    for (int i = 0; i < ROOMS; i++)
+    {
+        room[i] = new Room(i);
+        if (!room[i]->ac.initPredef(0))
+        {
+            fprintf(stderr, "room %d: no predefined protocol\n", i);
+            return 1;
+        }
+        room[i]->bridge.online();
+    }
+    scenario("single", single);
+    scenario("slider", slider);
+    scenario("scene", scene);
+    scenario("reconnect", reconnect);
+    BC7215ACCost cost = room[0]->ac.costProfile();        // encoding takes no virtual time
+    printf("cost_frame_bytes %d bytes\n", cost.frameBytes);
+    printf("cost_uart %d ms\n", cost.uartMs);
+    printf("cost_airtime %d ms\n", cost.airtimeMs);
+    return 0;
+}
@@ -0,0 +1,44 @@
+#!/bin/sh
+#
+# latency_bench.sh
+#
+# Description: Builds and runs the end-to-end command latency bench (latency_bench.cpp with the
+# sources in src/ and the Arduino headers of this directory and of ../driver_bench), prints every
+# result next to the previous run and appends the results to a history file, so every release can
+# be judged on the latency from a Home Assistant command to the last bit of its IR frame, e.g.
+#     extras/tools/latency_bench/latency_bench.sh
+# The bench runs in virtual time, its figures only change with the code, not with the host or the
+# compiler. The history (see ../bench_history.sh) is kept outside the tree, set HISTORY to use
+# another history file, or HISTORY=/dev/null to keep none.
+# Requires a C++11 and a C compiler, awk, and git for the commit id.
+#
+# Author: Bitcode
+# Date: 2026-10-18
+#
+
+CC=${CC:-gcc}
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:--O2}
+
+BENCH_DIR=$(cd "$(dirname "$0")" && pwd)
+SRC_DIR=$(cd "$BENCH_DIR/../../../src" && pwd)
+. "$BENCH_DIR/../bench_history.sh"
+bench_history_file latency_bench
+WORK_DIR=$(mktemp -d)
+trap 'rm -rf "$WORK_DIR"' EXIT
+INCLUDES="-I$BENCH_DIR -I$BENCH_DIR/../driver_bench -I$SRC_DIR"
+
+$CC $CXXFLAGS $INCLUDES -c "$SRC_DIR/bc7215_ac_lib.c" -o "$WORK_DIR/bc7215_ac_lib.o" || exit 1
+$CXX $CXXFLAGS -std=c++11 $INCLUDES "$BENCH_DIR/latency_bench.cpp" "$SRC_DIR/bc7215.cpp" \
+    "$SRC_DIR/bc7215ac.cpp" "$SRC_DIR/bc7215acbridge.cpp" "$SRC_DIR/bc7215diversity.cpp" \
+    "$SRC_DIR/bc7215power.cpp" "$WORK_DIR/bc7215_ac_lib.o" -o "$WORK_DIR/latency_bench" || exit 1
+"$WORK_DIR/latency_bench" > "$WORK_DIR/results.txt" || exit 1
+
+bench_commit "$SRC_DIR"
+HOST=$(uname -n)
+COMPILER="$CXX $CXXFLAGS"
+
+echo "BC7215 A/C command latency bench, $COMMIT"
+echo
+bench_compare "$WORK_DIR/results.txt" delta
+bench_append "$WORK_DIR/results.txt" "$HOST" "$COMPILER"
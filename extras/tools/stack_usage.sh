@@ -0,0 +1,140 @@
+#!/bin/sh
+#
+# stack_usage.sh
+#
+# Description: Host side stack & RAM budget of the A/C control library (bc7215_ac_lib.c).
+# The library is compiled with -fstack-usage -fcallgraph-info=su, the worst call chain below
+# every public bc7215_ac_*() function is summed from the frame sizes, and the static RAM of
+# the library (.data + .bss) is printed.
+# Calls through function pointers are counted as the largest frame of a function which is
+# never called directly (the value operators and protocol callbacks of the library).
+# Figures depend on the compiler and the CPU, run it with the cross compiler of the target
+# for numbers to size a task with, e.g.
+#     CC=xtensa-esp32-elf-gcc extras/tools/stack_usage.sh
+#     CC=avr-gcc CFLAGS="-Os -mmcu=atmega328p" extras/tools/stack_usage.sh
+# examples/stack_budget measures the same functions on the device by stack painting.
+# Requires gcc 10 or newer (or the same version of a cross gcc) and awk.
+#
+# Author: Bitcode
+# Date: 2026-10-18
+#
+
+CC=${CC:-gcc}
+CFLAGS=${CFLAGS:--Os}
+SIZE=${SIZE:-$(echo "$CC" | sed 's/gcc$/size/')}
+
+SRC_DIR=$(cd "$(dirname "$0")/../../src" && pwd)
+WORK_DIR=$(mktemp -d)
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+$CC $CFLAGS -std=gnu99 -I"$SRC_DIR" -fstack-usage -fcallgraph-info=su \
+    -c "$SRC_DIR/bc7215_ac_lib.c" -o "$WORK_DIR/bc7215_ac_lib.o" || exit 1
+
+echo "BC7215 A/C library stack & RAM budget ($CC $CFLAGS)"
+echo
+awk '
+/^node:/ {
+    if (match($0, /title: "[^"]*"/))
+    {
+        name = substr($0, RSTART + 8, RLENGTH - 9);
+        sub(/.*:/, "", name);
+        frame[name] = 0;
+        if (match($0, /\\n[0-9]+ bytes/))
+        {
+            frame[name] = substr($0, RSTART + 2, RLENGTH - 8) + 0;
+        }
+        if (match($0, /bytes \(dynamic/))
+        {
+            dynamic[name] = 1;
+        }
+    }
+}
+/^edge:/ {
+    match($0, /sourcename: "[^"]*"/);
+    from = substr($0, RSTART + 13, RLENGTH - 14);
+    sub(/.*:/, "", from);
+    match($0, /targetname: "[^"]*"/);
+    to = substr($0, RSTART + 13, RLENGTH - 14);
+    sub(/.*:/, "", to);
+    if (!((from, to) in seen))
+    {
+        seen[from, to] = 1;
+        calls[from] = calls[from] " " to;
+        if (to != "__indirect_call")
+        {
+            called[to] = 1;
+        }
+    }
+}
+# depth of the worst chain below fn, lower[fn] is set if the chain recurses or has a dynamic frame,
+# memoized together so that every root reaching fn later gets the flag too
+function depth(fn,    n, i, list, d, best)
+{
+    if (fn in memo)
+    {
+        return memo[fn];
+    }
+    if (fn in visiting)             # recursion, only counted once
+    {
+        return -1;
+    }
+    visiting[fn] = 1;
+    best = 0;
+    if (fn in dynamic)
+    {
+        lower[fn] = 1;
+    }
+    n = split(calls[fn], list, " ");
+    for (i = 1; i <= n; i++)
+    {
+        d = (list[i] == "__indirect_call") ? indirect : depth(list[i]);
+        if (d < 0)
+        {
+            lower[fn] = 1;
+            d = 0;
+        }
+        else if (list[i] in lower)
+        {
+            lower[fn] = 1;
+        }
+        if (d > best)
+        {
+            best = d;
+        }
+    }
+    delete visiting[fn];
+    memo[fn] = frame[fn] + best;
+    return memo[fn];
+}
+END {
+    indirect = 0;
+    for (fn in frame)
+    {
+        if (!(fn in called) && (fn !~ /^bc7215_ac_/) && (frame[fn] > indirect))
+        {
+            indirect = frame[fn];
+        }
+    }
+    printf("%-32s %8s %10s\n", "Function", "frame", "worst case");
+    for (fn in frame)
+    {
+        if (fn ~ /^bc7215_ac_/)
+        {
+            d = depth(fn);
+            printf("%-32s %8d %10d%s\n", fn, frame[fn], d, (fn in lower) ? "  (lower bound)" : "") | "sort";
+        }
+    }
+    close("sort");
+    printf("\nindirect calls counted as %d bytes\n", indirect);
+}
+' "$WORK_DIR"/*.ci
+
+echo
+if command -v "$SIZE" > /dev/null 2>&1; then
+    "$SIZE" -A "$WORK_DIR/bc7215_ac_lib.o" | awk '
+        $1 ~ /^\.data\.rel\.ro/ { next }                  # constant tables, flash on the target
+        $1 ~ /^\.data/ || $1 ~ /^\.bss/ { ram += $2 }
+        END { printf("static RAM of bc7215_ac_lib.c (.data + .bss): %d bytes\n", ram) }'
+else
+    echo "'$SIZE' not found, set SIZE to print the static RAM"
+fi
@@ -1,5 +1,6 @@
 
 #include "bc7215.h"
+#include "bc7215_hot.h"
 
 BC7215::BC7215(Stream& SerialPort, int ModPin, int BusyPin) : uart(SerialPort), modPin(ModPin), busyPin(BusyPin)
 {
@@ -37,6 +38,7 @@ void BC7215::setTx()
 
 void BC7215::setRx()
 {
+	uart.flush();		// commands still in the UART transmit buffer must reach BC7215 in transmit mode
 	if (modPin >= 0)
 	{
 		digitalWrite(modPin, HIGH);
@@ -61,6 +63,10 @@ void BC7215::setRxMode(uint8_t mode)
 	}
 }
 
+bool BC7215::isTxMode() { return (modPin == -2) || ((modPin >= 0) && (digitalRead(modPin) == LOW)); }
+
+bool BC7215::hasModPin() { return modPin >= 0; }
+
 bool BC7215::isBusy()
 {
 	statusUpdate();
@@ -164,6 +170,61 @@ uint16_t BC7215::getRaw(void* addr, uint16_t size)
 	return size;
 }
 
+#	if BC7215_FLOOD_GUARD == 1
+
+bool BC7215::isFlooded()
+{
+	statusUpdate();
+	if (bc7215Status.flooded && (millis() - floodWindowStart >= 2 * BC7215_FLOOD_WINDOW))
+	{
+		bc7215Status.flooded = 0;		// a whole window passed without any packet
+	}
+	return bc7215Status.flooded;
+}
+
+void BC7215::setFloodFilter(uint16_t minBits)
+{
+	floodMinBits = minBits;
+}
+
+bool BC7215_HOT_CODE BC7215::floodCheck(bool wellFormed)
+{
+	bool bad = !wellFormed || (curPktInfo.bitLen < floodMinBits);
+
+	bc7215Status.lastBad = bad;
+	bc7215Status.floodPending = 1;
+	return wellFormed && !(bc7215Status.flooded && bad);
+}
+
+void BC7215_HOT_CODE BC7215::floodCount()
+{
+	uint32_t now = millis();
+
+	bc7215Status.floodPending = 0;
+	if (now - floodWindowStart >= BC7215_FLOOD_WINDOW)		// window over, its packets decide the state of the next one
+	{
+		bc7215Status.flooded = (now - floodWindowStart < 2 * BC7215_FLOOD_WINDOW) && (floodPkts >= BC7215_FLOOD_PACKETS)
+			&& ((uint16_t)floodBad * 100 >= (uint16_t)floodPkts * BC7215_FLOOD_BAD_PERCENT);
+		floodWindowStart = now;
+		floodPkts = 0;
+		floodBad = 0;
+	}
+	if (floodPkts < 255)
+	{
+		floodPkts++;
+		if (bc7215Status.lastBad)
+		{
+			floodBad++;
+		}
+	}
+	if ((floodPkts >= BC7215_FLOOD_PACKETS) && ((uint16_t)floodBad * 100 >= (uint16_t)floodPkts * BC7215_FLOOD_BAD_PERCENT))
+	{
+		bc7215Status.flooded = 1;		// enter the flood state at once, leave it only at the end of a window
+	}
+}
+
+#	endif
+
 #	if ENABLE_FORMAT == 1
 	
 bool BC7215::formatReady()
@@ -200,9 +261,9 @@ uint8_t BC7215::getFormat(bc7215FormatPkt_t& target)
 #	endif
 
 #if BC7215_BUFFER_SIZE > 255
-	uint8_t BC7215::bufBackRead(uint16_t pos, uint16_t n)
+	uint8_t BC7215_HOT_CODE BC7215::bufBackRead(uint16_t pos, uint16_t n)
 #else
-	uint8_t BC7215::bufBackRead(uint8_t pos, uint8_t n)
+	uint8_t BC7215_HOT_CODE BC7215::bufBackRead(uint8_t pos, uint8_t n)
 #endif
 {
     if (pos >= n)
@@ -216,9 +277,9 @@ uint8_t BC7215::getFormat(bc7215FormatPkt_t& target)
 }
 
 #if BC7215_BUFFER_SIZE > 255
-	uint8_t BC7215::bufRead(uint16_t pos, uint16_t n)
+	uint8_t BC7215_HOT_CODE BC7215::bufRead(uint16_t pos, uint16_t n)
 #else
-	uint8_t BC7215::bufRead(uint8_t pos, uint8_t n)
+	uint8_t BC7215_HOT_CODE BC7215::bufRead(uint8_t pos, uint8_t n)
 #endif
 {
     if (pos + n >= BC7215_BUFFER_SIZE)
@@ -237,37 +298,33 @@ uint8_t BC7215::getFormat(bc7215FormatPkt_t& target)
 
 void BC7215::loadFormat(const bc7215FormatPkt_t& source)
 {
-    uint8_t i;
     if ((modPin == -2) || ((modPin >= 0) && (digitalRead(modPin) == LOW)))	// if MOD is LOW (bc7215 is in transmit mode)
     {
-        sendOneByte(0xf6);
-        sendOneByte(0x01);
-		byteStuffingSend(source.signature.inByte);
-        for (i = 0; i < 32; i++)
-        {
-            byteStuffingSend(source.format[i]);
-        }
+        sendFormatCmd(source);
     }
 }
 
 void BC7215::irTx(const bc7215DataVarPkt_t* source)
 {
-    uint16_t i;
-    uint16_t bytes;
     if ((modPin == -2) || ((modPin >= 0) && (digitalRead(modPin) == LOW)))       // check if bc7215 is in trasmitting mode
     {
     	if ((source->bitLen >= 8) && (source->bitLen < 0x1000)) 
 		{
 		    bc7215Status.cmdComplete = 0;
-		    sendOneByte(0xf5);
-		    sendOneByte(0x02);
-			byteStuffingSend(source->bitLen&0xff);
-			byteStuffingSend(source->bitLen>>8);
-		    bytes = (source->bitLen + 7) / 8;        // set bytes = total number of data bytes +2
-		    for (i = 0; i < bytes; i++)                                       // send from 2nd byte of the data packet
-		    {
-		        byteStuffingSend(source->data[i]);
-		    }
+		    sendDataCmd(source->bitLen, source->data);
+		}
+    }
+}
+
+void BC7215::irTx(const bc7215FormatPkt_t& format, const bc7215DataVarPkt_t* source)
+{
+    if ((modPin == -2) || ((modPin >= 0) && (digitalRead(modPin) == LOW)))
+    {
+    	if ((source->bitLen >= 8) && (source->bitLen < 0x1000)) 
+		{
+		    bc7215Status.cmdComplete = 0;
+		    sendFormatCmd(format);        // both commands go out in one burst, no wait in between
+		    sendDataCmd(source->bitLen, source->data);
 		}
     }
 }
@@ -279,24 +336,32 @@ void BC7215::irTx(const bc7215DataMaxPkt_t& source)
 
 void BC7215::sendRaw(const void* source, uint16_t size)
 {
-    uint16_t i;
     if ((modPin == -2) || ((modPin >= 0) && (digitalRead(modPin) == LOW)))
     {
     	if (size < 0x200)
     	{
 		    bc7215Status.cmdComplete = 0;
-		    sendOneByte(0xf5);
-		    sendOneByte(0x02);
-		    byteStuffingSend((size * 8) & 0xff);        // send bit length of the data
-		    byteStuffingSend((size * 8) >> 8);
-		    for (i = 0; i < size; i++)
-		    {
-		        byteStuffingSend(*((uint8_t*)source + i));
-		    }
+		    sendDataCmd(size * 8, static_cast<const uint8_t*>(source));
 		}
     }
 }
 
+void BC7215::sendFormatCmd(const bc7215FormatPkt_t& source)
+{
+	static const uint8_t cmd[] = { 0xf6, 0x01 };
+	sendStuffed(cmd, sizeof(cmd), &source.signature.inByte, 33);		// signature and format[] are contiguous
+}
+
+void BC7215::sendDataCmd(uint16_t bitLen, const uint8_t* data)
+{
+	uint8_t cmd[4];
+	cmd[0] = 0xf5;
+	cmd[1] = 0x02;
+	cmd[2] = bitLen & 0xff;
+	cmd[3] = bitLen >> 8;
+	sendStuffed(cmd, sizeof(cmd), data, (bitLen + 7) / 8);
+}
+
 #endif
 
 bool BC7215::cmdCompleted()
@@ -327,7 +392,7 @@ void BC7215::clrNOCA(bc7215FormatPkt_t& formatPkt)
 	formatPkt.signature.bits.noCA = 0;
 }
 
-uint8_t BC7215::crc8(const void* data, uint16_t len)
+uint8_t BC7215_HOT_CODE BC7215::crc8(const void* data, uint16_t len)
 {
     uint16_t i;
     uint8_t j;
@@ -454,7 +519,55 @@ bool BC7215::compareDpkt(uint8_t sig, const bc7215DataMaxPkt_t& pkt1, const bc72
 }
 
 
-void BC7215::byteStuffingSend(uint8_t data)
+void BC7215_HOT_CODE BC7215::sendStuffed(const uint8_t* head, uint8_t headLen, const uint8_t* body, uint16_t bodyLen)
+{
+	uint8_t  chunk[BC7215_TX_CHUNK_SIZE + 1];		// +1 for the 2nd byte of an escaped byte
+	uint8_t  count;
+	uint8_t  data;
+	uint16_t i;
+
+	if (busyPin != -3)		// BUSY paces every byte
+	{
+		for (i = 0; i < headLen; i++)
+		{
+			byteStuffingSend(head[i]);
+		}
+		for (i = 0; i < bodyLen; i++)
+		{
+			byteStuffingSend(body[i]);
+		}
+		return;
+	}
+	count = 0;
+	for (i = 0; i < headLen; i++)		// command bytes and bit length, at most 4
+	{
+		data = head[i];
+		if ((data == 0x7a) || (data == 0x7b))
+		{
+			chunk[count++] = 0x7b;
+			data |= 0x80;
+		}
+		chunk[count++] = data;
+	}
+	for (i = 0; i < bodyLen; i++)
+	{
+		data = body[i];
+		if ((data == 0x7a) || (data == 0x7b))
+		{
+			chunk[count++] = 0x7b;
+			data |= 0x80;
+		}
+		chunk[count++] = data;
+		if (count >= BC7215_TX_CHUNK_SIZE)
+		{
+			uart.write(chunk, count);
+			count = 0;
+		}
+	}
+	uart.write(chunk, count);
+}
+
+void BC7215_HOT_CODE BC7215::byteStuffingSend(uint8_t data)
 {
     if ((data == 0x7a) || (data == 0x7b))
     {
@@ -468,7 +581,7 @@ void BC7215::byteStuffingSend(uint8_t data)
 }
 
 
-void BC7215::sendOneByte(uint8_t data)
+void BC7215_HOT_CODE BC7215::sendOneByte(uint8_t data)
 {
 	if (busyPin != -3)	// if BUSY is connected to arduino
 	{
@@ -478,7 +591,7 @@ void BC7215::sendOneByte(uint8_t data)
 	uart.flush();
 }
 
-void BC7215::statusUpdate()
+void BC7215_HOT_CODE BC7215::statusUpdate()
 {
 	while (uart.available() > 0)
 	{
@@ -486,10 +599,9 @@ void BC7215::statusUpdate()
 	}
 }
 
-void BC7215::processData(uint8_t data)
+void BC7215_HOT_CODE BC7215::processData(uint8_t data)
 {
 #if ENABLE_RECEIVING == 1
-    static uint8_t previousData = 0;
     uint8_t        temp;
     uint16_t       temp16;
 #endif
@@ -513,8 +625,15 @@ void BC7215::processData(uint8_t data)
                 {
 					curPktInfo = prePktInfo;		// just received packet was a format packet, restore saved data packet info
                     bc7215Status.dataPktReady = 0;
+#    if BC7215_FLOOD_GUARD == 1
+                    bc7215Status.floodPending = 0;        // a format packet is not counted, its data packet was
+#    endif
 #    if ENABLE_FORMAT == 1
+#        if BC7215_FLOOD_GUARD == 1
+                    if ((byteCount == 33) && (curPktInfo.count != 0))        // check the packet size, and its data packet was not dropped
+#        else
                     if (byteCount == 33)        // check the packet size
+#        endif
                     {
                         bc7215Status.formatPktReady = 1;
                     }
@@ -535,11 +654,22 @@ void BC7215::processData(uint8_t data)
                         = ((uint16_t)bufBackRead(lastWritingPos, 0) << 8) | bufBackRead(lastWritingPos, 1);
                     /* get the bit count of the data packet */
 
+#    if BC7215_FLOOD_GUARD == 1
+                    if (floodCheck((curPktInfo.bitLen + 7) / 8 + 3 == byteCount))
+                    {
+                        bc7215Status.dataPktReady = 1;
+                    }
+                    else if (bc7215Status.flooded)
+                    {
+                        curPktInfo.count = 0;        // dropped, the packet stays invalid if a format packet follows
+                    }
+#    else
                     if ((curPktInfo.bitLen + 7) / 8 + 3
                         == byteCount) /* if the byte count of received packet is correct */
                     {
                         bc7215Status.dataPktReady = 1;
                     }
+#    endif
                 }
             }
             previousData = 0x7a;
@@ -550,6 +680,12 @@ void BC7215::processData(uint8_t data)
             if (!bc7215Status.pktStarted)        // if it's the start of a new packet
             {
                 bc7215Status.pktStarted = 1;        // clear new packet indicator
+#    if BC7215_FLOOD_GUARD == 1
+                if (bc7215Status.floodPending)        // the previous packet was not a format packet
+                {
+                    floodCount();
+                }
+#    endif
                 bc7215Status.overLap = 0;
                 byteCount = 0;
                 bc7215Status.dataPktReady = 0;        // new data is coming, clear dataPktReady and formatPktReady flags
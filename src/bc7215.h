@@ -128,6 +128,19 @@ public:
 	 */
 	void setShutDown();
 
+	/**
+	 * Check if BC7215 is in transmit mode
+	 * @return true if MOD is low (driven by the MOD pin or tied to GND)
+	 */
+	bool isTxMode();
+
+	/**
+	 * Check if the MOD pin is driven by the host
+	 * Only then BC7215 can be switched between modes and woken up from shutdown mode
+	 * @return true if MOD is connected to a pin
+	 */
+	bool hasModPin();
+
 	/**
 	 * Check if BC7215 in busy receiving or sending
 	 * @return true if receiving started but 0x7a is not received yet, or sending is not completed
@@ -184,6 +197,25 @@ public:
 	 */
 	uint16_t getRaw(void* addr, uint16_t size);
 
+#	if BC7215_FLOOD_GUARD == 1
+
+	/**
+	 * Check if the receiver is flooded by IR noise
+	 * Flooded when at least BC7215_FLOOD_PACKETS packets arrive within BC7215_FLOOD_WINDOW ms and
+	 * BC7215_FLOOD_BAD_PERCENT of them are malformed or shorter than the flood filter. While flooded
+	 * such packets are dropped by the driver and never reported by dataReady()
+	 * @return true if the last window was flooded, false after a quiet window
+	 */
+	bool isFlooded();
+
+	/**
+	 * Set the minimum length of the packets accepted while flooded
+	 * @param minBits Packets with less bits are dropped while flooded (BC7215_FLOOD_MIN_BITS by default)
+	 */
+	void setFloodFilter(uint16_t minBits);
+
+#	endif
+
 #	if ENABLE_FORMAT == 1
 
 		// === Format Packet Functions ===
@@ -233,6 +265,14 @@ public:
 	 * @param source Reference to maximum-size data packet to transmit
 	 */
 	void irTx(const bc7215DataMaxPkt_t& source);
+
+	/**
+	 * Load format packet and transmit IR data packet in one UART burst
+	 * Same as loadFormat() then irTx(), but the commands are written back to back
+	 * @param format Reference to format packet containing protocol settings
+	 * @param source Pointer to variable-size data packet to transmit
+	 */
+	void irTx(const bc7215FormatPkt_t& format, const bc7215DataVarPkt_t* source);
 	
 	/**
 	 * Send raw data without packet structure
@@ -352,11 +392,35 @@ private:
 		uint8_t pktStarted : 1;      ///< Packet reception in progress
 		uint8_t overLap : 1;         ///< Buffer overlap condition detected
 		uint8_t cmdComplete : 1;     ///< Last command execution completed
+		uint8_t flooded : 1;         ///< Receiver flooded by IR noise
+		uint8_t lastBad : 1;         ///< Last packet found malformed by the flood guard
+		uint8_t floodPending : 1;    ///< Last packet not counted yet, it may be a format packet
 	} bc7215Status;
 
 #if ENABLE_RECEIVING == 1
 
 	uint8_t circularBuffer[BC7215_BUFFER_SIZE]; ///< Circular buffer for received data
+	uint8_t previousData = 0;                   ///< Last byte received, per chip as several chips may be polled in turn
+
+#	if BC7215_FLOOD_GUARD == 1
+	uint32_t floodWindowStart = 0;              ///< millis() at the start of the flood detection window
+	uint8_t  floodPkts = 0;                     ///< Packets received in the window
+	uint8_t  floodBad = 0;                      ///< Malformed or too short packets received in the window
+	uint16_t floodMinBits = BC7215_FLOOD_MIN_BITS; ///< Packets with less bits are dropped while flooded
+
+	/**
+	 * Check a completed packet against the flood state, it is counted later by floodCount()
+	 * @param wellFormed true if the length of the packet is right
+	 * @return true if the packet is accepted
+	 */
+	bool floodCheck(bool wellFormed);
+
+	/**
+	 * Count the last checked packet in the flood detection window, once the next byte shows it
+	 * was a data packet and not a format packet
+	 */
+	void floodCount();
+#	endif
 
 	// Buffer management variables (size depends on buffer size)
 #if BC7215_BUFFER_SIZE > 255
@@ -426,6 +490,28 @@ private:
 	 */
 	void processData(uint8_t data);
 	
+#if ENABLE_TRANSMITTING == 1
+	/**
+	 * Send a format download command (F6 01) without waiting for it to be sent
+	 * @param source Format packet to load
+	 */
+	void sendFormatCmd(const bc7215FormatPkt_t& source);
+
+	/**
+	 * Send a data command (F5 02) without waiting for it to be sent
+	 * @param bitLen Number of bits to transmit
+	 * @param data Data to transmit, (bitLen+7)/8 bytes
+	 */
+	void sendDataCmd(uint16_t bitLen, const uint8_t* data);
+#endif
+
+	/**
+	 * Send 'head' then 'body' with byte stuffing
+	 * Without BUSY the stuffed bytes are written to the UART in chunks and not flushed,
+	 * setRx() waits for them. With BUSY every byte waits for it as before
+	 */
+	void sendStuffed(const uint8_t* head, uint8_t headLen, const uint8_t* body, uint16_t bodyLen);
+
 	/**
 	 * Send byte with byte stuffing protocol
 	 * Implements escape sequences for special control bytes
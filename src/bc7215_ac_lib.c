@@ -1,4 +1,5 @@
 #include "bc7215_ac_lib.h"
+#include "bc7215_hot.h"
 #include <string.h>
 #define dieecgizrxee  0
 #define xclzxnzrkvdh   1
@@ -15,6 +16,8 @@ static void mfvmvvsrgpmq(uint8_t mekzztbhyjqh[][BC7215_MAX_RX_DATA_SIZE], bc7215
 static void musinwgvcyci(const struct vsghnouiwbyk* cssjkjaqtock);
 static uint8_t nnkrhrkeffev(uint8_t byte);
 static void ckbvbvcobbdk(const struct vsghnouiwbyk* cssjkjaqtock, bc7215DataVarPkt_t* ulvlopcjlbnz);
+static void cachePowerFrames(void);
+static void restoreBaseSegments(void);
 static bc7215DataMaxPkt_t	exhfmkybxmek;
 static bc7215DataMaxPkt_t	iukuxevqncnf;
 static bc7215DataMaxPkt_t	nheotrjqxqej;
@@ -39,17 +42,47 @@ static bool altProtocolUsing;
 static bool formatLoaded;
 static bool secFmtLoaded;
 static bool fahrenheitInit = false;
+static bool anyStateInit = false;           // captured at any setting, not at the calibration one (cool 25C / 78F)
 static bool pktLenChanged;
+#if BC7215_AC_CACHE_POWER_FRAMES == 1
+static bc7215DataMaxPkt_t	onDataPkt;
+static bc7215DataMaxPkt_t	offDataPkt;
+static bc7215FormatPkt_t	onFmtPkt;
+static bc7215FormatPkt_t	offFmtPkt;
+static bc7215CombinedMsg_t	onMsg;
+static bc7215CombinedMsg_t	offMsg;
+static const bc7215DataVarPkt_t* onResult;
+static const bc7215DataVarPkt_t* offResult;
+static bool onFrameReady;
+static bool offFrameReady;
+static bool onFromSegments;
+static bool offFromSegments;
+#endif
+static bool baseRestorePending;
+static const bc7215DataMaxPkt_t* encodeBase = &exhfmkybxmek;   // base data the frame being encoded is built on
+#if BC7215_AC_KEEP_BASE_SEGMENTS == 1
+typedef struct
+{
+    const struct vsghnouiwbyk* desc;                // descriptor the segments were extracted with, NULL = not extracted yet
+    bool lenChanged;                                // pktLenChanged of that extraction
+    uint8_t segments[4][BC7215_MAX_RX_DATA_SIZE];
+} baseSegments_t;
+static baseSegments_t baseSegs;
+static baseSegments_t secBaseSegs;
+static void loadBaseSegments(baseSegments_t* slot, const struct vsghnouiwbyk* desc, uint8_t status, const bc7215DataMaxPkt_t* pkt);
+#endif
+static void extractBase(void);
+static void dropBaseSegments(void);
 static uint8_t cdceqlsppczl = 25;
 static uint8_t nwafzsyodvlc = 78;
 int msg, pnum;
-static const uint8_t gtlmwdqemewe[8] = { 0xff, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f };
-static const uint8_t zcrduqdktess[8] = { 0xff, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe };
+static const uint8_t BC7215_HOT_DATA gtlmwdqemewe[8] = { 0xff, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f };
+static const uint8_t BC7215_HOT_DATA zcrduqdktess[8] = { 0xff, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe };
 static const uint8_t qblmsoegqftp[4] = { 0x03, 0x0c, 0x30, 0xc0 };
 static const uint8_t qrrxjwzecfmd[8] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80 };
-static const uint8_t lxlfwpcgkpnw[16] = { 0x00, 0x02, 0x01, 0x03, 0x08, 0x0a, 0x09, 0x0b, 0x04, 0x06, 0x05, 0x07, 0x0c, 0x0e, 0x0d, 0x0f };
-static const uint8_t tqvtyeimyhpa[16] = { 0, 0x08, 0x04, 0x0c, 0x02, 0x0a, 0x06, 0x0e, 0x01, 0x09, 0x05, 0x0d, 0x03, 0x0b, 0x07, 0x0f };
-static const uint8_t uwxqupuffcsf[16] = { 0, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x03, 0x01, 0x02, 0x02, 0x03, 0x02, 0x03, 0x03, 0x04 };
+static const uint8_t BC7215_HOT_DATA lxlfwpcgkpnw[16] = { 0x00, 0x02, 0x01, 0x03, 0x08, 0x0a, 0x09, 0x0b, 0x04, 0x06, 0x05, 0x07, 0x0c, 0x0e, 0x0d, 0x0f };
+static const uint8_t BC7215_HOT_DATA tqvtyeimyhpa[16] = { 0, 0x08, 0x04, 0x0c, 0x02, 0x0a, 0x06, 0x0e, 0x01, 0x09, 0x05, 0x0d, 0x03, 0x0b, 0x07, 0x0f };
+static const uint8_t BC7215_HOT_DATA uwxqupuffcsf[16] = { 0, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x03, 0x01, 0x02, 0x02, 0x03, 0x02, 0x03, 0x03, 0x04 };
 typedef struct lieoifkbswcz { uint8_t		mcddolhbanax;
 uint8_t		ovadtjwxdzya;
 uint8_t		maltsbbficvg;
@@ -127,10 +160,10 @@ uint8_t  scedlvelzavc : 1;
 uint8_t  signature;
 uint16_t bitLen;
 uint16_t kbuoarkttzag[4];
-lieoifkbswcz  urotzxmebdry;
-lieoifkbswcz  rozfsolwsfzh;
-lieoifkbswcz  ofajzwessiol;
-lieoifkbswcz  wlujocdbskis;
+uint16_t  urotzxmebdry;
+uint16_t  rozfsolwsfzh;
+uint16_t  ofajzwessiol;
+uint16_t  wlujocdbskis;
 const extraValue_t*  urjrhromzium;
 union offBits_t	lzjiegmlwhzf;
 const struct tbacqdqyhzjl* watvzlijecjx;
@@ -139,43 +172,48 @@ const struct wscodbmjbktx*	nhaqybpfptll;
 struct sxpegamfsrfd { struct vsghnouiwbyk	cssjkjaqtock;
 const void* 				hffaidvvtesl;
 };
+// Field records shared by the descriptors, which keep only their indices. Index 0 is the unused field
+#define FIELD_REC_CNT 543
+static const lieoifkbswcz fieldRecs[FIELD_REC_CNT];
+#define FIELD_REC(idx)   (fieldRecs[idx])
 static uint8_t nnkrhrkeffev(uint8_t byte);
 static void uubekixzgshu(const struct vsghnouiwbyk* cssjkjaqtock);
 static bool jjnbcsyhvcga(const struct vsghnouiwbyk* cssjkjaqtock);
-static uint8_t quwejoiijpow(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return ikxelzwhutjc+pfsohnkuokbo;
-} static uint8_t sqqdwrvojnfo(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return ikxelzwhutjc^pfsohnkuokbo;
-} static uint8_t cfyvoxvhfsjc(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return ikxelzwhutjc&pfsohnkuokbo;
-} static uint8_t uqyhlclfaqvf(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return ikxelzwhutjc|pfsohnkuokbo;
-} static uint8_t jygqbyirznuw(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return pfsohnkuokbo<<ikxelzwhutjc;
-} static uint8_t npdszpkyaeok(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return pfsohnkuokbo>>ikxelzwhutjc;
-} static uint8_t zbffnomatwig(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return ikxelzwhutjc-pfsohnkuokbo;
-} static uint8_t ilvnuufzrmrx(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { uint8_t ujbxqjypguet = ((pfsohnkuokbo&0x0f)+(pfsohnkuokbo>>4))&0x0f;
+static int8_t gvmzfeyguymh(const lieoifkbswcz* hgdodzdmndla, uint8_t bgxrgfmymfwn);
+static uint8_t BC7215_HOT_CODE quwejoiijpow(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return ikxelzwhutjc+pfsohnkuokbo;
+} static uint8_t BC7215_HOT_CODE sqqdwrvojnfo(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return ikxelzwhutjc^pfsohnkuokbo;
+} static uint8_t BC7215_HOT_CODE cfyvoxvhfsjc(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return ikxelzwhutjc&pfsohnkuokbo;
+} static uint8_t BC7215_HOT_CODE uqyhlclfaqvf(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return ikxelzwhutjc|pfsohnkuokbo;
+} static uint8_t BC7215_HOT_CODE jygqbyirznuw(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return pfsohnkuokbo<<ikxelzwhutjc;
+} static uint8_t BC7215_HOT_CODE npdszpkyaeok(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return pfsohnkuokbo>>ikxelzwhutjc;
+} static uint8_t BC7215_HOT_CODE zbffnomatwig(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return ikxelzwhutjc-pfsohnkuokbo;
+} static uint8_t BC7215_HOT_CODE ilvnuufzrmrx(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { uint8_t ujbxqjypguet = ((pfsohnkuokbo&0x0f)+(pfsohnkuokbo>>4))&0x0f;
 if (ujbxqjypguet & 0x08) { ujbxqjypguet |= 0xf0;
 } return ikxelzwhutjc+ujbxqjypguet;
-} static uint8_t mnfshirkttvb(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { (void)ikxelzwhutjc;
+} static uint8_t BC7215_HOT_CODE mnfshirkttvb(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { (void)ikxelzwhutjc;
 return pfsohnkuokbo;
-} static uint8_t ilibynmzdizy(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return ikxelzwhutjc&(~pfsohnkuokbo);
+} static uint8_t BC7215_HOT_CODE ilibynmzdizy(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return ikxelzwhutjc&(~pfsohnkuokbo);
 } static uint8_t vjmoucltcxxm (uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return ((ikxelzwhutjc&0xf0)+(pfsohnkuokbo&0xf0)) | ((ikxelzwhutjc+pfsohnkuokbo)&0x0f);
-} static uint8_t ctwpjffpgdcx(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return ikxelzwhutjc+nnkrhrkeffev(pfsohnkuokbo);
-} static uint8_t vnestuazyanw(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return ikxelzwhutjc-nnkrhrkeffev(pfsohnkuokbo);
-} static uint8_t zzkyfwrddmdb(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return ikxelzwhutjc+uwxqupuffcsf[pfsohnkuokbo>>4]+uwxqupuffcsf[pfsohnkuokbo&0x0f];
-} static uint8_t bflowncvliwg(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { (void)pfsohnkuokbo;
+} static uint8_t BC7215_HOT_CODE ctwpjffpgdcx(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return ikxelzwhutjc+nnkrhrkeffev(pfsohnkuokbo);
+} static uint8_t BC7215_HOT_CODE vnestuazyanw(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return ikxelzwhutjc-nnkrhrkeffev(pfsohnkuokbo);
+} static uint8_t BC7215_HOT_CODE zzkyfwrddmdb(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { return ikxelzwhutjc+uwxqupuffcsf[pfsohnkuokbo>>4]+uwxqupuffcsf[pfsohnkuokbo&0x0f];
+} static uint8_t BC7215_HOT_CODE bflowncvliwg(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { (void)pfsohnkuokbo;
 return ~ikxelzwhutjc;
-} static uint8_t foihsinohqsf(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { (void)ikxelzwhutjc;
+} static uint8_t BC7215_HOT_CODE foihsinohqsf(uint8_t ikxelzwhutjc, uint8_t pfsohnkuokbo) { (void)ikxelzwhutjc;
 return (pfsohnkuokbo<<4)|(pfsohnkuokbo>>4);
 } typedef uint8_t (*calFunc_t)(uint8_t, uint8_t);
-static const calFunc_t mjxneimtqttw[] = { quwejoiijpow, sqqdwrvojnfo, cfyvoxvhfsjc, uqyhlclfaqvf, jygqbyirznuw, npdszpkyaeok, zbffnomatwig, ilvnuufzrmrx, mnfshirkttvb, ilibynmzdizy, vjmoucltcxxm, ctwpjffpgdcx, vnestuazyanw, zzkyfwrddmdb, bflowncvliwg, foihsinohqsf };
-static uint8_t ztliufaujcyq(uint8_t mekzztbhyjqh, uint8_t ovadtjwxdzya) { if (ovadtjwxdzya&0x01) { return nhbvuvmcmmez[mekzztbhyjqh][ovadtjwxdzya/2]&0x0f;
+static const calFunc_t BC7215_HOT_DATA mjxneimtqttw[] = { quwejoiijpow, sqqdwrvojnfo, cfyvoxvhfsjc, uqyhlclfaqvf, jygqbyirznuw, npdszpkyaeok, zbffnomatwig, ilvnuufzrmrx, mnfshirkttvb, ilibynmzdizy, vjmoucltcxxm, ctwpjffpgdcx, vnestuazyanw, zzkyfwrddmdb, bflowncvliwg, foihsinohqsf };
+static uint8_t BC7215_HOT_CODE ztliufaujcyq(uint8_t mekzztbhyjqh, uint8_t ovadtjwxdzya) { if (ovadtjwxdzya&0x01) { return nhbvuvmcmmez[mekzztbhyjqh][ovadtjwxdzya/2]&0x0f;
 } else { return nhbvuvmcmmez[mekzztbhyjqh][ovadtjwxdzya/2]>>4;
-} } static void zrsbvldeqnpk(uint8_t mekzztbhyjqh, uint8_t ovadtjwxdzya, uint8_t data) { data &= 0x0f;
+} } static void BC7215_HOT_CODE zrsbvldeqnpk(uint8_t mekzztbhyjqh, uint8_t ovadtjwxdzya, uint8_t data) { data &= 0x0f;
 if (ovadtjwxdzya&0x01) { nhbvuvmcmmez[mekzztbhyjqh][ovadtjwxdzya/2] = (nhbvuvmcmmez[mekzztbhyjqh][ovadtjwxdzya/2]&0xf0)|data;
 } else { nhbvuvmcmmez[mekzztbhyjqh][ovadtjwxdzya/2] = (nhbvuvmcmmez[mekzztbhyjqh][ovadtjwxdzya/2]&0x0f) | (data<<4);
-} } static uint8_t qawouhkqsihv(uint8_t mekzztbhyjqh, uint8_t ovadtjwxdzya) { if (ovadtjwxdzya&0x01) { return nhbvuvmcmmez[mekzztbhyjqh][ovadtjwxdzya/2]>>4;
+} } static uint8_t BC7215_HOT_CODE qawouhkqsihv(uint8_t mekzztbhyjqh, uint8_t ovadtjwxdzya) { if (ovadtjwxdzya&0x01) { return nhbvuvmcmmez[mekzztbhyjqh][ovadtjwxdzya/2]>>4;
 } else { return nhbvuvmcmmez[mekzztbhyjqh][ovadtjwxdzya/2]&0x0f;
-} } static void qpxcyjppljwd(uint8_t mekzztbhyjqh, uint8_t ovadtjwxdzya, uint8_t data) { data &= 0x0f;
+} } static void BC7215_HOT_CODE qpxcyjppljwd(uint8_t mekzztbhyjqh, uint8_t ovadtjwxdzya, uint8_t data) { data &= 0x0f;
 if (ovadtjwxdzya&0x01) { nhbvuvmcmmez[mekzztbhyjqh][ovadtjwxdzya/2] = (nhbvuvmcmmez[mekzztbhyjqh][ovadtjwxdzya/2]&0x0f) | (data<<4);
 } else { nhbvuvmcmmez[mekzztbhyjqh][ovadtjwxdzya/2] = (nhbvuvmcmmez[mekzztbhyjqh][ovadtjwxdzya/2]&0xf0)|data;
-} } static bool vazisqcodoyh(const struct vsghnouiwbyk* cssjkjaqtock, const struct pktfcxxfncig* coblviwgccvs, bool ahyzslokqilb) { uint8_t mekzztbhyjqh, binbdllxxutl, iigdpskkkics, nibStart, nibEnd;
+} } static bool BC7215_HOT_CODE vazisqcodoyh(const struct vsghnouiwbyk* cssjkjaqtock, const struct pktfcxxfncig* coblviwgccvs, bool ahyzslokqilb) { uint8_t mekzztbhyjqh, binbdllxxutl, iigdpskkkics, nibStart, nibEnd;
 uint8_t zbsbxrmgwhhr;
 uint8_t ikxelzwhutjc, pfsohnkuokbo;
 uint8_t dskbycvacpfu;
@@ -251,7 +289,7 @@ if (ahyzslokqilb) { nhbvuvmcmmez[fqalxysuvvwm][targetPos] = dskbycvacpfu;
 if (ahyzslokqilb) { qpxcyjppljwd(fqalxysuvvwm, targetPos, dskbycvacpfu&0x0f);
 } else { return (dskbycvacpfu&0x0f) == qawouhkqsihv(fqalxysuvvwm, targetPos);
 } } } } return true;
-} static bool egdktbtdutis(const struct vsghnouiwbyk* cssjkjaqtock, const struct pktfcxxfncig* coblviwgccvs, bool ahyzslokqilb) { uint8_t mekzztbhyjqh, binbdllxxutl, iigdpskkkics, byteStart, byteEnd;
+} static bool BC7215_HOT_CODE egdktbtdutis(const struct vsghnouiwbyk* cssjkjaqtock, const struct pktfcxxfncig* coblviwgccvs, bool ahyzslokqilb) { uint8_t mekzztbhyjqh, binbdllxxutl, iigdpskkkics, byteStart, byteEnd;
 uint8_t zbsbxrmgwhhr;
 uint8_t ikxelzwhutjc, pfsohnkuokbo;
 uint8_t dskbycvacpfu;
@@ -309,13 +347,14 @@ return dskbycvacpfu;
 } static bool bodjhjgyoxhi(const struct vsghnouiwbyk* cssjkjaqtock, const struct pktfcxxfncig* coblviwgccvs, bool ahyzslokqilb) { uint8_t zbsbxrmgwhhr;
 (void)ahyzslokqilb;
 for (zbsbxrmgwhhr=0; zbsbxrmgwhhr<coblviwgccvs->tqcxlbpdyumb; zbsbxrmgwhhr++)
-{ if (nhbvuvmcmmez[coblviwgccvs->bkpjwqksrjra][coblviwgccvs->rrcbdmmkoaaz+zbsbxrmgwhhr] != *(cssjkjaqtock->ofajzwessiol.hgdodzdmndla+zbsbxrmgwhhr)) { return false;
+{ if (nhbvuvmcmmez[coblviwgccvs->bkpjwqksrjra][coblviwgccvs->rrcbdmmkoaaz+zbsbxrmgwhhr] != *(FIELD_REC(cssjkjaqtock->ofajzwessiol).hgdodzdmndla+zbsbxrmgwhhr)) { return false;
 } } return true;
 } static void nexkiawgsmhd(const bc7215DataVarPkt_t* lisemfzsvrmg, const bc7215FormatPkt_t* ykzkmazhyybm) { (void)lisemfzsvrmg;
 (void)ykzkmazhyybm;
 ojsszplvqtdq = exhfmkybxmek;
-ojsszplvqtdq.bitLen = ((const struct sxpegamfsrfd*)ylalbobacimq->rozfsolwsfzh.hgdodzdmndla)->cssjkjaqtock.bitLen;
+ojsszplvqtdq.bitLen = ((const struct sxpegamfsrfd*)FIELD_REC(ylalbobacimq->rozfsolwsfzh).hgdodzdmndla)->cssjkjaqtock.bitLen;
 umynxtxlzfya = ymndlmvtogxm;
+dropBaseSegments();
 tuptfpuregsc = dayyhlonocwg;
 ojsszplvqtdq.data[19] = 0x01;
 ojsszplvqtdq.data[7] = (ojsszplvqtdq.data[7]&0xf0)|0x05;
@@ -323,8 +362,6 @@ ojsszplvqtdq.data[7] = (ojsszplvqtdq.data[7]&0xf0)|0x05;
 static const uint8_t qlbsybjbuuwq[] =  {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x2f};
 static const uint8_t jlxcxegylhom[] =  {0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x00};
 static const uint8_t hzaxbgzfvbgn[] =  {0x16, 0x17, 0x18, 0x19, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x30};
-static const uint8_t pqzbdwgjzgjg[] =  {0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d};
-static const uint8_t nemjsunvswft[] =  {0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a};
 static const uint8_t auwyugwmwlso[] =  {0x0f, 0x0e, 0x0d, 0x0c, 0x0b, 0x0a, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01};
 static const uint8_t evrgvsxldwse[] =  {0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x0F, 0x0E, 0x0D, 0x0C, 0x0B, 0x0A, 0x09};
 static const uint8_t hmcmmhtpafcl[] =  {0x0f, 0x1e, 0x2d, 0x3c, 0x4b, 0x5a, 0x69, 0x78, 0x87, 0x96, 0xa5, 0xb4, 0xc3, 0xd2, 0xe1};
@@ -336,7 +373,6 @@ static const uint8_t mmaikokpzmiv[] = {0x00, 0x00, 0x01, 0x03, 0x02, 0x06, 0x07,
 static const uint8_t rnzkhkybayht[] = {0x0f, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e};
 static const uint8_t sjmbrhgdfrrn[] = {0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x12, 0x11, 0x10, 0x0F, 0x0E, 0x0D, 0x0C, 0x0B};
 static const uint8_t rlymjpnqwqxi[] = {0x0d, 0x0e, 0x0f, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b};
-static const uint8_t aekximikujqn[] = {0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c};
 static const uint8_t ybxjhnxfyjgb[] = {0x00, 0x0a, 0x14, 0x1e, 0x28, 0x32, 0x3c, 0x46, 0x50, 0x5a, 0x64, 0x6e, 0x78, 0x82, 0x8c};
 static const uint8_t nuyihfymrlxy[] = {0x18, 0x1A, 0x1c, 0x1e, 0x20, 0x22, 0x24, 0x26, 0x28, 0x2a, 0x2c, 0x2e, 0x30, 0x32, 0x34};
 static const uint8_t vmrjepqklhrp[] = {0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x00};
@@ -347,7 +383,6 @@ static const uint8_t atzscyghbqee[] = {0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d,
 static const uint8_t dirmsniyzxmk[] = {0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x60};
 static const uint8_t xgmfromrdrwl[] = {0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x40};
 static const uint8_t lrpkzrzobwqs[] = {0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24};
-static const uint8_t dvdpdyuxhulp[] = {0x0f, 0x1e, 0x2d, 0x3c, 0x4b, 0x5a, 0x69, 0x78, 0x87, 0x96, 0xa5, 0xb4, 0xc3, 0xd2, 0xe1};
 static const uint8_t jxwvazqfgoxj[] = {0x00, 0x01, 0x03, 0x02, 0x06, 0x07, 0x05, 0x04, 0x0c, 0x0d, 0x0f, 0x0e, 0x0a, 0x0b, 0x09};
 static const uint8_t mnqdymgkrwjk[] = {0x42, 0x44, 0x45, 0x47, 0x49, 0x4b, 0x4d, 0x4e, 0x50, 0x52, 0x54, 0x56, 0x57, 0x59, 0x5b};
 static const uint8_t ujhihmyhohwg[] = {0x08, 0x04, 0x0c, 0x02, 0x0a, 0x06, 0x0e, 0x01, 0x09, 0x05, 0x0d, 0x03, 0x0b, 0x07, 0x0f};
@@ -355,12 +390,10 @@ static const uint8_t mcmwdzsspsij[] = {0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
 static const uint8_t imegbmhoswpz[] = {0x07, 0x0b, 0x03, 0x0d, 0x05, 0x09, 0x01, 0x0e, 0x06, 0x0a, 0x02, 0x0c, 0x04, 0x08, 0x00};
 static const uint8_t mscxujnqnuhc[] = {0x00, 0x0f, 0x07, 0x0b, 0x03, 0x0d, 0x05, 0x09, 0x01, 0x0e, 0x06, 0x0a, 0x02, 0x0c, 0x04};
 static const uint8_t yqfsdnalmyna[] = {0x08, 0x08, 0x08, 0x04, 0x0c, 0x02, 0x0a, 0x06, 0x0e, 0x01, 0x09, 0x05, 0x0d, 0x0d, 0x0d};
-static const uint8_t tkgjxmqmrafm[] = {0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19};
 static const uint8_t jvyasvocpwas[] = {0x30, 0x32, 0x34, 0x36, 0x38, 0x3A, 0x3C, 0x3E, 0x40, 0x42, 0x44, 0x46, 0x48, 0x4A, 0x4C, 0xC0};
 static const uint8_t ughfpjcxzynj[] = {0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b};
 static const uint8_t ekkpcyyobtwh[] = {0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05};
 static const uint8_t oaqarbuqcnzi[] = {0x00, 0x08, 0x04, 0x0c, 0x02, 0x0a, 0x06, 0x0e, 0x01, 0x09, 0x05, 0x0d, 0x03, 0x0b, 0x07};
-static const uint8_t pbcogogavqpp[] = {0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10};
 static const uint8_t rzgdiuvzpbzk[] = {0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x00};
 static const uint8_t qasyaeygoyda[] = {0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x01, 0x02, 0x03};
 static const uint8_t xpatrucniagd[] = {0x07, 0x07, 0x06, 0x05, 0x04, 0x03, 0x07, 0x06, 0x05, 0x04, 0x03, 0x07, 0x06, 0x05, 0x04};
@@ -395,7 +428,6 @@ static const uint8_t shqsgblklcuc[] = {5,   1,   2,  4,  3};
 static const uint8_t wrcxnynhcibi[] = {4,   0,   1,  2,  5};
 static const uint8_t iquqznqnoydo[] = {3,   1,   3,  2,  2};
 static const uint8_t owzoglwzsxda[] = {0,   1,   2,  4,  3};
-static const uint8_t ybuezpmusfwy[] = {0,   1,   2,  3,  4};
 static const uint8_t yzpeqodnfhra[] = {1,   2,   1,  3,  5};
 static const uint8_t tjbeparnujnx[] = {0x42,  0x42, 0xc3,  0x42,  0xc3};
 static const uint8_t nbgcalmcrydn[] = {0,   2,   4,  1,  3};
@@ -412,7 +444,6 @@ static const uint8_t gzobhywjwzgu[] = {9,   6,   1,  5,  0x0d};
 static const uint8_t acrrvmmzqyhj[] = {6,   2,   1,  3,  0};
 static const uint8_t qkzbyzcluece[] = {0,   3,   1,  2,  7};
 static const uint8_t smlahnhsfqyk[] = {3,   1,   2,  5,  0};
-static const uint8_t pqvvecicvowt[] = {2,   3,   1,  2,  2};
 static const uint8_t cnvzopxnosqn[] = {7,   7,   1,  5,  3};
 static const uint8_t tmjxndimiwqv[] = {3,   2,   1,  7,  0};
 static const uint8_t gboajlxtrvem[] = {0,   4,   2,  6,  0};
@@ -427,7 +458,6 @@ static const uint8_t ygcjwyoxujmy[] = {3,   0,   4,  1,  2};
 static const uint8_t etirvoycmsmy[] = {7,   6,   4,  5,  3};
 static const uint8_t hlwjchgwhrxt[] = {5,   2,   1,  3,  4};
 static const uint8_t cmvjkmxfoogt[] = {1,   3,   4,  2,  6};
-static const uint8_t kuynqvlswrys[] = {3,   2,   1,  7,  0};
 static const uint8_t sjcyohrqpoaq[] = {0x0a, 2,  8,  1,  4};
 static const uint8_t buylqkkswbpc[] = {7,  4,  6,  4,  3};
 static const uint8_t wtkljughxyhz[] = {1,  6,  6,  5,  0x0a};
@@ -436,7 +466,6 @@ static const uint8_t ewocvipkuzaw[] = {1,  1,  3,  2,  0};
 static const uint8_t kmaatknfqqxv[] = {1,  6,  0x0d,  6,  0x0a};
 static const uint8_t jwphqmnoiuwo[] = {1,  2,  6,  3,  0};
 static const uint8_t sohkunnzjygb[] = {4,  2,  6,  3,  5};
-static const uint8_t qzrdkksygiln[] = {1,  1,  1,  1,  1};
 static const uint8_t psyzdexniwbw[] = {0x23, 0x03, 0x03, 0x22, 0x21};
 static const uint8_t jzebnhioprnt[] = {7,  3,  1,  2,  2};
 static const uint8_t cwmdpzszkgpi[] = {0x05, 0x41, 0x24, 0x42, 0x03};
@@ -478,7 +507,6 @@ static const uint8_t xknpcbptryfb[] = { 0,    2,     3,    5, 5};
 static const uint8_t xzzewdxxicyp[] = { 0,    2,     0,    4, 4};
 static const uint8_t mctpbidjvrsb[] = { 5,    1,     2,    4,  0};
 static const uint8_t sodnmplfotvu[] = {0x0a,  3,     5,    7, 7};
-static const uint8_t ctwleblehvbl[] = { 0,    1,     2,    4};
 static const uint8_t balsfqyllobd[] ={ 7,    3,     2,    1, 1};
 static const uint8_t ygdgsrknfpiy[] ={ 0,    3,     2,    1, 1};
 static const uint8_t zhfepltcdgom[] ={ 7,    5,     3,    1, 1};
@@ -487,7 +515,6 @@ static const uint8_t watlqftdktqz[] ={ 3,    0,     1,    2, 5};
 static const uint8_t cdtozclqdgpe[] ={0xFF, 0x20, 0x40, 0x60, 0x60};
 static const uint8_t wiesewazwfjj[] ={ 7,    6,     5,    4, 4};
 static const uint8_t enfaqllpjsst[] ={ 3,    4,     3,    2, 2};
-static const uint8_t mqgcthvkvikd[] ={ 8,    4,     2,    1, 0};
 static const uint8_t xoikkvjtpeyh[] ={ 1,    4,     8,    2, 2};
 static const uint8_t gezfbtusiggj[] = { 6,    1,    3,    5,  5};
 static const uint8_t rxjkcgzrlsjg[] = { 5,    4,     2,    1, 0};
@@ -525,13 +552,9 @@ static const uint8_t plbsqfqwtdxy[] = {0, 3, 7, 5};
 static const uint8_t ioyqosfwejrk[] = {0, 2, 6, 5};
 static const uint8_t jeqgpekhirgy[] = {0, 3, 4, 5};
 static const uint8_t qzwqicrgdjvb[] = {2, 3, 5, 7};
-static const uint8_t odzevozycpja[] = {0, 2, 1, 3};
-static const uint8_t aglvlpkugvof[] = {1, 2, 3, 4};
 static const uint8_t zazdvdrlgoxw[] = {7, 1, 3, 5};
-static const uint8_t jiytyamonchm[] = {4, 5, 6, 7};
 static const uint8_t jstalkdbnehx[] = {0, 2, 6, 1};
 static const uint8_t irftdmkwcmwl[] = {7, 4, 2, 1};
-static const uint8_t bqkwjhxmdzlf[] = {3, 1, 2, 0};
 static const uint8_t jrumdzqovxoi[] = {0, 2, 1, 8};
 static const uint8_t idmdsvmdrdfb[] = {7, 6, 4, 3};
 static const uint8_t wlrehuclbzxu[] = {8, 2, 6, 4};
@@ -545,7 +568,6 @@ static const uint8_t awcyzokqylxb[]   = {3, 3, 0x0c, 3, 0x0b, 3};
 static const uint8_t dijowucrnhyr[] = {0x66, 0x28, 0x3c, 0x64, 0x65};
 static const uint8_t khirzhpliszk[] = {0x66, 0x14, 0x3c, 0x64, 0x65};
 static const uint8_t asymsdykfyoh[]   = {1, 1, 1, 2, 0x0f, 0x0f};
-static const uint8_t pvaqlkvrylaf[] = {1, 0, 0, 0, 0};
 static const uint8_t vczurmymtuxp[]   = {1, 2, 4, 6, 3, 3};
 static const uint8_t qkjrwmuzbyzt[]   = {5, 7, 0x0b, 9, 0x0c, 0x0c};
 static const uint8_t dhljfflougxp[]   = {6, 7, 2, 3, 0, 1};
@@ -565,7 +587,6 @@ static const uint8_t vubaykzztfch[] = {0, 0, 1, 1, 0};
 static const uint8_t mwkgnbawnupn[]  = {0, 0, 1, 0, 0, 0};
 static const uint8_t lzedgpxidpwo[]  = {0x44, 0x43, 0x13, 0x42, 0x13, 0x13};
 static const uint8_t ntreoxngymvu[]  = {8, 9, 7, 0x0c, 3, 3};
-static const uint8_t dyotlvvkqnpr[] = {0, 0, 0, 0, 0};
 static const uint8_t hflaumdbxlvi[]  = {2, 3, 1, 5, 0, 0, 0x16};
 static const uint8_t mtfsewvbqxgq[]  = {9, 0x0a, 8, 0x0f, 0, 0};
 static const uint8_t mislybzummhh[] = {1, 3, 0, 0, 1};
@@ -578,14 +599,12 @@ static const uint8_t arrgrcqyizqk[]  = {0x0d, 0x0d, 0x09, 0x11, 0x06, 0X06};
 static const uint8_t bitfqvjznjnl[]  = {1, 1, 1, 1, 0x0a, 6};
 static const uint8_t wowphqlodpqt[]  = {1, 1, 1, 1, 0x0a, 0x0a};
 static const uint8_t lmcndmewtobi[] = {0xa7, 0xa7, 0x45, 0x95, 0xa7};
-static const uint8_t zkbfjyvupcpk[]  = {4, 4, 4, 4, 5, 5};
-static const uint8_t zemiirzsdbky[]  = {0, 0, 0, 0, 1, 1};
 static const uint8_t bwmvykmymvdg[]  = {3, 3, 3, 3, 2, 1};
 static const uint8_t epeeaeljzebe[]  = {2, 2, 2, 2, 2, 1};
 static const uint8_t batckafsxjzu[]  = {0, 0, 0, 0, 2, 1};
-static const uint8_t uaghrucblmcx[] = {0, 0, 0, 1, 1};
 static const uint8_t ploddrlwbsqf[] = {2, 0, 0, 0, 1};
-static const uint8_t enbhuleqjjhe[] = {7, 0, 1, 2};
+/* read up to index 4, the last value is the byte the release build read past the end of the table */
+static const uint8_t enbhuleqjjhe[] = {7, 0, 1, 2, 2};
 static const uint8_t gogtxxkhbwxb[] = {1, 2, 2, 0, 2};
 static const uint8_t xnxeqdrldfpq[] = {7, 7, 7, 2, 6};
 static const uint8_t nplzubhhgday[]  = {0, 0, 3, 4, 0, 0};
@@ -613,12 +632,10 @@ static const srbjiaxreyht vwscklnffyeu[] = { {1, 0, 4, 0xC0, amqakavjmqpd}, {3,
 static const uint8_t bsgeijssfjwg[] = {6, 6, 6, 6, 6};
 static const uint8_t xsqlrhmgxltc[] = {0, 2, 1, 0};
 static const srbjiaxreyht usqyxwejuzcf[] = { {1, 0, 4, 0x0f, bsgeijssfjwg}, {2, 0, 4, 0x03, xsqlrhmgxltc}, {0, 0, 0, 0, NULL} };
-static const uint8_t cztjpnnyqgsq[] = {0, 0xc0, 0x80, 0x40};
-static const srbjiaxreyht yybzbksdpajd[] = { {2, 1, 2, 0xE0, cztjpnnyqgsq}, {0, 0, 0, 0, NULL} };
+static const srbjiaxreyht yybzbksdpajd[] = { {2, 1, 2, 0xE0, pwtyykijqszs}, {0, 0, 0, 0, NULL} };
 static const uint8_t bzqbhfkhzabk[] = {0, 0x20, 0x60, 0xA0};
 static const srbjiaxreyht tvhwcvmsyyup[] = { {2, 0, 4, 0xE0, bzqbhfkhzabk}, {0, 0, 0, 0, NULL} };
-static const uint8_t adepjrjmyflj[] = {0, 0, 0, 0, 4};
-static const srbjiaxreyht hwexjkkeehcg[] = { {2, 0, 4, 0x04, adepjrjmyflj}, {0, 0, 0, 0, NULL} };
+static const srbjiaxreyht hwexjkkeehcg[] = { {2, 0, 4, 0x04, lvgrvcvajddi}, {0, 0, 0, 0, NULL} };
 static const int8_t cplcynbrcjqi[] = { 16-16, 16-16, 17-16, 17-16, 18-16, 18-16, 19-16, 19-16, 20-16, 20-16, 21-16, 21-16, 22-16, 22-16, 23-16, 23-16, 24-16, 25-16, 26-16, 26-16, 27-16, 27-16, 28-16, 28-16, 29-16, 29-16, 30-16, 30-16, 30-16};
 static const int8_t rsayssmripvl[] = { 16-16, 16-16, 17-16, 17-16, 18-16, 18-16, 19-16, 19-16, 20-16, 21-16, 21-16, 22-16, 22-16, 23-16, 23-16, 24-16, 24-16, 25-16, 26-16, 26-16, 27-16, 27-16, 28-16, 28-16, 29-16, 29-16, 30-16, 30-16, 30-16};
 static const int8_t sqfkedbqwbse[] = { 16-16, 16-16, 17-16, 17-16, 18-16, 18-16, 19-16, 19-16, 20-16,  20-16, 21-16, 21-16, 22-16, 23-16, 23-16, 24-16, 24-16, 25-16, 25-16, 26-16, 26-16, 27-16, 28-16, 28-16, 29-16, 29-16, 30-16, 30-16, 30-16};
@@ -662,7 +679,6 @@ static const uint8_t ntdruvybdjdu[] = { 0, 0x0f, 0, 0x0f, 0, 0x0f, 0, 0x0f, 0, 0
 static const uint8_t umtyimaxhaqh[] = { 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1};
 static const uint8_t drbggtjjncpr[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
 static const uint8_t htkixwbtswrg[] = { 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5};
-static const uint8_t jjcpdseefqxq[] = { 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 1, 1};
 static const struct wscodbmjbktx isxavciifnyk = { cplcynbrcjqi, { 0, 1, 0x40, 6, tuxwbwdablhn } };
 static const struct wscodbmjbktx eftthwofcwcr = { rsayssmripvl, { 0, 3, 0x04, 2, mzrfbnqakbsn } };
 static const struct wscodbmjbktx xoktxtcxkstd = { jwlupoyiyfrk, { 0, 1, 0x01, 0, nwtqorlanvey } };
@@ -738,7 +754,7 @@ static const struct wscodbmjbktx hblgrlgpyoet = { imotugrgwtbl, { 1, 1, 0x01, 0,
 static const struct wscodbmjbktx njduflecdoqp = { zcvrnunbsynt, { 0, 1, 0x08, 3, umtyimaxhaqh } };
 static const struct wscodbmjbktx auaewvylxkez = { sqfkedbqwbse, { 3, 6, 0x02, 1, qgdcpmmavqox } };
 static const struct wscodbmjbktx bnqhrpudkhrd = { jwlupoyiyfrk, { 3, 6, 0x01, 0, nwtqorlanvey } };
-static const struct wscodbmjbktx dovydskcoyph = { aubhtiwhtzwi, { 0, 3, 0x04, 2, jjcpdseefqxq } };
+static const struct wscodbmjbktx dovydskcoyph = { aubhtiwhtzwi, { 0, 3, 0x04, 2, qgdcpmmavqox } };
 static const struct wscodbmjbktx ghgjjuztaesj = { cplcynbrcjqi, { 0, 0, 0, 0, NULL } };
 static const struct pktfcxxfncig scpicsspoord = { 0x00, 1, 0, 2, {0, 0, 0, 0}, -1, 0, 0, 8 };
 static const struct pktfcxxfncig thorhcukfpln = { 0x11, 0, -3, 2, {0, 1, 0, 0}, 1, -1, 0, 0 };
@@ -825,14 +841,11 @@ static const struct pktfcxxfncig asjlcfmntoqd = { 0x00, 0, 0, 1, {0, 1, 0, 0}, 2
 static const struct pktfcxxfncig tlkbozzdilei = { 0x00, 0, -1, 1, {0, 0, 0, 0}, 0, 0, 0, 0xed };
 static const struct pktfcxxfncig qauwuvtpflxi = { 0x00, 0, -1, 1, {1, 0, 0, 0}, 1, 0, 0, 0x14 };
 static const struct tbacqdqyhzjl neblmufxjobh[] = { { egdktbtdutis,	&ywgpfqyyxxph }, { vazisqcodoyh,	&scpicsspoord }, { vazisqcodoyh,	&thorhcukfpln }, { vazisqcodoyh,	&vkmtbmjmvjop }, { vazisqcodoyh,	&rgphprgzgcbh }, {NULL, NULL} };
-static const struct tbacqdqyhzjl iomtqjccekux[] = { { vazisqcodoyh,	&scpicsspoord }, { vazisqcodoyh,	&thorhcukfpln }, { vazisqcodoyh,	&vkmtbmjmvjop }, { vazisqcodoyh,	&rgphprgzgcbh }, {NULL, NULL} };
 static const struct tbacqdqyhzjl vvivsaqmctsn[] = { { vazisqcodoyh,	&scpicsspoord }, { vazisqcodoyh,	&thorhcukfpln }, {NULL, NULL} };
 static const struct tbacqdqyhzjl cxxqpwnfospn[] = { { egdktbtdutis,	&ffisczxrscmb }, {NULL, NULL} };
 static const struct tbacqdqyhzjl ybjlgbokpeap[] = { { vazisqcodoyh,	&ffisczxrscmb }, {NULL, NULL} };
-static const struct tbacqdqyhzjl rlwfjarwbyva[] = { { egdktbtdutis,	&hidgeduttqfu }, {NULL, NULL} };
 static const struct tbacqdqyhzjl vixgnerqasdw[] = { { egdktbtdutis,	&hidgeduttqfu }, { egdktbtdutis,	&ngrzeysnitls }, {NULL, NULL} };
 static const struct tbacqdqyhzjl tqokiavwcgfc[] = { { egdktbtdutis,	&ngrzeysnitls }, { egdktbtdutis,	&jeykmogorxgj }, { egdktbtdutis,	&idcjiyplxduq }, {NULL, NULL} };
-static const struct tbacqdqyhzjl gcpbulrrerdq[] = { {NULL, NULL} };
 static const struct tbacqdqyhzjl fwastflmujzt[] = { { egdktbtdutis, &sutoxatvacfq}, { egdktbtdutis, &vmmofgybaymv}, {NULL, NULL} };
 static const struct tbacqdqyhzjl trsclbhfsdgr[] = { { vazisqcodoyh,	&oxxsqsispxia }, {NULL, NULL} };
 static const struct tbacqdqyhzjl ewcwtwtnjumd[] = { { vazisqcodoyh,	&immjrkfcobrf }, {NULL, NULL} };
@@ -845,21 +858,16 @@ static const struct tbacqdqyhzjl twbcxiqkpyzk[] = { { vazisqcodoyh,	&oxxsqsispxi
 static const struct tbacqdqyhzjl mbtdrqfkrhlf[] = { { egdktbtdutis, &hlokiuxcntir}, { egdktbtdutis, &tbefjzytputb}, { egdktbtdutis, &vmmofgybaymv}, { egdktbtdutis, &smwragrlwavl}, {NULL, NULL} };
 static const struct tbacqdqyhzjl rhpoedahrstb[] = { { egdktbtdutis, &sutoxatvacfq}, {NULL, NULL} };
 static const struct tbacqdqyhzjl bhkyctzmvica[] = { { egdktbtdutis, &epwtgzhkdnxx}, { egdktbtdutis, &vmmofgybaymv}, { egdktbtdutis, &jeykmogorxgj}, {NULL, NULL} };
-static const struct tbacqdqyhzjl amkaibhhhfsc[] = { { egdktbtdutis, &epwtgzhkdnxx}, { egdktbtdutis, &vmmofgybaymv}, {NULL, NULL} };
 static const struct tbacqdqyhzjl ebahprebnmen[] = { { egdktbtdutis, &sofoqdtfequm}, {NULL, NULL} };
-static const struct tbacqdqyhzjl uttppbcvqthg[] = { { vazisqcodoyh,	&oxxsqsispxia }, { egdktbtdutis, &vmmofgybaymv}, {NULL, NULL} };
-static const struct tbacqdqyhzjl fqgiigpemcaz[] = { { egdktbtdutis, &vmmofgybaymv}, {NULL, NULL} };
 static const struct tbacqdqyhzjl byrdqdaczwxz[] = { { lccydooawqqq,	&ffisczxrscmb }, {NULL, NULL} };
 static const struct tbacqdqyhzjl yidkopkslqak[] = { { rxcxbbegyxhy,	&zktfbbqrcufi }, { egdktbtdutis,	&hidgeduttqfu }, {NULL, NULL} };
 static const struct tbacqdqyhzjl rktudivhsjgb[] = { { rxcxbbegyxhy,	&xpwamxtikdbb }, { egdktbtdutis,	&hidgeduttqfu }, {NULL, NULL} };
 static const struct tbacqdqyhzjl dlpifexbyqlw[] = { { rxcxbbegyxhy,	&zzzejwheubuv }, { egdktbtdutis,	&hidgeduttqfu }, {NULL, NULL} };
-static const struct tbacqdqyhzjl dsuxtremdabv[] = { { egdktbtdutis, &yydxualqtuaa}, {NULL, NULL} };
 static const struct tbacqdqyhzjl vqivsbeaooll[] = { { vazisqcodoyh,	&sdjplhlnxhzg }, {NULL, NULL} };
 static const struct tbacqdqyhzjl iprctvkigumk[] = { { vazisqcodoyh,	&sygjnpzqzwmc }, {NULL, NULL} };
 static const struct tbacqdqyhzjl rjvlmqcbgtfl[] = { { vazisqcodoyh,	&dxobunvidkts }, {NULL, NULL} };
 static const struct tbacqdqyhzjl wotxnpmxljzj[] = { { vazisqcodoyh,	&tywwqmoetbpr }, {NULL, NULL} };
 static const struct tbacqdqyhzjl dvlmbpsinqoo[] = { { egdktbtdutis,	&gezhqrxwpcvj }, { egdktbtdutis,	&tinvjsjlztyy }, {NULL, NULL} };
-static const struct tbacqdqyhzjl dyoerhuugkim[] = { { egdktbtdutis,	&ngrzeysnitls }, {NULL, NULL} };
 static const struct tbacqdqyhzjl lrwothecqnqk[] = { { egdktbtdutis, &gezhqrxwpcvj}, {NULL, NULL} };
 static const struct tbacqdqyhzjl wiuiioibmfwg[] = { { egdktbtdutis, &euycpbrasfyv}, {NULL, NULL} };
 static const struct tbacqdqyhzjl wleslucdzswj[] = { { egdktbtdutis, &rlxfdkgxbhaw}, {NULL, NULL} };
@@ -869,14 +877,11 @@ static const struct tbacqdqyhzjl wkhvrdgxemas[] = { { egdktbtdutis,	&hidgeduttqf
 static const struct tbacqdqyhzjl tghubrggbsnn[] = { { egdktbtdutis, &sviydcyvzsbo}, {NULL, NULL} };
 static const struct tbacqdqyhzjl pwvdqwkpzxsd[] = { { lccydooawqqq,	&txantqrqulcf }, { lccydooawqqq,	&wjlxeymsdhib }, {NULL, NULL} };
 static const struct tbacqdqyhzjl qjwvrgtjudlw[] = { { egdktbtdutis, &hlokiuxcntir}, { egdktbtdutis, &vmmofgybaymv}, { egdktbtdutis, &kdmwvfqfqpll}, {NULL, NULL} };
-static const struct tbacqdqyhzjl tynaglfwcjtt[] = { { lccydooawqqq,	&wjlxeymsdhib }, {NULL, NULL} };
 static const struct tbacqdqyhzjl yfkkffuyjdjc[] = { { egdktbtdutis, &fmiautdpefoh}, {NULL, NULL} };
 static const struct tbacqdqyhzjl pxkacdstmejh[] = { { egdktbtdutis, &juiwgoflmtxn}, {NULL, NULL} };
-static const struct tbacqdqyhzjl tfqcvjqqgksc[] = { { egdktbtdutis, &euycpbrasfyv }, {NULL, NULL} };
 static const struct tbacqdqyhzjl fxfxqyeahtnk[] = { { egdktbtdutis, &zuvszjqpjpif }, {NULL, NULL} };
 static const struct tbacqdqyhzjl yzwkptrlibny[] = { { egdktbtdutis, &lrhujomivxhq }, {NULL, NULL} };
 static const struct tbacqdqyhzjl najmcimiaeia[] = { { egdktbtdutis, &avbwnhjdvsmf }, {NULL, NULL} };
-static const struct tbacqdqyhzjl bspfpjedoqeg[] = { { egdktbtdutis, &ngrzeysnitls }, { egdktbtdutis, &jeykmogorxgj }, {NULL, NULL} };
 static const struct tbacqdqyhzjl piayrwdcoabm[] = { { lccydooawqqq, &hfzogtvctnrv }, {NULL, NULL} };
 static const struct tbacqdqyhzjl pjyjlubiskul[] = { { rxcxbbegyxhy,	&exfjaoarjmrf }, { egdktbtdutis, &yydxualqtuaa}, { egdktbtdutis, &rmwjeiydhtdi}, {NULL, NULL} };
 static const struct tbacqdqyhzjl butuufvlfofh[] = { { lccydooawqqq, &iweybqhgkwwg }, {NULL, NULL} };
@@ -884,7 +889,6 @@ static const struct tbacqdqyhzjl engafuusnyoi[] = { { rxcxbbegyxhy,	&exfjaoarjmr
 static const struct tbacqdqyhzjl azjugvbsdsqp[] = { { vazisqcodoyh,	&immjrkfcobrf }, { egdktbtdutis, &rmwjeiydhtdi}, { egdktbtdutis, &edekzrzzumla}, {NULL, NULL} };
 static const struct tbacqdqyhzjl romdggzovziq[] = { { egdktbtdutis,	&ffisczxrscmb }, { egdktbtdutis, &vmmofgybaymv}, {NULL, NULL} };
 static const struct tbacqdqyhzjl lenaojpypmgf[] = { { egdktbtdutis,	&ygqcwdbtvteb }, {NULL, NULL} };
-static const struct tbacqdqyhzjl ygcxahquzvij[] = { { egdktbtdutis, &rmwjeiydhtdi}, { egdktbtdutis, &edekzrzzumla}, {NULL, NULL} };
 static const struct tbacqdqyhzjl puyhqnzygnrs[] = { { egdktbtdutis, &epwtgzhkdnxx}, { egdktbtdutis, &vmmofgybaymv}, {egdktbtdutis, &qslctipbfazs}, {NULL, NULL} };
 static const struct tbacqdqyhzjl cfwgnoydaeun[] = { { vazisqcodoyh, &hidgeduttqfu }, {NULL, NULL} };
 static const struct tbacqdqyhzjl fmqkqpymqyvi[] = { { egdktbtdutis, &eshpbeukhocu}, { egdktbtdutis, &sbdfzeccmaqu}, {NULL, NULL} };
@@ -906,7 +910,6 @@ static const struct tbacqdqyhzjl snczkqcpgjfu[] = { { egdktbtdutis, &euycpbrasfy
 static const struct tbacqdqyhzjl mjrcpzynekqf[] = { { bodjhjgyoxhi, &kbaewdibwotz}, {NULL, NULL} };
 static const struct tbacqdqyhzjl lijheqifumjh[] = { { bodjhjgyoxhi, &zmsfwvstmpzu}, {NULL, NULL} };
 static const struct tbacqdqyhzjl hzekdkbdrpvm[] = { { vazisqcodoyh, &euycpbrasfyv}, { egdktbtdutis, &edekzrzzumla}, { NULL, NULL} };
-static const struct tbacqdqyhzjl ydnuhcvrirma[] = { { egdktbtdutis, &vmmofgybaymv}, { egdktbtdutis, &kdmwvfqfqpll}, {NULL, NULL} };
 static const struct tbacqdqyhzjl jhhgzesmesgc[] = { { egdktbtdutis, &tupcabtzlxtu}, { egdktbtdutis, &soaylxabbvcp}, {NULL, NULL} };
 static const struct tbacqdqyhzjl ukusubqnfddc[] = { { lccydooawqqq, &sutoxatvacfq}, { egdktbtdutis, &vmmofgybaymv}, { egdktbtdutis, &kdmwvfqfqpll}, {NULL, NULL} };
 static const struct tbacqdqyhzjl snxzripxaitf[] = { { egdktbtdutis,	&hidgeduttqfu }, { egdktbtdutis,	&xnjxjpmsbrwq }, { egdktbtdutis,	&ouopuszxsrbb }, { egdktbtdutis,	&rmwjeiydhtdi }, {NULL, NULL} };
@@ -918,7 +921,6 @@ static const struct tbacqdqyhzjl etzpkrbcxmgi[] = { { egdktbtdutis,	&waaqmzabdnv
 static const struct tbacqdqyhzjl aszgewaorkyw[] = { { egdktbtdutis, &vtmpirjbpzyr}, {NULL, NULL} };
 static const struct tbacqdqyhzjl falpnhpaffep[] = { { lccydooawqqq, &juiwgoflmtxn}, { vazisqcodoyh, &zuvszjqpjpif}, {NULL, NULL} };
 static const struct tbacqdqyhzjl otmsnntvfxwn[] = { { egdktbtdutis, &xrzgzpnnyfot}, {NULL, NULL} };
-static const struct tbacqdqyhzjl kuyrhcxxyktb[] = { { vazisqcodoyh, &zuvszjqpjpif}, {NULL, NULL} };
 static const struct tbacqdqyhzjl tckarflpcrau[] = { { egdktbtdutis,	&ukqovkdbujkv }, { egdktbtdutis,	&asjlcfmntoqd }, {NULL, NULL} };
 static const struct tbacqdqyhzjl tcdmydkfkcqe[] = { { egdktbtdutis,	&hidgeduttqfu }, { egdktbtdutis,	&qauwuvtpflxi }, {NULL, NULL} };
 static const char* PREDEFINDED_NAMES[] = { "M96b (XIAOMI/TCL)", "M100b (SHINCO/SAMSUNG/ELECTROLUX)", "T102b (WHIRLPOOL/BOSCH/AIRWELL)", "M128b (FUJITSU/McQUAY/TICA)", "M56b (TRUMA)" };
@@ -932,8 +934,7 @@ static const uint8_t hfknxsttgfsv[] = {0x60, 0x00, 0x9e, 0xc8, 0x00, 0x04, 0x52,
 static const uint8_t psnpylibjrln[] = {0x64, 0x00, 0x02, 0x05, 0x2C, 0x04, 0xD5, 0x56, 0x01, 0x6C, 0x50, 0xD0, 0x12, 0x40, 0x0C};
 static const uint8_t wnpqrzpmwuxe[] = {0x66, 0x00, 0x1C, 0x14, 0x00, 0x00, 0x87, 0x05, 0x00, 0x00, 0x21, 0xC1, 0x40, 0x00, 0x08};
 static const uint8_t mahcizamphiz[] = {0x06, 0x01, 0x53, 0x04, 0x10, 0x04, 0x14, 0x10, 0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x44, 0x10, 0x04, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x50, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x25};
-static const uint8_t vqtbtbudkmsk[] = {0x38, 0x00, 0xE9, 0x0D, 0x10, 0x00, 0x00, 0x00, 0x06};
-static const bc7215DataVarPkt_t* shnklcxaqppa[] = { (bc7215DataVarPkt_t*)hfknxsttgfsv, (bc7215DataVarPkt_t*)psnpylibjrln, (bc7215DataVarPkt_t*)wnpqrzpmwuxe, (bc7215DataVarPkt_t*)mahcizamphiz, (bc7215DataVarPkt_t*)vqtbtbudkmsk };
+static const bc7215DataVarPkt_t* shnklcxaqppa[] = { (bc7215DataVarPkt_t*)hfknxsttgfsv, (bc7215DataVarPkt_t*)psnpylibjrln, (bc7215DataVarPkt_t*)wnpqrzpmwuxe, (bc7215DataVarPkt_t*)mahcizamphiz, (bc7215DataVarPkt_t*)ujetucyygowi };
 static const bc7215DataVarPkt_t* kwniwryzbdqn[] = { (bc7215DataVarPkt_t*)dljatqndcxoh, (bc7215DataVarPkt_t*)ojrcowjtbwry, (bc7215DataVarPkt_t*)uxrcelseenvr, (bc7215DataVarPkt_t*)vwkjjrvolqgh, (bc7215DataVarPkt_t*)ujetucyygowi };
 static const uint8_t kqhvphdpbtpb = sizeof(shnklcxaqppa)/sizeof(struct bc7215DataVarPkt_t*);
 static const uint8_t sroodvqdigbh[] = {0x23, 0xCB, 0x26};
@@ -1011,340 +1012,341 @@ static const extraValue_t hiloxabfxord = {.set={0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x
 static const extraValue_t rkaabhrcosee = {.set={0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, (const srbjiaxreyht*)&rvwpmredthnx}};
 static const extraValue_t kwukecrusnya = {.set={0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, (const srbjiaxreyht*)&bfynarpwhgxo}};
 static const extraValue_t ipinhabavepz = {.kbuoarkttzag={82, 13, 0, 0}};
-static const struct vsghnouiwbyk nqcbntpcorjm = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 134, {35,32,35,32}, { 0, 1, 0x0f, 0, qlbsybjbuuwq }, { 0, 0, 0x07, 0, hsuvxgtgltjj }, { 0x83, 2, 0x70, 4, vsldpvefbakr }, { 0, 0, 0x30, 4, dvtgclyxpwol }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, neblmufxjobh, &eftthwofcwcr };
-static const struct vsghnouiwbyk lavqdnlmfywx = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 67, {35,32,0,0}, { 0, 1, 0x0f, 0, qlbsybjbuuwq}, { 0, 0, 0x07, 0, hsuvxgtgltjj}, { 0, 0, 0x30, 4, tgvozcdkwizi}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vvivsaqmctsn, &eftthwofcwcr };
-static const struct vsghnouiwbyk uqxtkwpbvaef = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 35, {35,0,0,0}, { 0, 1, 0x0f, 0, qlbsybjbuuwq}, { 0, 0, 0x07, 0, hsuvxgtgltjj}, { 0, 0, 0x30, 4, tgvozcdkwizi}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk yhyihafcrqzf = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 216, {64,152,0,0}, { 1, 6, 0x1E, 1, qlbsybjbuuwq }, { 1, 5, 0x70, 4, nzrkfuvfonaq }, { 1, 8, 0xf0, 4, sodnmplfotvu }, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dyoerhuugkim, &flrccffprjxa };
-static const struct vsghnouiwbyk rdrmpuilokvu = { {0, 0, 0 , 0, 0, 0, 0}, 0x34, 43, {43,0,0,0}, { 0, 1, 0x0f, 0, qlbsybjbuuwq}, { 0, 0, 0x07, 0, hsuvxgtgltjj}, { 0, 0, 0x70, 4, ctwleblehvbl}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 9}, 3, 0x70}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk bbtufostpjbn = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 52, {52,0,0,0}, { 0, 5, 0x0f, 0, pqzbdwgjzgjg}, { 0, 0, 0x07, 0, fonpcaohdilk}, { 0, 0, 0x30, 4, ygdgsrknfpiy}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk axvbwdtfvhkc = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 52, {52,0,0,0}, { 0, 5, 0x0f, 0, pqzbdwgjzgjg}, { 0, 0, 0x07, 0, fumlhnuvtjti}, { 0, 0, 0x30, 4, tgvozcdkwizi}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk qsmxzwgieita = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 52, {52,0,0,0}, { 0, 5, 0x0f, 0, qlbsybjbuuwq}, { 0, 0, 0x07, 0, fumlhnuvtjti}, { 0, 0, 0x30, 4, tgvozcdkwizi}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk wufgaucrdccc = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 52, {52,0,0,0}, { 0, 5, 0x0f, 0, qlbsybjbuuwq}, { 0, 0, 0x07, 0, fumlhnuvtjti}, { 0, 0, 0x30, 4, ygdgsrknfpiy}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk dxwdteyifhxf = { {0, 1, 0, 0, 0, 1, 0}, 0x36, 64, {32, 32, 0, 0}, { 0, 2, 0x0f, 0, qlbsybjbuuwq}, { 0, 1, 0x07, 0, hsuvxgtgltjj}, { 0, 1, 0x30, 4, tgvozcdkwizi}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, romdggzovziq, NULL };
+static const struct vsghnouiwbyk nqcbntpcorjm = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 134, {35,32,35,32}, 1, 2, 3, 4, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, neblmufxjobh, &eftthwofcwcr };
+static const struct vsghnouiwbyk lavqdnlmfywx = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 67, {35,32,0,0}, 1, 2, 5, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vvivsaqmctsn, &eftthwofcwcr };
+static const struct vsghnouiwbyk uqxtkwpbvaef = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 35, {35,0,0,0}, 1, 2, 5, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk yhyihafcrqzf = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 216, {64,152,0,0}, 6, 7, 8, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (vixgnerqasdw+1), &flrccffprjxa };
+static const struct vsghnouiwbyk rdrmpuilokvu = { {0, 0, 0 , 0, 0, 0, 0}, 0x34, 43, {43,0,0,0}, 1, 2, 9, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 9}, 3, 0x70}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk bbtufostpjbn = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 52, {52,0,0,0}, 10, 11, 12, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk axvbwdtfvhkc = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 52, {52,0,0,0}, 10, 13, 5, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk qsmxzwgieita = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 52, {52,0,0,0}, 14, 13, 5, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk wufgaucrdccc = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 52, {52,0,0,0}, 14, 13, 12, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk dxwdteyifhxf = { {0, 1, 0, 0, 0, 1, 0}, 0x36, 64, {32, 32, 0, 0}, 15, 16, 17, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, romdggzovziq, NULL };
 static const struct fehyfyrgmlkh yhyzffwbghzj = {NULL, &dxwdteyifhxf, 1, 255};
-static const struct vsghnouiwbyk gcxkgmwfmkkv = { {0, 0, 0, 0, 0, 1, 0}, 0x34, 32, {32, 0, 0, 0}, { 0, 2, 0x0f, 0, qlbsybjbuuwq}, { 0, 1, 0x07, 0, hsuvxgtgltjj}, { 0, 1, 0x30, 4, tgvozcdkwizi}, { 0x80, 0, 0, 0, NULL}, &goquiopzgski, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, cxxqpwnfospn, NULL };
-static const struct vsghnouiwbyk tvyphljcxzkw = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 104, {104, 0, 0, 0}, { 0, 1, 0xf8, 3, jlxcxegylhom}, { 0, 6, 0xe0, 5, vfbfuutoazdp}, { 0, 4, 0xe0, 5, vukdbvtfigfk}, { 0, 11, 0x07, 0, tfnbefmjojvh}, &fhslhkxmjjqk, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 9, 0x20}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, &vhednltgggkl };
-static const struct vsghnouiwbyk kppvtjneyxhb = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 104, {104, 0, 0, 0}, { 0, 1, 0xf8, 3, jlxcxegylhom}, { 0, 6, 0xe0, 5, vfbfuutoazdp}, { 0, 4, 0xe0, 5, balsfqyllobd}, { 0, 11, 0x07, 0, tfnbefmjojvh}, &fhslhkxmjjqk, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 9, 0x20}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk cceakbeevmud = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 96, {96, 0, 0, 0}, { 0, 8, 0xff, 0, hzaxbgzfvbgn}, { 0, 0, 0xf0, 4, tajyfdalqtrk}, { 0, 9, 0x03, 0, tgvozcdkwizi}, { 0, 0, 0x07, 0, jprvapuookmy}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk xeqmegjnmmpr = { {1, 1, 0, 0, 0, 0, 0}, 0x36, 144, {72, 72, 0, 0}, { 0, 5, 0xf0, 4, pqzbdwgjzgjg}, { 0, 6, 0x07, 0, vdgjgcoiublr}, { 0, 6, 0xC0, 6, tgvozcdkwizi}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 6, 0x06}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, fwastflmujzt, NULL };
-static const struct vsghnouiwbyk zkopkesbzzkw = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 120, {120, 0, 0, 0}, { 0, 1, 0x1f, 0, nemjsunvswft }, { 0, 4, 0x70, 4, aegickjxmxsj }, { 0, 4, 0x03, 0, gwmvscjwshzk }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 5, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, trsclbhfsdgr, &tkrayuuyqcxh };
-static const struct vsghnouiwbyk kaskusfbgaxm = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, { 0, 7, 0x0f, 0, auwyugwmwlso }, { 0, 6, 0x0f, 0, niaotlqdftsv }, { 0, 8, 0x07, 0, xknpcbptryfb }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, &nbadiwmcydfa };
-static const struct vsghnouiwbyk vxpodajlcgua = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, { 0, 7, 0x0f, 0, auwyugwmwlso }, { 0, 6, 0x0f, 0, niaotlqdftsv }, { 0, 8, 0x07, 0, xknpcbptryfb }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, &sybcvgmdylst };
-static const struct vsghnouiwbyk ljfouolbospn = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, { 0, 7, 0x0f, 0, evrgvsxldwse }, { 0, 6, 0x0f, 0, niaotlqdftsv }, { 0, 8, 0x07, 0, xknpcbptryfb }, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk zpfemwcmdlhc = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, { 0, 7, 0x0f, 0, auwyugwmwlso }, { 0, 6, 0x0f, 0, niaotlqdftsv }, { 0, 8, 0x07, 0, xzzewdxxicyp }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, &vonnpwtehkpp };
-static const struct vsghnouiwbyk zaqvffklbcyp = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, { 0, 7, 0xff, 0, hmcmmhtpafcl }, { 0, 6, 0x0f, 0, niaotlqdftsv }, { 0, 8, 0x07, 0, xzzewdxxicyp }, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk gpqtamyqeqso = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 48, {48, 0, 0, 0}, { 0, 2, 0xf0, 4, auwyugwmwlso}, { 0, 2, 0x07, 0, umjxfsvzcsro}, { 0, 0, 0xe0, 5, zhfepltcdgom}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
-static const struct vsghnouiwbyk tzipwgwupqcm = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 48, {48, 0, 0, 0}, { 0, 2, 0xf0, 4, duzqslhlvrbd}, { 0, 2, 0x07, 0, bafqaozlnera}, { 0, 0, 0xe0, 5, qogdydoechiy}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
-static const struct vsghnouiwbyk rlfryyoglzrw = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 48, {48, 0, 0, 0}, { 0, 2, 0xf0, 4, duzqslhlvrbd}, { 0, 2, 0x07, 0, umjxfsvzcsro}, { 0, 0, 0xC0, 6, watlqftdktqz}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
-static const struct vsghnouiwbyk ebfnvsnflmhb = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 48, {48, 0, 0, 0}, { 0, 2, 0xf0, 4, duzqslhlvrbd}, { 0, 2, 0x07, 0, bafqaozlnera}, { 0, 0, 0xC0, 6, watlqftdktqz}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
-static const struct vsghnouiwbyk fbvhyfrcgtcj = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 48, {48, 0, 0, 0}, { 0, 2, 0xf0, 4, duzqslhlvrbd}, { 0, 2, 0x0f, 0, usdftdsdonen}, { 0, 0, 0xff, 0, cdtozclqdgpe}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
-static const struct vsghnouiwbyk xrytsfutulct = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 48, {48, 0, 0, 0}, { 0, 2, 0xf0, 4, duzqslhlvrbd}, { 0, 2, 0x07, 0, bafqaozlnera}, { 0, 0, 0xe0, 5, wiesewazwfjj}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
-static const struct vsghnouiwbyk lojhanzqocev = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 96, {48, 48, 0, 0}, { 0, 4, 0x0f, 0, zmuhmziggshb }, { 0, 4, 0x30, 4, xramcvgpilnw }, { 0, 2, 0x07, 0, mctpbidjvrsb }, { 0, 0, 0, 0, NULL}, &jtfyeafstjuo, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 8}, 2, 0xde}, .xdvjpfttnymn.umavhyptrjjy = {{0, 8}, 4, 0x07}}, furfqjhejfgv, &uaqqeyvvobhp };
-static const struct vsghnouiwbyk ynhxmgxuetst = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 160, {56, 104, 0, 0}, { 1, 9, 0xFE, 1, xgmfromrdrwl }, { 1, 5, 0x70, 4, cmvjkmxfoogt }, { 1, 10, 0x0f, 0, sodnmplfotvu }, { 0, 0, 0, 0, NULL}, &nxrdhuyhzxrv, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dyoerhuugkim, NULL };
-static const struct vsghnouiwbyk lnixlwqvlojn = { {0, 1, 0, 0 ,0, 0, 0}, 0x36, 216, {64, 152, 0, 0}, { 1, 6, 0xfe, 1, dirmsniyzxmk }, { 1, 5, 0x70, 4, nzrkfuvfonaq}, { 1, 8, 0xf0, 4, sodnmplfotvu}, { 0, 0, 0, 0, NULL}, &nxrdhuyhzxrv, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, vixgnerqasdw, &xzgukzrwqvln };
-static const struct vsghnouiwbyk iqdlpewgtvoz = { {0, 1, 0, 0, 0, 0, 0}, 0x33, 285, {5, 64, 64, 152}, { 3, 6, 0xfe, 1, dirmsniyzxmk }, { 3, 5, 0x70, 4, nzrkfuvfonaq }, { 3, 8, 0xf0, 4, sodnmplfotvu }, { 0, 0, 0, 0, NULL }, &nxrdhuyhzxrv, {.xdvjpfttnymn.yeltdjdwiegk = {{3, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{3, 9}, 9, 0x0f}}, tqokiavwcgfc, &gxwjutmejxvu };
-static const struct vsghnouiwbyk qzqgxblouioh = { {0, 0, 0, 0, 0, 0, 0}, 0x35, 128, {128, 0, 0, 0}, { 0, 0x83, 0xff, 0, hzaxbgzfvbgn }, { 0, 1, 0x70, 4, hsuvxgtgltjj }, { 0, 2, 0x03, 0, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &xcoulaxlqduq, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x0f}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, najmcimiaeia, NULL };
-static const struct vsghnouiwbyk vmqwdugblegd = { {0, 0, 0, 0, 0, 0, 0}, 0x35, 128, {128, 0, 0, 0}, { 0, 0x83, 0xff, 0, hzaxbgzfvbgn }, { 0, 1, 0x70, 4, hsuvxgtgltjj }, { 0, 2, 0x03, 0, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x0f}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, trsclbhfsdgr, NULL };
-static const struct vsghnouiwbyk zloqfhsmqelq = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, { 0, 0x1, 0x0f, 0, qlbsybjbuuwq }, { 0, 0, 0x70, 4, eertyilkoola }, { 0, 1, 0x30, 4, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 1}, 0, 0x07}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk tqovgenkcvjz = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, { 0, 0x1, 0x0f, 0, huxsncyaliwc }, { 0, 0, 0x70, 4, eertyilkoola }, { 0, 1, 0x70, 4, enfaqllpjsst }, { 0, 0, 0x0f, 0, awcyzokqylxb }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 1}, 0, 0x07}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk nrbveilpjfbw = { {1, 1, 0, 0, 0, 0, 0}, 0x35, 80, {40, 40, 0, 0}, { 0, 0x1, 0xff, 0, hzaxbgzfvbgn }, { 0x00, 0, 0x07, 0, ezdvwkrfawmx }, { 0, 0, 0x30, 6, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0,8},1,0x16}}, fqgiigpemcaz, NULL };
+static const struct vsghnouiwbyk gcxkgmwfmkkv = { {0, 0, 0, 0, 0, 1, 0}, 0x34, 32, {32, 0, 0, 0}, 15, 16, 17, 18, &goquiopzgski, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, cxxqpwnfospn, NULL };
+static const struct vsghnouiwbyk tvyphljcxzkw = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 104, {104, 0, 0, 0}, 19, 20, 21, 22, &fhslhkxmjjqk, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 9, 0x20}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), &vhednltgggkl };
+static const struct vsghnouiwbyk kppvtjneyxhb = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 104, {104, 0, 0, 0}, 19, 20, 23, 22, &fhslhkxmjjqk, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 9, 0x20}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk cceakbeevmud = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 96, {96, 0, 0, 0}, 24, 25, 26, 27, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk xeqmegjnmmpr = { {1, 1, 0, 0, 0, 0, 0}, 0x36, 144, {72, 72, 0, 0}, 28, 29, 30, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 6, 0x06}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, fwastflmujzt, NULL };
+static const struct vsghnouiwbyk zkopkesbzzkw = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 120, {120, 0, 0, 0}, 31, 32, 33, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 5, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, trsclbhfsdgr, &tkrayuuyqcxh };
+static const struct vsghnouiwbyk kaskusfbgaxm = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, 34, 35, 36, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), &nbadiwmcydfa };
+static const struct vsghnouiwbyk vxpodajlcgua = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, 34, 35, 36, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), &sybcvgmdylst };
+static const struct vsghnouiwbyk ljfouolbospn = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, 37, 35, 36, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk zpfemwcmdlhc = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, 34, 35, 38, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), &vonnpwtehkpp };
+static const struct vsghnouiwbyk zaqvffklbcyp = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, 39, 35, 38, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk gpqtamyqeqso = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 48, {48, 0, 0, 0}, 40, 41, 42, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
+static const struct vsghnouiwbyk tzipwgwupqcm = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 48, {48, 0, 0, 0}, 43, 44, 45, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
+static const struct vsghnouiwbyk rlfryyoglzrw = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 48, {48, 0, 0, 0}, 43, 41, 46, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
+static const struct vsghnouiwbyk ebfnvsnflmhb = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 48, {48, 0, 0, 0}, 43, 44, 46, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
+static const struct vsghnouiwbyk fbvhyfrcgtcj = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 48, {48, 0, 0, 0}, 43, 47, 48, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
+static const struct vsghnouiwbyk xrytsfutulct = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 48, {48, 0, 0, 0}, 43, 44, 49, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
+static const struct vsghnouiwbyk lojhanzqocev = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 96, {48, 48, 0, 0}, 50, 51, 52, 0, &jtfyeafstjuo, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 8}, 2, 0xde}, .xdvjpfttnymn.umavhyptrjjy = {{0, 8}, 4, 0x07}}, furfqjhejfgv, &uaqqeyvvobhp };
+static const struct vsghnouiwbyk ynhxmgxuetst = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 160, {56, 104, 0, 0}, 53, 54, 55, 0, &nxrdhuyhzxrv, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (vixgnerqasdw+1), NULL };
+static const struct vsghnouiwbyk lnixlwqvlojn = { {0, 1, 0, 0 ,0, 0, 0}, 0x36, 216, {64, 152, 0, 0}, 56, 7, 8, 0, &nxrdhuyhzxrv, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, vixgnerqasdw, &xzgukzrwqvln };
+static const struct vsghnouiwbyk iqdlpewgtvoz = { {0, 1, 0, 0, 0, 0, 0}, 0x33, 285, {5, 64, 64, 152}, 57, 58, 59, 0, &nxrdhuyhzxrv, {.xdvjpfttnymn.yeltdjdwiegk = {{3, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{3, 9}, 9, 0x0f}}, tqokiavwcgfc, &gxwjutmejxvu };
+static const struct vsghnouiwbyk qzqgxblouioh = { {0, 0, 0, 0, 0, 0, 0}, 0x35, 128, {128, 0, 0, 0}, 60, 61, 62, 0, &xcoulaxlqduq, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x0f}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, najmcimiaeia, NULL };
+static const struct vsghnouiwbyk vmqwdugblegd = { {0, 0, 0, 0, 0, 0, 0}, 0x35, 128, {128, 0, 0, 0}, 60, 61, 62, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x0f}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, trsclbhfsdgr, NULL };
+static const struct vsghnouiwbyk zloqfhsmqelq = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, 1, 63, 64, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 1}, 0, 0x07}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk tqovgenkcvjz = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, 65, 63, 66, 67, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 1}, 0, 0x07}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk nrbveilpjfbw = { {1, 1, 0, 0, 0, 0, 0}, 0x35, 80, {40, 40, 0, 0}, 68, 69, 70, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0,8},1,0x16}}, (fwastflmujzt+1), NULL };
 static const struct fehyfyrgmlkh xrcfyxoultdq = {NULL, &nrbveilpjfbw, 1, 165};
-static const struct vsghnouiwbyk zdmoxydkfenc = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, { 0, 0x1, 0xff, 0, hzaxbgzfvbgn }, { 0, 0, 0x07, 0, ezdvwkrfawmx }, { 0, 0, 0x30, 4, tgvozcdkwizi }, { 0x80, 0, 0, 0, NULL }, &ancqczfcjgbu, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0,8},1,0x16}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk nemfndaxmwgo = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 56, {56, 0, 0, 0}, { 0, 0x1, 0x0f, 0, huxsncyaliwc }, { 0, 2, 0x60, 5, hsuvxgtgltjj }, { 0, 3, 0xc0, 6, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk ahoqbmpvzfaz = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 64, {64, 0, 0, 0}, { 0, 0x0, 0xff, 0, klgznqqxptrf }, { 0, 4, 0xf0, 4, gzwyyudcsgwr }, { 0, 7, 0x0f, 0, mqgcthvkvikd }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, olhrfncspuea, NULL };
-static const struct vsghnouiwbyk ahtjazfgxldu = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 64, {32,32,0,0}, { 0, 2, 0x0f, 0, qlbsybjbuuwq }, { 0, 0, 0x0f, 0, gpjvwopzumaf }, { 0, 2, 0xf0, 4, xoikkvjtpeyh }, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, twbcxiqkpyzk, NULL };
-static const struct vsghnouiwbyk ucprgxlmtvlr = { {0, 1, 0, 0, 0, 1, 0}, 0x32, 128, {32, 32, 32, 32}, { 0, 0x0, 0x0f, 0, huxsncyaliwc }, { 0x00, 2, 0x07, 0, ajxmlmqzwxcy }, { 0, 0, 0xf0, 4, buuehtaguyng }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, mbtdrqfkrhlf, NULL };
-static const struct vsghnouiwbyk qxlwosojboju = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 120, {120, 0, 0, 0}, { 0, 0x2, 0x0f, 0, qlbsybjbuuwq }, { 0x00, 10, 0x07, 0, lcfcdrxiqyzz }, { 0, 4, 0x70, 4, gezfbtusiggj }, { 0, 12, 0x07, 0, pipnpmrpkedm }, &umhmwualpgpc, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 3, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rhpoedahrstb, NULL };
-static const struct vsghnouiwbyk amocaoutzpci = { {1, 0, 1, 0, 0, 0, 0}, 0x30, 144, {48, 48, 48, 0}, { 0, 4, 0xf0, 4, mmaikokpzmiv }, { 0x00, 4, 0x0c, 2, rwxhlwtqcuxy }, { 0x80, 2, 0xe0, 5, oobbdzmmtido }, { 2, 1, 0xff, 0, dijowucrnhyr }, &jtfyeafstjuo, {.jylyhhlxgchq = (const bc7215DataVarPkt_t*)abgtrwyfidmh}, bhkyctzmvica, &sdjjmyazaobd };
-static const struct vsghnouiwbyk tinqbldkzibi = { {1, 0, 1, 0, 0, 0, 0}, 0x30, 144, {48, 48, 48, 0}, { 0, 4, 0xf0, 4, mmaikokpzmiv }, { 0x00, 4, 0x0c, 2, rwxhlwtqcuxy }, { 0x80, 2, 0xe0, 5, rxjkcgzrlsjg }, { 2, 1, 0xff, 0, khirzhpliszk }, &jtfyeafstjuo, {.jylyhhlxgchq = (const bc7215DataVarPkt_t*)abgtrwyfidmh}, bhkyctzmvica, NULL };
-static const struct vsghnouiwbyk xkezaitiqdge = { {0, 0, 1, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, { 0, 3, 0xf0, 4, rnzkhkybayht }, { 0x00, 1, 0x70, 4, hsuvxgtgltjj }, { 0x40, 3, 0xf0, 4, mqgcthvkvikd }, { 0, 3, 0x0f, 0, asymsdykfyoh }, &pgplrbrnambo, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)lrehdpmkgtmn}, ebahprebnmen, NULL };
-static const struct vsghnouiwbyk woieapgobeld = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 88, {88, 0, 0, 0}, { 0, 1, 0x0f, 0, qlbsybjbuuwq }, { 0x80, 0, 0x0f, 0, kfznlnimdous }, { 0, 0, 0x30, 4, tgvozcdkwizi }, { 0, 4, 0x40, 6, pvaqlkvrylaf }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk btzfcptiiggh = { {0, 1, 0, 0, 0, 0, 0}, 0x3e, 129, {64, 65, 0, 0}, { 0, 2, 0x1e, 1, qlbsybjbuuwq }, { 0x0, 1, 0x07, 0, shqsgblklcuc }, { 0, 1, 0x70, 4, mveqqstfduyf }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x30}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 5, 0xc0}}, uttppbcvqthg, NULL };
-static const struct vsghnouiwbyk tppabwmpfsci = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 84, {84, 0, 0, 0}, { 0, 1, 0x0f, 0, qlbsybjbuuwq }, { 0x0, 0, 0x70, 4, fumlhnuvtjti }, { 0, 1, 0x30, 4, tgvozcdkwizi }, { 0, 0, 0x07, 0, vczurmymtuxp }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk jcfjaasgehsc = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 88, {88, 0, 0, 0}, { 0, 1, 0x0f, 0, qlbsybjbuuwq }, { 0x0, 0, 0x70, 4, wrcxnynhcibi }, { 0, 1, 0x30, 4, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 1}, 0, 0x0f}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk dwfwqcqaetxc = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 80, {80, 0, 0, 0}, { 0, 1, 0x0f, 0, huxsncyaliwc }, { 0x0, 0, 0x70, 4, fumlhnuvtjti }, { 0, 1, 0x30, 4, ygdgsrknfpiy }, { 0, 0, 0x07, 0, vczurmymtuxp }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk ucejhiuyefrv = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 88, {88, 0, 0, 0}, { 0, 1, 0x0f, 0, qlbsybjbuuwq }, { 0x0, 0, 0x70, 4, wrcxnynhcibi }, { 0, 1, 0x30, 4, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 1}, 0, 0x0f}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk bxqzmmiuriyv = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 84, {84, 0, 0, 0}, { 0, 1, 0x0f, 0, qlbsybjbuuwq }, { 0x0, 0, 0x70, 4, fumlhnuvtjti }, { 0, 1, 0x30, 4, ygdgsrknfpiy }, { 0, 0, 0x0f, 0, qkjrwmuzbyzt }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk eqerrehxcrry = { {1, 1, 0, 0, 0, 0, 0}, 0x30, 112, {16, 40, 16, 40}, { 1, 3, 0xf0, 4, qlbsybjbuuwq }, { 0x81, 0, 0xc0, 6, iquqznqnoydo }, { 1, 1, 0x30, 4, ygdgsrknfpiy }, { 0, 0, 0xc0, 6, ploddrlwbsqf }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 9}, 0, 0xc0}}, rruxbybbhcov, NULL };
-static const struct vsghnouiwbyk irfhqjyyjfex = { {0, 0, 1, 0, 0, 0, 0}, 0x37, 40, {40, 0, 0, 0}, { 0x40, 3, 0xf0, 4, qlbsybjbuuwq }, { 0x0, 1, 0x70, 4, hsuvxgtgltjj }, { 0, 3, 0xf0, 4, mqgcthvkvikd }, { 0, 3, 0x0f, 0, djntjwrzxoau }, &biyrtkflorjo, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)bivolxnzzmfi}, ebahprebnmen, NULL };
-static const struct vsghnouiwbyk rpujthbsfwef = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 64, {64, 0, 0, 0}, { 0, 3, 0x0f, 0, rlymjpnqwqxi }, { 0x0, 3, 0x70, 4, vdgjgcoiublr }, { 0, 2, 0x03, 0, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &lsawdfksfpqm, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk srxdyhqmibfa = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 112, {112, 0, 0, 0}, { 0, 1, 0xf0, 4, qlbsybjbuuwq }, { 0x0, 7, 0xe0, 5, vfbfuutoazdp }, { 0, 5, 0xe0, 5, vukdbvtfigfk }, { 0, 12, 0x07, 0, tfnbefmjojvh }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, &hotyxxcmorep };
-static const struct vsghnouiwbyk dhofleujcyqk = { {1, 1, 0, 0, 0, 0, 0}, 0x37, 160, {112, 48, 0, 0}, { 0, 1, 0xf0, 4, qlbsybjbuuwq }, { 0x0, 7, 0xe0, 5, vfbfuutoazdp }, { 0, 5, 0xe0, 5, vukdbvtfigfk }, { 0, 12, 0x07, 0, tfnbefmjojvh }, &sealknfmgbfa, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 9}, 10, 0x10}}, vixgnerqasdw, NULL };
-static const struct vsghnouiwbyk fgmnwssblgaj = { {1, 1, 0, 0, 0, 0, 0}, 0x37, 160, {112, 48, 0, 0}, { 0, 1, 0xf0, 4, qlbsybjbuuwq }, { 0x0, 7, 0xe0, 5, vfbfuutoazdp }, { 0, 5, 0xe0, 5, vukdbvtfigfk }, { 0, 12, 0x07, 0, tfnbefmjojvh }, &aqtkpryarvtb, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 9}, 10, 0x10}}, vixgnerqasdw, NULL };
-static const struct vsghnouiwbyk xgptoowiyydc = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 72, {72, 0, 0, 0}, { 0, 0x1, 0xf0, 4, qlbsybjbuuwq }, { 0x0, 6, 0xf0, 4, rnuwicqokfnq }, { 0, 5, 0xc0, 6, ygdgsrknfpiy }, { 0, 1, 0x07, 0, dhljfflougxp }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, &gxanzhyuafjw };
-static const struct vsghnouiwbyk ewjtujleqbzy = { {1, 1, 0, 0, 0, 0, 0}, 0x37, 136, {112, 24, 0, 0}, { 0, 1, 0xf0, 4, qlbsybjbuuwq }, { 0x0, 7, 0xe0, 5, vfbfuutoazdp }, { 0, 5, 0xe0, 5, vukdbvtfigfk }, { 0, 12, 0x07, 0, tfnbefmjojvh }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk hyhmmikyarju = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 88, {88, 0, 0, 0}, { 0, 1, 0xf0, 4, qlbsybjbuuwq }, { 0x0, 6, 0xe0, 5, owzoglwzsxda }, { 0, 5, 0xe0, 5, dyzevacnxdjd }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk sjcrexjwrwdo = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 88, {88, 0, 0, 0}, { 0, 1, 0xf0, 4, qlbsybjbuuwq }, { 0x0, 6, 0xe0, 5, owzoglwzsxda }, { 0, 4, 0xe0, 5, vukdbvtfigfk }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, yidkopkslqak, NULL };
-static const struct vsghnouiwbyk zgncyrorazyy = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 52, {52, 0, 0, 0}, { 0, 5, 0x0f, 0, qlbsybjbuuwq }, { 0x0, 5, 0x70, 4, ybuezpmusfwy }, { 0, 4, 0x07, 0, eobqxjqhbanf }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 9}, 0, 0x02}}, byrdqdaczwxz, NULL };
-static const struct vsghnouiwbyk bhflfavdejpw = { {1, 1, 0, 0, 0, 0 ,0}, 0x37, 64, {16, 48, 0, 0}, { 1, 3, 0xf0, 4, qlbsybjbuuwq }, { 1, 5, 0xe0, 5, yzpeqodnfhra }, { 1, 1, 0x30, 4, tfyyqgwxvmya }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, bkdtbokwxvif, NULL };
-static const struct vsghnouiwbyk azbagyhwbkam = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 112, {112, 0, 0, 0}, { 0, 1, 0xf0, 4, qlbsybjbuuwq }, { 0x0, 4, 0xFF, 0, tjbeparnujnx }, { 0, 5, 0xe0, 5, vukdbvtfigfk }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 8}, 12, 5}}, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk swengmrqfiyi = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 112, {112, 0, 0, 0}, { 0, 1, 0xf0, 4, qlbsybjbuuwq }, { 0x0, 7, 0xe0, 5, vfbfuutoazdp }, { 0, 5, 0xe0, 5, vukdbvtfigfk }, { 0, 12, 0x0f, 0, zkbfjyvupcpk }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 4, 0x2f}}, rktudivhsjgb, NULL };
-static const struct vsghnouiwbyk nfbkkzawavpt = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 112, {112, 0, 0, 0}, { 0, 1, 0xf0, 4, qlbsybjbuuwq }, { 0x0, 7, 0xe0, 5, vfbfuutoazdp }, { 0, 5, 0xe0, 5, vukdbvtfigfk }, { 0, 12, 0x0f, 0, zkbfjyvupcpk }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0xf0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 4, 6}}, dlpifexbyqlw, NULL };
-static const struct vsghnouiwbyk bhpjvcjfkgvb = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 64, {32, 32, 0, 0}, { 0, 2, 0x0f, 0, qlbsybjbuuwq }, { 0x0, 2, 0x70, 4, nbgcalmcrydn }, { 0, 1, 0x30, 4, watlqftdktqz }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dsuxtremdabv, NULL };
-static const struct vsghnouiwbyk stftccshxgnw = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 136, {136, 0, 0, 0}, { 0, 0x46, 0xFF, 0, nuyihfymrlxy }, { 0x0, 5, 0xf0, 4, txsbffnaanwl }, { 0, 5, 0x0f, 0, obqdvlxymdam }, { 0, 0, 0, 0, NULL }, &uwamrtxlewym, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 8, 0x20}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, vqivsbeaooll, NULL };
-static const struct vsghnouiwbyk cqnelpafgwig = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 28, {28, 0, 0, 0}, { 0, 2, 0xf0, 4, huxsncyaliwc }, { 0, 1, 0x07, 0, ygcjwyoxujmy }, { 0, 2, 0x07, 0, qtpbyvcfejdx }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, rjvlmqcbgtfl, &isxavciifnyk };
-static const struct vsghnouiwbyk nzdbxyzkviod = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 96, {96, 0, 0, 0}, { 0, 8, 0x0f, 0, auwyugwmwlso }, { 0x0, 8, 0xe0, 5, bafqaozlnera }, { 0, 6, 0x60, 5, watlqftdktqz }, { 0, 4, 0x07, 0, obdcmcvhlbdy }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 6, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 4, 0x07}}, vjmyvdqynrdc, NULL };
-static const struct vsghnouiwbyk rhprqrmokjlb = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 96, {96, 0, 0, 0}, { 0, 8, 0x0f, 0, auwyugwmwlso }, { 0x0, 8, 0xe0, 5, bafqaozlnera }, { 0, 6, 0x60, 5, watlqftdktqz }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 6, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 4, 0x07}}, vjmyvdqynrdc, NULL };
-static const struct vsghnouiwbyk ezsuqdpbzkob = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 96, {96, 0, 0, 0}, { 0, 8, 0x0f, 0, auwyugwmwlso }, { 0x0, 4, 0x07, 0, skpwqtbrungz }, { 0, 6, 0x60, 5, watlqftdktqz }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 6, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 4, 0x07}}, vjmyvdqynrdc, NULL };
-static const struct vsghnouiwbyk htzcsdyeeraq = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 96, {96, 0, 0, 0}, { 0, 8, 0x0f, 0, auwyugwmwlso }, { 0x0, 8, 0xe0, 5, bafqaozlnera }, { 0, 6, 0xe0, 5, qogdydoechiy }, { 0, 4, 0x07, 0, obdcmcvhlbdy }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 6, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 4, 0x07}}, vjmyvdqynrdc, NULL };
-static const struct vsghnouiwbyk uatfwllghqdo = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 168, {16, 96, 56, 0}, { 1, 1, 0xf0, 4, aekximikujqn }, { 1, 1, 0x07, 0, einaxguqxgdv }, { 1, 0, 0x03, 0, ygdgsrknfpiy }, { 2, 1, 0xff, 0, bxstpkifthlt }, &ygodycsenfrr, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dvlmbpsinqoo, &ymzofyqomcwt };
-static const struct vsghnouiwbyk zjaazwkayftb = { {0, 1, 0, 0, 0, 1, 0}, 0x37, 112, {16, 96, 0, 0}, { 1, 1, 0xf0, 4, aekximikujqn }, { 1, 1, 0x07, 0, einaxguqxgdv }, { 1, 0, 0x03, 0, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 0, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, lrwothecqnqk, NULL };
-static const struct vsghnouiwbyk hzvlxeswzobp = { {0, 1, 0, 0 ,0, 0 ,0}, 0x34, 184, {24, 160, 0, 0}, { 1, 3, 0xff, 0, ybxjhnxfyjgb }, { 1, 0, 0x3f, 0, cxsyqmosciuu }, { 1, 1, 0xff, 0, lhegdqcihvky }, { 1, 16, 0xff, 0, zbzgguwefrup }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, lrwothecqnqk, NULL };
-static const struct vsghnouiwbyk vneficeevhug = { {0, 0, 0, 0, 0, 1, 0}, 0x34, 48, {48, 0, 0, 0}, { 0, 3, 0xf0, 4, aekximikujqn }, { 0, 3, 0x07, 0, einaxguqxgdv }, { 0, 2, 0x03, 0, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, &gxanzhyuafjw };
-static const struct vsghnouiwbyk dgilrfxeerlc = { {0, 0, 0, 0, 0, 1, 0}, 0x34, 48, {48, 0, 0, 0}, { 0, 3, 0xf0, 4, qlbsybjbuuwq }, { 0, 3, 0x07, 0, einaxguqxgdv }, { 0, 2, 0x03, 0, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct sxpegamfsrfd voimbfxlagws = { .cssjkjaqtock = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 168, {24, 144, 0, 0}, { 1, 12, 0xfe, 1, vmrjepqklhrp }, { 1, 14, 0x0f, 0, ollwywbmbdun }, { 1, 14, 0xf0, 4, riybiayodery }, { 1, 8, 0x0f, 0, zgmshkbdxzgj }, &olbtwhlypieh, {.dmfwafbbczce = nexkiawgsmhd}, wiuiioibmfwg, &yqpnditmwonr }, .hffaidvvtesl = ollwywbmbdun };
-static const struct vsghnouiwbyk fvcrjmuwsxkv = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 136, {24, 112, 0, 0}, { 0x41, 12, 0xfe, 1, vmrjepqklhrp }, { 0x61, 12, 0x0f, 0, (const uint8_t*)&voimbfxlagws }, { 1, 12, 0xf0, 4, riybiayodery }, { 1, 8, 0x0f, 0, zgmshkbdxzgj }, &ebzbioplqjmm, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)qvuqtkbvujjo}, wiuiioibmfwg, &yqpnditmwonr };
-static const struct vsghnouiwbyk beoemlhmiccv = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, { 0, 1, 0x1f, 0, nemjsunvswft }, { 0, 4, 0x30, 4, bbdoduitrwbi }, { 0, 4, 0x03, 0, gwmvscjwshzk }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 5, 0x40}}, trsclbhfsdgr, &gxanzhyuafjw };
-static const struct vsghnouiwbyk pneqdrabhsuz = { {0, 0, 0, 0, 0, 1, 0}, 0x34, 56, {56, 0, 0, 0}, { 0, 3, 0xf0, 4, aekximikujqn }, { 0, 3, 0x07, 0, einaxguqxgdv }, { 0, 2, 0x03, 0, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk kghadgokegob = { {0, 0, 0, 0, 0, 1, 0}, 0x34, 56, {56, 0, 0, 0}, { 0, 3, 0xf0, 4, aekximikujqn }, { 0, 3, 0x07, 0, einaxguqxgdv }, { 0, 2, 0x03, 0, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, &sjktkrmdodrd };
-static const struct vsghnouiwbyk ncxukazluhfy = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, { 0, 1, 0x1f, 0, nemjsunvswft }, { 0x80, 4, 0x30, 4, bbdoduitrwbi }, { 0, 4, 0x03, 0, gwmvscjwshzk }, { 0, 2, 0xff, 0, ggppmvgyklcq }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 5, 0x40}}, trsclbhfsdgr, NULL };
-static const struct vsghnouiwbyk htuklbdisezz = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 84, {84, 0, 0, 0}, { 0, 1, 0x0f, 0, qlbsybjbuuwq }, { 0x0, 0, 0x70, 4, fumlhnuvtjti }, { 0, 1, 0x30, 4, tgvozcdkwizi }, { 0, 0, 0x0f, 0, qkjrwmuzbyzt }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk omblkccmiqyr = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 84, {84, 0, 0, 0}, { 0, 1, 0x0f, 0, aekximikujqn }, { 0x0, 0, 0x70, 4, fumlhnuvtjti }, { 0, 1, 0x30, 4, tgvozcdkwizi }, { 0, 0, 0x0f, 0, qkjrwmuzbyzt }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk sonenrionuiu = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 48, {48, 0, 0, 0}, { 0, 1, 0x1f, 0, nemjsunvswft }, { 0x80, 4, 0x30, 4, kzndtcqngbci }, { 0, 4, 0x03, 0, gwmvscjwshzk }, { 0, 2, 0x10, 4, cztawhzyjhpm }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3},5, 0x04}}, olhrfncspuea, &uaqqeyvvobhp };
-static const struct vsghnouiwbyk ewfrcrrklmuk = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, { 0, 1, 0x1f, 0, nemjsunvswft }, { 0x80, 4, 0x30, 4, bbdoduitrwbi }, { 0, 4, 0x0c, 2, gwmvscjwshzk }, { 0, 2, 0xff, 0, pdymzidejhjm }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 5, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 9}, 5, 0x80}}, trsclbhfsdgr, NULL };
-static const struct vsghnouiwbyk wglwzvhacgmn = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 48, {48, 0, 0, 0}, { 0, 1, 0x1f, 0, nemjsunvswft }, { 0x80, 4, 0x30, 4, bbdoduitrwbi }, { 0, 4, 0x03, 0, gwmvscjwshzk }, { 0, 2, 0x10, 4, cztawhzyjhpm }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 9}, 1, 0x02}}, olhrfncspuea, NULL };
-static const struct vsghnouiwbyk rszgjuhrfwgm = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, { 0, 7, 0x0f, 0, auwyugwmwlso }, { 0, 6, 0x0f, 0, niaotlqdftsv }, { 0, 8, 0x07, 0, xknpcbptryfb }, { 0, 12, 0xff, 0, qdwabnumooho}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, &ksrayuarwjtj };
-static const struct vsghnouiwbyk gmcpklxaurat = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 113, {113, 0, 0, 0}, { 0, 7, 0x0f, 0, auwyugwmwlso}, { 0, 6, 0x0f, 0, niaotlqdftsv}, { 0, 8, 0x07, 0, xknpcbptryfb}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, wleslucdzswj, NULL };
-static const struct vsghnouiwbyk alhjruiazrwi = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 168, {56, 56, 56, 0}, { 0, 5, 0x0f, 0, qlbsybjbuuwq }, { 0, 5, 0xf0, 4, jnwrrmemhpqv }, { 0, 3, 0x03, 0, tgvozcdkwizi }, { 0, 5, 0x20, 5, zemiirzsdbky }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, ikrgztxhbhme, NULL };
-static const struct vsghnouiwbyk dzosszksdzoo = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, { 0, 7, 0x0f, 0, auwyugwmwlso }, { 0x80, 6, 0x0f, 0, niaotlqdftsv }, { 0, 8, 0x07, 0, xknpcbptryfb }, { 0, 8, 0xf8, 0, aobugicxmdfl }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk myjcflmkkgsc = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 168, {56, 56, 56, 0}, { 0, 5, 0x0f, 0, qlbsybjbuuwq }, { 0, 5, 0xf0, 4, gzobhywjwzgu }, { 0, 3, 0x03, 0, ygdgsrknfpiy }, { 0, 5, 0x20, 5, zemiirzsdbky }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, ikrgztxhbhme, NULL };
-static const struct vsghnouiwbyk ukpfcrfhrgug = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, { 0, 1, 0xff, 0, pyxakjclofwa }, { 0, 0, 0x07, 0, fumlhnuvtjti }, { 0, 2, 0x03, 0, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk kqrwyfcvgnlz = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, { 0, 1, 0x0f, 0, huxsncyaliwc }, { 0, 0, 0x07, 0, fumlhnuvtjti }, { 0, 2, 0x03, 0, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk paeqqjdsrfnt = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, { 0, 1, 0x0f, 0, qlbsybjbuuwq }, { 0, 0, 0x70, 4, fumlhnuvtjti }, { 0, 1, 0x30, 4, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 1}, 0, 0x87}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk dbjsltpmbgoq = { {1, 0, 0, 1, 0, 0, 0}, 0x34, 96, {96, 0, 0, 0}, { 0, 7, 0x1e, 1, qlbsybjbuuwq }, { 0, 5, 0x07, 0, hsuvxgtgltjj }, { 0, 6, 0xff, 0, roldsnmewkty }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, rhpoedahrstb, NULL };
-static const struct vsghnouiwbyk xttfnmbgjwal = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 224, {112, 112, 0, 0}, { 1, 7, 0x0f, 0, auwyugwmwlso }, { 1, 6, 0x0f, 0, niaotlqdftsv }, { 0x01, 8, 0x07, 0, xknpcbptryfb }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1,9},5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, dyoerhuugkim, &zzpndcuiqygi };
-static const struct vsghnouiwbyk wyksgpticuwi = { {1, 1, 0, 0, 0, 0, 0}, 0x35, 88, {44, 44, 0, 0}, { 0, 0x1, 0xff, 0, hzaxbgzfvbgn }, { 0x00, 0, 0x07, 0, ezdvwkrfawmx }, { 0, 0, 0x30, 4, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, fqgiigpemcaz, NULL };
+static const struct vsghnouiwbyk zdmoxydkfenc = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, 68, 69, 5, 18, &ancqczfcjgbu, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0,8},1,0x16}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk nemfndaxmwgo = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 56, {56, 0, 0, 0}, 65, 71, 72, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk ahoqbmpvzfaz = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 64, {64, 0, 0, 0}, 73, 74, 75, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, olhrfncspuea, NULL };
+static const struct vsghnouiwbyk ahtjazfgxldu = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 64, {32,32,0,0}, 15, 76, 77, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, twbcxiqkpyzk, NULL };
+static const struct vsghnouiwbyk ucprgxlmtvlr = { {0, 1, 0, 0, 0, 1, 0}, 0x32, 128, {32, 32, 32, 32}, 78, 79, 80, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, mbtdrqfkrhlf, NULL };
+static const struct vsghnouiwbyk qxlwosojboju = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 120, {120, 0, 0, 0}, 15, 81, 82, 83, &umhmwualpgpc, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 3, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rhpoedahrstb, NULL };
+static const struct vsghnouiwbyk amocaoutzpci = { {1, 0, 1, 0, 0, 0, 0}, 0x30, 144, {48, 48, 48, 0}, 84, 85, 86, 87, &jtfyeafstjuo, {.jylyhhlxgchq = (const bc7215DataVarPkt_t*)abgtrwyfidmh}, bhkyctzmvica, &sdjjmyazaobd };
+static const struct vsghnouiwbyk tinqbldkzibi = { {1, 0, 1, 0, 0, 0, 0}, 0x30, 144, {48, 48, 48, 0}, 84, 85, 88, 89, &jtfyeafstjuo, {.jylyhhlxgchq = (const bc7215DataVarPkt_t*)abgtrwyfidmh}, bhkyctzmvica, NULL };
+static const struct vsghnouiwbyk xkezaitiqdge = { {0, 0, 1, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, 90, 61, 91, 92, &pgplrbrnambo, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)lrehdpmkgtmn}, ebahprebnmen, NULL };
+static const struct vsghnouiwbyk woieapgobeld = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 88, {88, 0, 0, 0}, 1, 93, 5, 94, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk btzfcptiiggh = { {0, 1, 0, 0, 0, 0, 0}, 0x3e, 129, {64, 65, 0, 0}, 95, 96, 97, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x30}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 5, 0xc0}}, twbcxiqkpyzk, NULL };
+static const struct vsghnouiwbyk tppabwmpfsci = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 84, {84, 0, 0, 0}, 1, 98, 17, 99, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk jcfjaasgehsc = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 88, {88, 0, 0, 0}, 1, 100, 17, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 1}, 0, 0x0f}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk dwfwqcqaetxc = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 80, {80, 0, 0, 0}, 65, 98, 64, 99, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk ucejhiuyefrv = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 88, {88, 0, 0, 0}, 1, 100, 64, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 1}, 0, 0x0f}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk bxqzmmiuriyv = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 84, {84, 0, 0, 0}, 1, 98, 64, 101, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk eqerrehxcrry = { {1, 1, 0, 0, 0, 0, 0}, 0x30, 112, {16, 40, 16, 40}, 102, 103, 104, 105, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 9}, 0, 0xc0}}, rruxbybbhcov, NULL };
+static const struct vsghnouiwbyk irfhqjyyjfex = { {0, 0, 1, 0, 0, 0, 0}, 0x37, 40, {40, 0, 0, 0}, 106, 61, 107, 108, &biyrtkflorjo, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)bivolxnzzmfi}, ebahprebnmen, NULL };
+static const struct vsghnouiwbyk rpujthbsfwef = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 64, {64, 0, 0, 0}, 109, 110, 62, 0, &lsawdfksfpqm, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk srxdyhqmibfa = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 112, {112, 0, 0, 0}, 111, 112, 113, 114, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), &hotyxxcmorep };
+static const struct vsghnouiwbyk dhofleujcyqk = { {1, 1, 0, 0, 0, 0, 0}, 0x37, 160, {112, 48, 0, 0}, 111, 112, 113, 114, &sealknfmgbfa, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 9}, 10, 0x10}}, vixgnerqasdw, NULL };
+static const struct vsghnouiwbyk fgmnwssblgaj = { {1, 1, 0, 0, 0, 0, 0}, 0x37, 160, {112, 48, 0, 0}, 111, 112, 113, 114, &aqtkpryarvtb, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 9}, 10, 0x10}}, vixgnerqasdw, NULL };
+static const struct vsghnouiwbyk xgptoowiyydc = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 72, {72, 0, 0, 0}, 111, 115, 116, 117, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), &gxanzhyuafjw };
+static const struct vsghnouiwbyk ewjtujleqbzy = { {1, 1, 0, 0, 0, 0, 0}, 0x37, 136, {112, 24, 0, 0}, 111, 112, 113, 114, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk hyhmmikyarju = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 88, {88, 0, 0, 0}, 111, 118, 119, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk sjcrexjwrwdo = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 88, {88, 0, 0, 0}, 111, 118, 21, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, yidkopkslqak, NULL };
+static const struct vsghnouiwbyk zgncyrorazyy = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 52, {52, 0, 0, 0}, 14, 120, 121, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 9}, 0, 0x02}}, byrdqdaczwxz, NULL };
+static const struct vsghnouiwbyk bhflfavdejpw = { {1, 1, 0, 0, 0, 0 ,0}, 0x37, 64, {16, 48, 0, 0}, 102, 122, 123, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, bkdtbokwxvif, NULL };
+static const struct vsghnouiwbyk azbagyhwbkam = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 112, {112, 0, 0, 0}, 111, 124, 113, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 8}, 12, 5}}, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk swengmrqfiyi = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 112, {112, 0, 0, 0}, 111, 112, 113, 125, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 4, 0x2f}}, rktudivhsjgb, NULL };
+static const struct vsghnouiwbyk nfbkkzawavpt = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 112, {112, 0, 0, 0}, 111, 112, 113, 125, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0xf0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 4, 6}}, dlpifexbyqlw, NULL };
+static const struct vsghnouiwbyk bhpjvcjfkgvb = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 64, {32, 32, 0, 0}, 15, 126, 127, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (aduwdhgzncqz+1), NULL };
+static const struct vsghnouiwbyk stftccshxgnw = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 136, {136, 0, 0, 0}, 128, 129, 130, 0, &uwamrtxlewym, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 8, 0x20}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, vqivsbeaooll, NULL };
+static const struct vsghnouiwbyk cqnelpafgwig = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 28, {28, 0, 0, 0}, 131, 132, 133, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, rjvlmqcbgtfl, &isxavciifnyk };
+static const struct vsghnouiwbyk nzdbxyzkviod = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 96, {96, 0, 0, 0}, 134, 135, 136, 137, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 6, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 4, 0x07}}, vjmyvdqynrdc, NULL };
+static const struct vsghnouiwbyk rhprqrmokjlb = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 96, {96, 0, 0, 0}, 134, 135, 136, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 6, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 4, 0x07}}, vjmyvdqynrdc, NULL };
+static const struct vsghnouiwbyk ezsuqdpbzkob = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 96, {96, 0, 0, 0}, 134, 138, 136, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 6, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 4, 0x07}}, vjmyvdqynrdc, NULL };
+static const struct vsghnouiwbyk htzcsdyeeraq = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 96, {96, 0, 0, 0}, 134, 135, 139, 137, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 6, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 4, 0x07}}, vjmyvdqynrdc, NULL };
+static const struct vsghnouiwbyk uatfwllghqdo = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 168, {16, 96, 56, 0}, 140, 141, 142, 143, &ygodycsenfrr, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dvlmbpsinqoo, &ymzofyqomcwt };
+static const struct vsghnouiwbyk zjaazwkayftb = { {0, 1, 0, 0, 0, 1, 0}, 0x37, 112, {16, 96, 0, 0}, 140, 141, 142, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 0, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, lrwothecqnqk, NULL };
+static const struct vsghnouiwbyk hzvlxeswzobp = { {0, 1, 0, 0 ,0, 0 ,0}, 0x34, 184, {24, 160, 0, 0}, 144, 145, 146, 147, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, lrwothecqnqk, NULL };
+static const struct vsghnouiwbyk vneficeevhug = { {0, 0, 0, 0, 0, 1, 0}, 0x34, 48, {48, 0, 0, 0}, 148, 149, 150, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), &gxanzhyuafjw };
+static const struct vsghnouiwbyk dgilrfxeerlc = { {0, 0, 0, 0, 0, 1, 0}, 0x34, 48, {48, 0, 0, 0}, 151, 149, 150, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct sxpegamfsrfd voimbfxlagws = { .cssjkjaqtock = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 168, {24, 144, 0, 0}, 152, 153, 154, 155, &olbtwhlypieh, {.dmfwafbbczce = nexkiawgsmhd}, wiuiioibmfwg, &yqpnditmwonr }, .hffaidvvtesl = ollwywbmbdun };
+static const struct vsghnouiwbyk fvcrjmuwsxkv = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 136, {24, 112, 0, 0}, 156, 157, 158, 155, &ebzbioplqjmm, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)qvuqtkbvujjo}, wiuiioibmfwg, &yqpnditmwonr };
+static const struct vsghnouiwbyk beoemlhmiccv = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, 31, 159, 33, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 5, 0x40}}, trsclbhfsdgr, &gxanzhyuafjw };
+static const struct vsghnouiwbyk pneqdrabhsuz = { {0, 0, 0, 0, 0, 1, 0}, 0x34, 56, {56, 0, 0, 0}, 148, 149, 150, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk kghadgokegob = { {0, 0, 0, 0, 0, 1, 0}, 0x34, 56, {56, 0, 0, 0}, 148, 149, 150, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), &sjktkrmdodrd };
+static const struct vsghnouiwbyk ncxukazluhfy = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, 31, 160, 33, 161, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 5, 0x40}}, trsclbhfsdgr, NULL };
+static const struct vsghnouiwbyk htuklbdisezz = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 84, {84, 0, 0, 0}, 1, 98, 17, 101, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk omblkccmiqyr = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 84, {84, 0, 0, 0}, 162, 98, 17, 101, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk sonenrionuiu = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 48, {48, 0, 0, 0}, 31, 163, 33, 164, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3},5, 0x04}}, olhrfncspuea, &uaqqeyvvobhp };
+static const struct vsghnouiwbyk ewfrcrrklmuk = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, 31, 160, 165, 166, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 5, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 9}, 5, 0x80}}, trsclbhfsdgr, NULL };
+static const struct vsghnouiwbyk wglwzvhacgmn = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 48, {48, 0, 0, 0}, 31, 160, 33, 164, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 9}, 1, 0x02}}, olhrfncspuea, NULL };
+static const struct vsghnouiwbyk rszgjuhrfwgm = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, 34, 35, 36, 167, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), &ksrayuarwjtj };
+static const struct vsghnouiwbyk gmcpklxaurat = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 113, {113, 0, 0, 0}, 34, 35, 36, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, wleslucdzswj, NULL };
+static const struct vsghnouiwbyk alhjruiazrwi = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 168, {56, 56, 56, 0}, 14, 168, 169, 170, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, ikrgztxhbhme, NULL };
+static const struct vsghnouiwbyk dzosszksdzoo = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, 34, 171, 36, 172, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk myjcflmkkgsc = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 168, {56, 56, 56, 0}, 14, 173, 174, 170, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, ikrgztxhbhme, NULL };
+static const struct vsghnouiwbyk ukpfcrfhrgug = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, 175, 13, 150, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk kqrwyfcvgnlz = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, 65, 13, 150, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk paeqqjdsrfnt = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, 1, 98, 64, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 1}, 0, 0x87}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk dbjsltpmbgoq = { {1, 0, 0, 1, 0, 0, 0}, 0x34, 96, {96, 0, 0, 0}, 176, 177, 178, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, rhpoedahrstb, NULL };
+static const struct vsghnouiwbyk xttfnmbgjwal = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 224, {112, 112, 0, 0}, 179, 180, 181, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1,9},5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, (vixgnerqasdw+1), &zzpndcuiqygi };
+static const struct vsghnouiwbyk wyksgpticuwi = { {1, 1, 0, 0, 0, 0, 0}, 0x35, 88, {44, 44, 0, 0}, 68, 69, 5, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (fwastflmujzt+1), NULL };
 static const struct fehyfyrgmlkh lnxumgzntqwn = {NULL, &wyksgpticuwi, 1, 165};
-static const struct vsghnouiwbyk xocvywzuttti = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 44, {44, 0, 0, 0}, { 0, 0x1, 0xff, 0, hzaxbgzfvbgn }, { 0x00, 0, 0x07, 0, ezdvwkrfawmx }, { 0, 0, 0x30, 4, tgvozcdkwizi }, { 0x80, 0, 0, 0, NULL }, &lbldedfcqxoj, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk yeobnxyjvwij = { {0, 1, 0, 0, 0, 1, 0}, 0x37, 60, {20, 20, 20, 0}, { 0, 0x1, 0x0f, 0, imegbmhoswpz }, { 0x00, 1, 0x30, 4, zoxbzpgkrild }, { 0, 1, 0xc0, 6, bqkwjhxmdzlf }, { 0, 2, 0x0f, 0, wowphqlodpqt }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,9},0,0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, dikotbgrtiuo, NULL };
-static const struct vsghnouiwbyk hiwirhjbknsp = { {0, 1, 0, 0, 0, 1, 0}, 0x37, 60, {20, 20, 20, 0}, { 0, 0x1, 0x0f, 0, mscxujnqnuhc }, { 0x00, 1, 0x30, 4, zoxbzpgkrild }, { 0, 1, 0xc0, 6, bqkwjhxmdzlf }, { 0, 2, 0x0f, 0, bitfqvjznjnl }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,9},0,0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dikotbgrtiuo, NULL };
-static const struct vsghnouiwbyk pkozyrktbizw = { {0, 1, 0, 0, 0, 1, 0}, 0x37, 60, {20, 20, 20, 0}, { 0, 0x1, 0x0f, 0, mscxujnqnuhc }, { 0x00, 1, 0x30, 4, zoxbzpgkrild }, { 0, 1, 0xc0, 6, bqkwjhxmdzlf }, { 0, 2, 0x0f, 0, wowphqlodpqt }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,9},0,0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dikotbgrtiuo, NULL };
-static const struct vsghnouiwbyk fkblteeqdvec = { {0, 1, 0, 0, 0, 1, 0}, 0x37, 60, {20, 20, 20, 0}, { 0, 0x1, 0x0f, 0, yqfsdnalmyna }, { 0x00, 1, 0x30, 4, zoxbzpgkrild }, { 0, 1, 0xc0, 6, bqkwjhxmdzlf }, { 0, 2, 0x0f, 0, bitfqvjznjnl }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,9},0,0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dikotbgrtiuo, NULL };
-static const struct vsghnouiwbyk fndleauamszv = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 288, {144, 144, 0, 0}, { 0, 7, 0x0f, 0, qlbsybjbuuwq }, { 0x80, 6, 0x38, 3, qkzbyzcluece }, { 0, 9, 0x07, 0, ctwleblehvbl }, { 0, 8, 0x07, 0, fevrkzpoqnlu }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x20}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, wkhvrdgxemas, &vmsyeoerpcbo };
-static const struct vsghnouiwbyk zuvkfvvzyyvr = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 144, {144, 0, 0, 0}, { 0, 7, 0x0f, 0, qlbsybjbuuwq }, { 0x80, 6, 0x38, 3, qkzbyzcluece }, { 0, 9, 0x07, 0, ctwleblehvbl }, { 0, 8, 0x07, 0, fevrkzpoqnlu }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x20}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk mzcdqaqfysil = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 184, {40, 144, 0, 0}, { 1, 7, 0x0f, 0, auwyugwmwlso }, { 0x1, 6, 0x07, 0, qkzbyzcluece }, { 1, 8, 0x07, 0, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, dyoerhuugkim, NULL };
-static const struct vsghnouiwbyk yplqlejdjgfi = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 184, {40, 144, 0, 0}, { 1, 7, 0x0f, 0, qlbsybjbuuwq }, { 0x81, 6, 0x38, 3, niaotlqdftsv }, { 1, 9, 0x03, 0, tgvozcdkwizi }, { 1, 8, 0x07, 0, fevrkzpoqnlu }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x20}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, dyoerhuugkim, &iavlxfeyybjd };
-static const struct vsghnouiwbyk nvryyqqoomlz = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 88, {24, 64, 0, 0}, { 1, 6, 0xf0, 4, hnqfngbztkvd }, { 1, 6, 0x07, 0, bafqaozlnera }, { 1, 4, 0xe0, 5, aorqinwjsvvt }, { 0, 0, 0, 0, NULL }, &iixudukxafde, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 2, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{1,3},6,0x08}}, wiuiioibmfwg, NULL };
-static const struct vsghnouiwbyk hdxztezasnbk = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 136, {40, 48, 48, 0}, { 1, 1, 0xf0, 4, qlbsybjbuuwq }, { 1, 1, 0x07, 0, smlahnhsfqyk }, { 1, 2, 0x06, 1, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, tghubrggbsnn, &hpyguqhasgog };
-static const struct vsghnouiwbyk bztrmruvgbmz = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 136, {40, 48, 48, 0}, { 1, 0, 0x1e, 1, qlbsybjbuuwq }, { 1, 1, 0x07, 0, smlahnhsfqyk }, { 1, 2, 0x06, 1, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, tghubrggbsnn, &gsrnsfjloqer };
-static const struct vsghnouiwbyk letfeiyhgyvy = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 102, {51, 51, 0, 0}, { 0, 2, 0xf0, 4, auwyugwmwlso }, { 0, 1, 0x0f, 0, niaotlqdftsv }, { 0, 2, 0x07, 0, vsldpvefbakr }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x03}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, fqgiigpemcaz, &rrqwtapoxwws };
-static const struct vsghnouiwbyk wnjkpivtckvq = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 64, {64, 0, 0, 0}, { 0, 2, 0xf0, 4, duzqslhlvrbd }, { 0x0, 2, 0x07, 0, umjxfsvzcsro }, { 0, 0, 0x70, 4, tsasjsbzwxie }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, vjmyvdqynrdc, NULL };
-static const struct vsghnouiwbyk uhnrnfbmaaio = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 104, {24, 80, 0, 0}, { 1, 6, 0xf0, 4, nvtfnxgsqyky }, { 1, 6, 0x07, 0, bafqaozlnera }, { 1, 4, 0xe0, 5, aorqinwjsvvt }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 6, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, wiuiioibmfwg, NULL };
-static const struct vsghnouiwbyk dsiqvttdffga = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 104, {24, 80, 0, 0}, { 1, 6, 0xf0, 4, duzqslhlvrbd }, { 1, 6, 0x07, 0, bafqaozlnera }, { 1, 4, 0xe0, 5, aorqinwjsvvt }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 6, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, wiuiioibmfwg, NULL };
-static const struct vsghnouiwbyk jhuxbtudabwa = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 120, {24, 96, 0, 0}, { 1, 2, 0xf0, 4, duzqslhlvrbd }, { 1, 2, 0x07, 0, bafqaozlnera }, { 1, 8, 0x18, 3, souulsuvkqvp }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, wiuiioibmfwg, NULL };
-static const struct vsghnouiwbyk cwhedsgdrjao = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 120, {24, 96, 0, 0}, { 1, 2, 0xf0, 4, duzqslhlvrbd }, { 1, 2, 0x07, 0, bafqaozlnera }, { 1, 8, 0x18, 3, souulsuvkqvp }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, wiuiioibmfwg, NULL };
-static const struct vsghnouiwbyk dsognanhpusz = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 86, {43, 43, 0, 0}, { 0, 2, 0xf0, 4, auwyugwmwlso }, { 0x80, 0, 0x0c, 2, pqvvecicvowt }, { 0, 0, 0x30, 4, ygdgsrknfpiy }, { 0, 4, 0x20, 5, vubaykzztfch }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, fqgiigpemcaz, NULL };
-static const struct vsghnouiwbyk kjtwgbydsbrq = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 84, {24, 56, 4, 0}, { 1, 1, 0xf0, 4, auwyugwmwlso }, { 1, 0, 0xe0, 5, cnvzopxnosqn }, { 1, 2, 0x70, 4, xknpcbptryfb }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, ewcwtwtnjumd, NULL };
-static const struct vsghnouiwbyk tvjbmiqkyvwz = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 88, {24, 64, 0, 0}, { 1, 6, 0xf0, 4, duzqslhlvrbd }, { 1, 6, 0x07, 0, bafqaozlnera }, { 1, 4, 0xe0, 5, aorqinwjsvvt }, { 0, 0, 0, 0, NULL }, &ekzhvdorveqv, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 6, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, wiuiioibmfwg, NULL };
-static const struct vsghnouiwbyk zkgdfyieyoxv = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 64, {64, 0, 0, 0}, { 0, 4, 0xf0, 4, duzqslhlvrbd }, { 0x0, 4, 0x07, 0, bafqaozlnera }, { 0, 2, 0x70, 4, ghixxwbtroxk }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0,3},4,0x08}}, vjmyvdqynrdc, NULL };
-static const struct vsghnouiwbyk kfiqxgisnmmy = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 152, {24, 128, 0, 0}, { 1, 4, 0x0f, 0, duzqslhlvrbd }, { 1, 2, 0x07, 0, bafqaozlnera }, { 1, 6, 0x07, 0, xbkwqzgpisrs }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, wiuiioibmfwg, NULL };
-static const struct vsghnouiwbyk iewpqkzsaedj = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 128, {128, 0, 0, 0}, { 0, 6, 0x3e, 1, nemjsunvswft }, { 0, 5, 0xc0, 6, lcfcdrxiqyzz }, { 0, 5, 0x0c, 2, gwmvscjwshzk }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, pwvdqwkpzxsd, NULL };
-static const struct vsghnouiwbyk xngxarrljybh = { {0, 1, 0, 0 ,0, 0, 0}, 0x31, 96, {32, 32, 32, 0}, { 0, 0, 0x0f, 0, huxsncyaliwc }, { 0, 2, 0x07, 0, ajxmlmqzwxcy }, { 0, 0, 0x70, 4, buuehtaguyng }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, qjwvrgtjudlw, NULL };
-static const struct vsghnouiwbyk bpebpxzcqusj = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 176, {56, 120, 0, 0}, { 1, 10, 0x3e, 1, atzscyghbqee }, { 1, 7, 0x70, 4, tmjxndimiwqv }, { 1, 11, 0x70, 4, vsldpvefbakr }, { 1, 6, 0x04, 2, mwkgnbawnupn }, &fdxkajqbzzan, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 7, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, vixgnerqasdw, NULL };
-static const struct vsghnouiwbyk jpskkxgsaugj = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 96, {96, 0, 0, 0}, { 0, 6, 0x3e, 1, nemjsunvswft }, { 0, 5, 0xe0, 5, gboajlxtrvem }, { 0, 5, 0x0e, 1, hmcqxpcagkyb }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, tynaglfwcjtt, &flrccffprjxa };
-static const struct vsghnouiwbyk mrhrhhgqqtue = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 56, {12, 44, 0, 0}, { 1, 3, 0x0f, 0, qlbsybjbuuwq }, { 1, 4, 0x07, 0, hsuvxgtgltjj }, { 1, 3, 0xe0, 5, ylmeljrhbupr }, { 0, 0, 0, 0, NULL }, &uwamrtxlewym, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)iytojawjpdpw}, bcvrjesyhbss, &obdyrantbdfg };
-static const struct vsghnouiwbyk sdnwwfepitur = { {0, 1, 1, 0, 0, 0, 0}, 0x31, 112, {12, 44, 12, 44}, { 3, 3, 0x0f, 0, qlbsybjbuuwq }, { 3, 4, 0x07, 0, hsuvxgtgltjj }, { 3, 3, 0xe0, 5, ylmeljrhbupr }, { 0, 0, 0, 0, NULL }, &uwamrtxlewym, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)xczqirpihapm}, qoxwndjnfccy, &qpwvppcoajoo };
-static const struct vsghnouiwbyk vtknycnjzuot = { {0, 1, 1, 0, 0, 0, 0}, 0x36, 112, {12, 44, 12, 44}, { 3, 3, 0x0f, 0, qlbsybjbuuwq }, { 3, 4, 0x07, 0, hsuvxgtgltjj }, { 3, 3, 0xe0, 5, ylmeljrhbupr }, { 0, 0, 0, 0, NULL }, &uwamrtxlewym, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)tmcuunujvvxt}, qoxwndjnfccy, &qpwvppcoajoo };
-static const struct vsghnouiwbyk wmdxzowfnxmt = { {0, 1, 1, 0, 0, 0, 0}, 0x37, 113, {12, 44, 13, 44}, { 3, 3, 0x1e, 1, qlbsybjbuuwq }, { 3, 4, 0x07, 0, hsuvxgtgltjj }, { 3, 3, 0xe0, 5, ylmeljrhbupr }, { 0, 0, 0, 0, NULL }, &uwamrtxlewym, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)tmcuunujvvxt}, lxeqknsnwmvy, &kxlehxjhafxr };
-static const struct vsghnouiwbyk jaipseoqfjjd = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 128, {56, 72, 0, 0}, { 1, 1, 0xF0, 4, qlbsybjbuuwq }, { 1, 2, 0x07, 0, hsuvxgtgltjj }, { 1, 3, 0x03, 0, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)aouwrujpaztm}, yfkkffuyjdjc, &uaqqeyvvobhp };
-static const struct vsghnouiwbyk ticlibjvrnfr = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 120, {56, 64, 0, 0}, { 1, 1, 0xF0, 4, qlbsybjbuuwq }, { 1, 2, 0x07, 0, hsuvxgtgltjj }, { 1, 3, 0x03, 0, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)vhfynacxtmnb}, yfkkffuyjdjc, &uaqqeyvvobhp };
-static const struct vsghnouiwbyk owovpmzrtkei = { {0, 0, 1, 0, 0, 0, 0}, 0x34, 64, {64, 0, 0, 0}, { 0, 3, 0xF0, 4, qlbsybjbuuwq }, { 0, 4, 0x07, 0, wxkwcmkryxyu }, { 0, 4, 0x30, 4, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)wyjlxfrdarhw}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk ixhwaobvqsdk = { {0, 0, 1, 0, 0, 0, 0}, 0x34, 64, {64, 0, 0, 0}, { 0, 3, 0xF0, 4, qlbsybjbuuwq }, { 0, 4, 0x0f, 0, iwibokxoamdr }, { 0, 4, 0x30, 4, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)wyjlxfrdarhw}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk nlbbipzajbsk = { {0, 1, 0, 0, 0, 1, 0}, 0x34, 104, {40, 64, 0, 0}, { 1, 1, 0xfe, 1, vmrjepqklhrp }, { 1, 0, 0x0f, 0, lejoqyagfyzp }, { 1, 0, 0x70, 4, ctwleblehvbl }, { 0, 0, 0, 0, NULL }, &emfskyjcsedy, {.xdvjpfttnymn.yeltdjdwiegk= {{1, 3}, 6, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, ewcwtwtnjumd, NULL };
-static const struct vsghnouiwbyk qzfyfmozspcz = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 144, {56, 88, 0, 0}, { 1, 1, 0xF8, 3, jlxcxegylhom }, { 1, 2, 0x07, 0, hsuvxgtgltjj }, { 1, 3, 0x0f, 0, pdsivkkogkpw }, { 1, 1, 0x01, 0, mwkgnbawnupn }, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)vxfqezcnwxpd}, yfkkffuyjdjc, NULL };
-static const struct vsghnouiwbyk hinfjnehedmf = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 264, {56, 208, 0, 0}, { 1, 1, 0xF8, 3, jlxcxegylhom }, { 1, 2, 0x07, 0, hsuvxgtgltjj }, { 1, 3, 0x0f, 0, pdsivkkogkpw }, { 1, 1, 0x01, 0, mwkgnbawnupn }, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)rowxxcmqcmsr}, yfkkffuyjdjc, NULL };
-static const struct vsghnouiwbyk srwcsqpoanux = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 64, {48, 16, 0, 0}, { 0, 3, 0xFF, 0, hzaxbgzfvbgn }, { 0, 1, 0x0f, 0, nzxfabradldm }, { 0, 1, 0xf0, 4, tdwegvcedrpe }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 4, 0x40}}, pxkacdstmejh, NULL };
-static const struct vsghnouiwbyk nechawtmavfr = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 128, {56, 72, 0, 0}, { 1, 1, 0xF8, 3, jlxcxegylhom }, { 1, 2, 0x07, 0, hsuvxgtgltjj }, { 1, 3, 0x03, 0, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)aouwrujpaztm}, yfkkffuyjdjc, NULL };
-static const struct vsghnouiwbyk xiumgqrccrjw = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 264, {24, 240, 0, 0}, { 1, 10, 0x3c, 2, qlbsybjbuuwq }, { 1, 22, 0x07, 0, hhhswelrvjuh }, { 1, 22, 0x70, 4, cnbszmkdlatp }, { 1, 8, 0xff, 0, lzedgpxidpwo }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 24, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, tfqcvjqqgksc, NULL };
-static const struct vsghnouiwbyk jsmmifwtmhwr = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 344, {24, 320, 0, 0}, { 1, 10, 0x3c, 2, qlbsybjbuuwq }, { 1, 22, 0x07, 0, hhhswelrvjuh }, { 1, 22, 0x70, 4, cnbszmkdlatp }, { 1, 8, 0xff, 0, lzedgpxidpwo }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 24, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, tfqcvjqqgksc, NULL };
-static const struct vsghnouiwbyk ljsxaptbeslq = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 224, {56, 168, 0, 0}, { 1, 4, 0x3e, 1, dirmsniyzxmk }, { 1, 3, 0x0f, 0, ziszrqxokrda }, { 1, 6, 0x07, 0, zdumkkqrzozd }, { 1, 2, 0x0f, 0, ntreoxngymvu }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 10, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, fxfxqyeahtnk, &fgteclqwvypk };
-static const struct vsghnouiwbyk hsvzyjdwasju = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 296, {24, 272, 0, 0}, { 1, 10, 0x3c, 2, qlbsybjbuuwq }, { 1, 22, 0x0f, 0, rdgxenokefnn }, { 1, 22, 0x70, 4, xkbkyujymdhn }, { 1, 8, 0xff, 0, lzedgpxidpwo }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 24, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, tfqcvjqqgksc, NULL };
-static const struct vsghnouiwbyk vkfadeonobsh = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 40, {40, 0, 0, 0}, { 0, 3, 0x0f, 0, auwyugwmwlso }, { 0, 2, 0x07, 0, etirvoycmsmy }, { 0, 2, 0x70, 4, ghixxwbtroxk }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, yzwkptrlibny, NULL };
-static const struct vsghnouiwbyk rtprmcyraybo = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 96, {96, 0, 0, 0}, { 0, 1, 0x0f, 0, qlbsybjbuuwq }, { 0, 4, 0x70, 4, hlwjchgwhrxt }, { 0, 4, 0x03, 0, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 8}, 5, 0x41}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk onumnaqimutd = { {0, 1, 0, 0, 0, 0, 0}, 0x31, 317, {5, 160, 152, 0}, { 2, 6, 0xfe, 1, dirmsniyzxmk }, { 2, 5, 0x70, 4, nzrkfuvfonaq }, { 2, 8, 0xf0, 4, sodnmplfotvu }, { 0, 0, 0, 0, NULL }, &fykqxdnfxwad, {.xdvjpfttnymn.yeltdjdwiegk = {{2, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{1, 3}, 11, 0x80}}, bspfpjedoqeg, &dkmwaidgkket };
-static const struct vsghnouiwbyk dacyvuezeond = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 200, {56, 144, 0, 0}, { 1, 10, 0x3e, 1, atzscyghbqee }, { 1, 7, 0x70, 4, kuynqvlswrys }, { 1, 11, 0x70, 4, vsldpvefbakr }, { 1, 6, 0x04, 2, mwkgnbawnupn }, &evycgssopymu, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 7, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{1, 9}, 6, 0x04}}, vixgnerqasdw, NULL };
-static const struct vsghnouiwbyk xlyyyyguhirh = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 157, {5, 152, 0, 0}, { 1, 6, 0xfe, 1, dirmsniyzxmk }, { 1, 5, 0x70, 4, nzrkfuvfonaq }, { 1, 8, 0xf0, 4, sodnmplfotvu }, { 0, 0, 0, 0, NULL }, &nxrdhuyhzxrv, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dyoerhuugkim, &xzgukzrwqvln };
-static const struct vsghnouiwbyk qnarboxjrxzn = { {0, 1, 0, 0, 0, 1, 0}, 0x32, 128, {32, 32, 32, 32}, { 0, 0x0, 0x0f, 0, qlbsybjbuuwq }, { 0x00, 2, 0x07, 0, ajxmlmqzwxcy }, { 0, 0, 0xf0, 4, buuehtaguyng }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, mbtdrqfkrhlf, NULL };
-static const struct vsghnouiwbyk vxdzvmepjvvw = { {0, 0, 0, 0, 0, 0, 0}, 0x36, 64, {64, 0, 0, 0}, { 0, 6, 0xFF, 0, hzaxbgzfvbgn }, { 0, 1, 0x0F, 0, sjcyohrqpoaq }, { 0, 1, 0xf0, 4, hydxpacucott }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 7, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, piayrwdcoabm, NULL };
-static const struct vsghnouiwbyk belikbrskevt = { {0, 1, 0, 0, 0, 0, 0}, 0x33, 286, {6, 64, 64, 152}, { 3, 6, 0xfe, 1, dirmsniyzxmk }, { 3, 5, 0x70, 4, nzrkfuvfonaq }, { 3, 8, 0xf0, 4, sodnmplfotvu }, { 0, 0, 0, 0, NULL }, &nhfcnuxssqdy, {.xdvjpfttnymn.yeltdjdwiegk = {{3, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, tqokiavwcgfc, &gxwjutmejxvu };
-static const struct vsghnouiwbyk vdvubiodajlu = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 56, {56, 0, 0, 0}, { 0, 4, 0x0f, 0, qlbsybjbuuwq }, { 0, 1, 0x70, 4, buylqkkswbpc }, { 0, 5, 0xe0, 5, exghimrmmgkb }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, ybjlgbokpeap, NULL };
-static const struct vsghnouiwbyk bujdavsupzey = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 96, {32, 32, 32, 0}, { 0, 2, 0xf0, 4, rnzkhkybayht }, { 0xC0, 3, 0x0f, 0, wtkljughxyhz }, { 0x40, 4, 0x0f, 0, tgvozcdkwizi }, { 0, 4, 0xff, 0, dyotlvvkqnpr }, &holbhphlckyo, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, pjyjlubiskul, NULL };
-static const struct vsghnouiwbyk bzpgxccuygdj = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 96, {96, 0, 0, 0}, { 0, 9, 0x0f, 0, qlbsybjbuuwq }, { 0, 9, 0xe0, 5, hsuvxgtgltjj }, { 0, 7, 0x60, 5, ygdgsrknfpiy }, { 0, 5, 0x1f, 0, hflaumdbxlvi }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 7, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0} }, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk xgapiyfdyqej = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 52, {52, 0, 0, 0}, { 0, 5, 0x0f, 0, qlbsybjbuuwq }, { 0, 5, 0x70, 4, dhxclxrtlauf }, { 0, 4, 0x07, 0, uyyrvcoowruy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 0, 0x03}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0} }, byrdqdaczwxz, NULL };
-static const struct vsghnouiwbyk ezugptpfzbsu = { {0, 0, 0, 0, 0, 0, 0}, 0x36, 72, {72, 0, 0, 0}, { 0, 6, 0xff, 0, hzaxbgzfvbgn }, { 0, 1, 0x0F, 0, sjcyohrqpoaq }, { 0, 1, 0xf0, 4, tdwegvcedrpe }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 7, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0} }, olhrfncspuea, NULL };
-static const struct vsghnouiwbyk amwxhlmwgweb = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 44, {44, 0, 0, 0}, { 0, 1, 0x0f, 0, huxsncyaliwc }, { 0x80, 1, 0xc0, 6, ewocvipkuzaw }, { 0, 1, 0x30, 4, ygdgsrknfpiy }, { 0, 4, 0x02, 1, pvaqlkvrylaf }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0} }, byrdqdaczwxz, NULL };
-static const struct vsghnouiwbyk usjjkfzdtivx = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 128, {72, 56, 0, 0}, { 0, 6, 0xFF, 0, lrpkzrzobwqs }, { 0, 1, 0x0f, 0, sjcyohrqpoaq }, { 0, 1, 0xf0, 4, hydxpacucott }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 7, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0} }, butuufvlfofh, NULL };
-static const struct vsghnouiwbyk tinobgdjddsw = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 32, {32, 0, 0, 0}, { 0, 2, 0xf0, 4, qlbsybjbuuwq }, { 0xC0, 3, 0x0f, 0, kmaatknfqqxv }, { 0x40, 4, 0x0f, 0, tgvozcdkwizi }, { 0, 4, 0xff, 0, dyotlvvkqnpr }, &zlpsuvgjiqwv, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 8}, 2, 0x85}, .xdvjpfttnymn.umavhyptrjjy = {{0,8},3,0x16}}, engafuusnyoi, NULL };
-static const struct vsghnouiwbyk fychrhgzshew = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, { 0, 3, 0xff, 0, hzaxbgzfvbgn }, { 0, 2, 0x07, 0, vdgjgcoiublr }, { 0, 2, 0x60, 5, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 1, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0} }, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk xprioipfdfus = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, { 0, 1, 0x0F, 0, qlbsybjbuuwq }, { 0, 6, 0x70, 4, hsuvxgtgltjj }, { 0, 6, 0x03, 0, ybuezpmusfwy }, { 0, 0, 0, 0, NULL }, &znsmeszcajgq, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 1, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0} }, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk rfnrflwnuqav = { {1, 0, 0, 1, 1, 0, 0}, 0x35, 100, {100, 0, 0, 0}, { 0, 3, 0x0F, 0, qlbsybjbuuwq }, { 0, 4, 0x07, 0, jwphqmnoiuwo }, { 0, 4, 0x70, 4, aqptxectdvef }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk ruwlldvyquwu = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 96, {96, 0, 0, 0}, { 0, 9, 0x0f, 0, qlbsybjbuuwq }, { 0, 9, 0xe0, 5, hsuvxgtgltjj }, { 0, 7, 0xe0, 5, ygdgsrknfpiy }, { 0, 5, 0xff, 0, hflaumdbxlvi }, &dldneguofhfg, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 7, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, aszgewaorkyw, NULL };
-static const struct vsghnouiwbyk rhfhkstmsxtp = { {1, 1, 0, 0, 0, 0, 0}, 0x36, 192, {16, 80, 16, 80}, { 1, 0, 0xf0, 4, qlbsybjbuuwq }, { 1, 0, 0x07, 0, sohkunnzjygb }, { 1, 8, 0xf0, 4, riybiayodery }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 8}, 0, 0x82}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, azjugvbsdsqp, NULL };
+static const struct vsghnouiwbyk xocvywzuttti = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 44, {44, 0, 0, 0}, 68, 69, 5, 18, &lbldedfcqxoj, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk yeobnxyjvwij = { {0, 1, 0, 0, 0, 1, 0}, 0x37, 60, {20, 20, 20, 0}, 182, 183, 184, 185, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,9},0,0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, dikotbgrtiuo, NULL };
+static const struct vsghnouiwbyk hiwirhjbknsp = { {0, 1, 0, 0, 0, 1, 0}, 0x37, 60, {20, 20, 20, 0}, 186, 183, 184, 187, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,9},0,0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dikotbgrtiuo, NULL };
+static const struct vsghnouiwbyk pkozyrktbizw = { {0, 1, 0, 0, 0, 1, 0}, 0x37, 60, {20, 20, 20, 0}, 186, 183, 184, 185, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,9},0,0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dikotbgrtiuo, NULL };
+static const struct vsghnouiwbyk fkblteeqdvec = { {0, 1, 0, 0, 0, 1, 0}, 0x37, 60, {20, 20, 20, 0}, 188, 183, 184, 187, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,9},0,0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dikotbgrtiuo, NULL };
+static const struct vsghnouiwbyk fndleauamszv = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 288, {144, 144, 0, 0}, 189, 190, 191, 192, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x20}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, wkhvrdgxemas, &vmsyeoerpcbo };
+static const struct vsghnouiwbyk zuvkfvvzyyvr = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 144, {144, 0, 0, 0}, 189, 190, 191, 192, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x20}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk mzcdqaqfysil = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 184, {40, 144, 0, 0}, 179, 193, 194, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (vixgnerqasdw+1), NULL };
+static const struct vsghnouiwbyk yplqlejdjgfi = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 184, {40, 144, 0, 0}, 195, 196, 197, 198, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x20}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (vixgnerqasdw+1), &iavlxfeyybjd };
+static const struct vsghnouiwbyk nvryyqqoomlz = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 88, {24, 64, 0, 0}, 199, 200, 201, 0, &iixudukxafde, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 2, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{1,3},6,0x08}}, wiuiioibmfwg, NULL };
+static const struct vsghnouiwbyk hdxztezasnbk = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 136, {40, 48, 48, 0}, 202, 203, 204, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, tghubrggbsnn, &hpyguqhasgog };
+static const struct vsghnouiwbyk bztrmruvgbmz = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 136, {40, 48, 48, 0}, 205, 203, 204, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, tghubrggbsnn, &gsrnsfjloqer };
+static const struct vsghnouiwbyk letfeiyhgyvy = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 102, {51, 51, 0, 0}, 40, 206, 207, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x03}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (fwastflmujzt+1), &rrqwtapoxwws };
+static const struct vsghnouiwbyk wnjkpivtckvq = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 64, {64, 0, 0, 0}, 43, 41, 208, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, vjmyvdqynrdc, NULL };
+static const struct vsghnouiwbyk uhnrnfbmaaio = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 104, {24, 80, 0, 0}, 209, 200, 201, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 6, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, wiuiioibmfwg, NULL };
+static const struct vsghnouiwbyk dsiqvttdffga = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 104, {24, 80, 0, 0}, 210, 200, 201, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 6, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, wiuiioibmfwg, NULL };
+static const struct vsghnouiwbyk jhuxbtudabwa = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 120, {24, 96, 0, 0}, 211, 212, 213, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, wiuiioibmfwg, NULL };
+static const struct vsghnouiwbyk cwhedsgdrjao = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 120, {24, 96, 0, 0}, 211, 212, 213, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, wiuiioibmfwg, NULL };
+static const struct vsghnouiwbyk dsognanhpusz = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 86, {43, 43, 0, 0}, 40, 214, 12, 215, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (fwastflmujzt+1), NULL };
+static const struct vsghnouiwbyk kjtwgbydsbrq = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 84, {24, 56, 4, 0}, 216, 217, 218, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, ewcwtwtnjumd, NULL };
+static const struct vsghnouiwbyk tvjbmiqkyvwz = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 88, {24, 64, 0, 0}, 210, 200, 201, 0, &ekzhvdorveqv, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 6, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, wiuiioibmfwg, NULL };
+static const struct vsghnouiwbyk zkgdfyieyoxv = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 64, {64, 0, 0, 0}, 219, 220, 221, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0,3},4,0x08}}, vjmyvdqynrdc, NULL };
+static const struct vsghnouiwbyk kfiqxgisnmmy = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 152, {24, 128, 0, 0}, 222, 212, 223, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, wiuiioibmfwg, NULL };
+static const struct vsghnouiwbyk iewpqkzsaedj = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 128, {128, 0, 0, 0}, 224, 225, 226, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, pwvdqwkpzxsd, NULL };
+static const struct vsghnouiwbyk xngxarrljybh = { {0, 1, 0, 0 ,0, 0, 0}, 0x31, 96, {32, 32, 32, 0}, 78, 79, 227, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, qjwvrgtjudlw, NULL };
+static const struct vsghnouiwbyk bpebpxzcqusj = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 176, {56, 120, 0, 0}, 228, 229, 230, 231, &fdxkajqbzzan, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 7, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, vixgnerqasdw, NULL };
+static const struct vsghnouiwbyk jpskkxgsaugj = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 96, {96, 0, 0, 0}, 224, 232, 233, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (pwvdqwkpzxsd+1), &flrccffprjxa };
+static const struct vsghnouiwbyk mrhrhhgqqtue = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 56, {12, 44, 0, 0}, 234, 235, 236, 0, &uwamrtxlewym, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)iytojawjpdpw}, bcvrjesyhbss, &obdyrantbdfg };
+static const struct vsghnouiwbyk sdnwwfepitur = { {0, 1, 1, 0, 0, 0, 0}, 0x31, 112, {12, 44, 12, 44}, 237, 238, 239, 0, &uwamrtxlewym, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)xczqirpihapm}, qoxwndjnfccy, &qpwvppcoajoo };
+static const struct vsghnouiwbyk vtknycnjzuot = { {0, 1, 1, 0, 0, 0, 0}, 0x36, 112, {12, 44, 12, 44}, 237, 238, 239, 0, &uwamrtxlewym, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)tmcuunujvvxt}, qoxwndjnfccy, &qpwvppcoajoo };
+static const struct vsghnouiwbyk wmdxzowfnxmt = { {0, 1, 1, 0, 0, 0, 0}, 0x37, 113, {12, 44, 13, 44}, 240, 238, 239, 0, &uwamrtxlewym, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)tmcuunujvvxt}, lxeqknsnwmvy, &kxlehxjhafxr };
+static const struct vsghnouiwbyk jaipseoqfjjd = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 128, {56, 72, 0, 0}, 202, 241, 242, 0, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)aouwrujpaztm}, yfkkffuyjdjc, &uaqqeyvvobhp };
+static const struct vsghnouiwbyk ticlibjvrnfr = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 120, {56, 64, 0, 0}, 202, 241, 242, 0, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)vhfynacxtmnb}, yfkkffuyjdjc, &uaqqeyvvobhp };
+static const struct vsghnouiwbyk owovpmzrtkei = { {0, 0, 1, 0, 0, 0, 0}, 0x34, 64, {64, 0, 0, 0}, 151, 243, 244, 0, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)wyjlxfrdarhw}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk ixhwaobvqsdk = { {0, 0, 1, 0, 0, 0, 0}, 0x34, 64, {64, 0, 0, 0}, 151, 245, 244, 0, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)wyjlxfrdarhw}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk nlbbipzajbsk = { {0, 1, 0, 0, 0, 1, 0}, 0x34, 104, {40, 64, 0, 0}, 246, 247, 248, 0, &emfskyjcsedy, {.xdvjpfttnymn.yeltdjdwiegk= {{1, 3}, 6, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, ewcwtwtnjumd, NULL };
+static const struct vsghnouiwbyk qzfyfmozspcz = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 144, {56, 88, 0, 0}, 249, 241, 250, 251, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)vxfqezcnwxpd}, yfkkffuyjdjc, NULL };
+static const struct vsghnouiwbyk hinfjnehedmf = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 264, {56, 208, 0, 0}, 249, 241, 250, 251, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)rowxxcmqcmsr}, yfkkffuyjdjc, NULL };
+static const struct vsghnouiwbyk srwcsqpoanux = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 64, {48, 16, 0, 0}, 252, 253, 254, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 4, 0x40}}, pxkacdstmejh, NULL };
+static const struct vsghnouiwbyk nechawtmavfr = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 128, {56, 72, 0, 0}, 249, 241, 242, 0, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)aouwrujpaztm}, yfkkffuyjdjc, NULL };
+static const struct vsghnouiwbyk xiumgqrccrjw = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 264, {24, 240, 0, 0}, 255, 256, 257, 258, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 24, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, wiuiioibmfwg, NULL };
+static const struct vsghnouiwbyk jsmmifwtmhwr = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 344, {24, 320, 0, 0}, 255, 256, 257, 258, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 24, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, wiuiioibmfwg, NULL };
+static const struct vsghnouiwbyk ljsxaptbeslq = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 224, {56, 168, 0, 0}, 259, 260, 261, 262, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 10, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, fxfxqyeahtnk, &fgteclqwvypk };
+static const struct vsghnouiwbyk hsvzyjdwasju = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 296, {24, 272, 0, 0}, 255, 263, 264, 258, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 24, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, wiuiioibmfwg, NULL };
+static const struct vsghnouiwbyk vkfadeonobsh = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 40, {40, 0, 0, 0}, 265, 266, 221, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, yzwkptrlibny, NULL };
+static const struct vsghnouiwbyk rtprmcyraybo = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 96, {96, 0, 0, 0}, 1, 267, 268, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 8}, 5, 0x41}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk onumnaqimutd = { {0, 1, 0, 0, 0, 0, 0}, 0x31, 317, {5, 160, 152, 0}, 269, 270, 271, 0, &fykqxdnfxwad, {.xdvjpfttnymn.yeltdjdwiegk = {{2, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{1, 3}, 11, 0x80}}, (etzpkrbcxmgi+1), &dkmwaidgkket };
+static const struct vsghnouiwbyk dacyvuezeond = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 200, {56, 144, 0, 0}, 228, 272, 230, 231, &evycgssopymu, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 7, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{1, 9}, 6, 0x04}}, vixgnerqasdw, NULL };
+static const struct vsghnouiwbyk xlyyyyguhirh = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 157, {5, 152, 0, 0}, 56, 7, 8, 0, &nxrdhuyhzxrv, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (vixgnerqasdw+1), &xzgukzrwqvln };
+static const struct vsghnouiwbyk qnarboxjrxzn = { {0, 1, 0, 0, 0, 1, 0}, 0x32, 128, {32, 32, 32, 32}, 273, 79, 80, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, mbtdrqfkrhlf, NULL };
+static const struct vsghnouiwbyk vxdzvmepjvvw = { {0, 0, 0, 0, 0, 0, 0}, 0x36, 64, {64, 0, 0, 0}, 274, 275, 276, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 7, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, piayrwdcoabm, NULL };
+static const struct vsghnouiwbyk belikbrskevt = { {0, 1, 0, 0, 0, 0, 0}, 0x33, 286, {6, 64, 64, 152}, 57, 58, 59, 0, &nhfcnuxssqdy, {.xdvjpfttnymn.yeltdjdwiegk = {{3, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, tqokiavwcgfc, &gxwjutmejxvu };
+static const struct vsghnouiwbyk vdvubiodajlu = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 56, {56, 0, 0, 0}, 277, 278, 279, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, ybjlgbokpeap, NULL };
+static const struct vsghnouiwbyk bujdavsupzey = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 96, {32, 32, 32, 0}, 280, 281, 282, 283, &holbhphlckyo, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, pjyjlubiskul, NULL };
+static const struct vsghnouiwbyk bzpgxccuygdj = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 96, {96, 0, 0, 0}, 284, 285, 286, 287, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 7, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0} }, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk xgapiyfdyqej = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 52, {52, 0, 0, 0}, 14, 288, 289, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 0, 0x03}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0} }, byrdqdaczwxz, NULL };
+static const struct vsghnouiwbyk ezugptpfzbsu = { {0, 0, 0, 0, 0, 0, 0}, 0x36, 72, {72, 0, 0, 0}, 274, 275, 254, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 7, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0} }, olhrfncspuea, NULL };
+static const struct vsghnouiwbyk amwxhlmwgweb = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 44, {44, 0, 0, 0}, 65, 290, 64, 291, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0} }, byrdqdaczwxz, NULL };
+static const struct vsghnouiwbyk usjjkfzdtivx = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 128, {72, 56, 0, 0}, 292, 275, 276, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 7, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0} }, butuufvlfofh, NULL };
+static const struct vsghnouiwbyk tinobgdjddsw = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 32, {32, 0, 0, 0}, 293, 294, 282, 283, &zlpsuvgjiqwv, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 8}, 2, 0x85}, .xdvjpfttnymn.umavhyptrjjy = {{0,8},3,0x16}}, engafuusnyoi, NULL };
+static const struct vsghnouiwbyk fychrhgzshew = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, 252, 295, 296, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 1, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0} }, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk xprioipfdfus = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, 1, 297, 298, 0, &znsmeszcajgq, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 1, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0} }, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk rfnrflwnuqav = { {1, 0, 0, 1, 1, 0, 0}, 0x35, 100, {100, 0, 0, 0}, 299, 300, 301, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk ruwlldvyquwu = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 96, {96, 0, 0, 0}, 284, 285, 302, 303, &dldneguofhfg, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 7, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, aszgewaorkyw, NULL };
+static const struct vsghnouiwbyk rhfhkstmsxtp = { {1, 1, 0, 0, 0, 0, 0}, 0x36, 192, {16, 80, 16, 80}, 304, 305, 306, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 8}, 0, 0x82}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, azjugvbsdsqp, NULL };
 static const struct fehyfyrgmlkh snjhobcqrytl = {NULL, &rhfhkstmsxtp, 1, 95};
-static const struct vsghnouiwbyk ianducitsrqp = { {1, 1, 0, 0, 0, 0, 0}, 0x34, 96, {16, 80, 0, 0}, { 1, 0, 0xf0, 4, qlbsybjbuuwq }, { 1, 0, 0x07, 0, sohkunnzjygb }, { 1, 8, 0xf0, 4, riybiayodery }, { 0x80, 0, 0, 0, NULL }, &eyvjsnhgibgz, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 8}, 0, 0x82}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, ewcwtwtnjumd, NULL };
-static const struct vsghnouiwbyk nonrnqmxwbmk = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, { 0, 7, 0xff, 0, dvdpdyuxhulp}, { 0, 6, 0x0f, 0, qzrdkksygiln}, { 0, 8, 0x07, 0, xknpcbptryfb}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk kxpowzotobxt = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 136, {136, 0, 0, 0}, { 0, 0x46, 0xFF, 0, nuyihfymrlxy }, { 0x0, 5, 0xf0, 4, txsbffnaanwl }, { 0, 5, 0x0f, 0, obqdvlxymdam }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 8, 0x20}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, iprctvkigumk, NULL };
-static const struct vsghnouiwbyk dhjcyvqfsjfv = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, { 0, 3, 0xf0, 4, qlbsybjbuuwq }, { 0, 3, 0x07, 0, einaxguqxgdv }, { 0, 2, 0x03, 0, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,8}, 2, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk dckwpjtrcquf = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, { 0, 1, 0x0F, 0, qlbsybjbuuwq }, { 0, 0, 0x8C, 2, psyzdexniwbw }, { 0, 0, 0x03, 0, souulsuvkqvp }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,8}, 1, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, lenaojpypmgf, NULL };
-static const struct vsghnouiwbyk ugrwnkglmliy = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 47, {47, 0, 0, 0}, { 0, 5, 0x1F, 0, duzqslhlvrbd }, { 0, 2, 0x0C, 2, jzebnhioprnt }, { 0, 2, 0x03, 0, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,9}, 1, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk szcgozpgdhlj = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 30, {7, 8, 7, 8}, { 1, 0, 0x0F, 0, jxwvazqfgoxj }, { 0, 0, 0x07, 0, gboajlxtrvem }, { 0, 0, 0x70, 4, plbsqfqwtdxy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,8}, 0, 0x35}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, ygcxahquzvij, NULL };
-static const struct vsghnouiwbyk gfzhwwyanuvr = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 32, {32, 0, 0, 0}, { 0, 3, 0x0F, 0, qlbsybjbuuwq }, { 0, 1, 0x30, 4, eoaliifvrjnc }, { 0, 1, 0xc0, 6, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,8}, 1, 0x0c}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk dphdfbfzweey = { {1, 1, 1, 0, 0, 0, 0}, 0x32, 192, {48, 48, 48, 48}, { 0, 4, 0xf0, 4, mmaikokpzmiv }, { 0x00, 4, 0x0c, 2, rwxhlwtqcuxy }, { 0x80, 2, 0xe0, 5, rxjkcgzrlsjg }, { 2, 2, 0xff, 0, lrypgvboynfb }, &jtfyeafstjuo, {.jylyhhlxgchq = (const bc7215DataVarPkt_t*)abgtrwyfidmh}, puyhqnzygnrs, NULL };
-static const struct vsghnouiwbyk avpnqbczfhid = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 368, {64, 152, 152, 0}, { 1, 6, 0x1e, 1, qlbsybjbuuwq }, { 1, 5, 0x70, 4, nzrkfuvfonaq }, { 1, 8, 0xf0, 4, sodnmplfotvu }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, etzpkrbcxmgi, NULL };
-static const struct vsghnouiwbyk adjhkkqsdmqh = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 40, {32, 8, 0, 0}, { 0, 2, 0x0F, 0, qlbsybjbuuwq }, { 0, 1, 0x07, 0, hsuvxgtgltjj }, { 0, 1, 0x30, 4, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,3}, 1, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, cxxqpwnfospn, NULL };
-static const struct vsghnouiwbyk cdkxnbhpkwur = { {0, 1, 0, 0, 0, 1, 0}, 0x36, 168, {16, 96,56, 0}, { 1, 1, 0xf0, 4, qlbsybjbuuwq }, { 1, 1, 0x07, 0, einaxguqxgdv }, { 1, 0, 0x03, 0, ygdgsrknfpiy }, { 2, 1, 0xff, 0, bxstpkifthlt }, &umwiydxghooo, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 0, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dvlmbpsinqoo, &snhznrtscwoh };
-static const struct vsghnouiwbyk yqoylwgfvree = { {0, 0, 0, 0, 0, 1, 0}, 0x36, 64, {64, 0, 0, 0}, { 0, 6, 0xFF, 0, hzaxbgzfvbgn }, { 0, 1, 0x0F, 0, sjcyohrqpoaq }, { 0, 1, 0xf0, 4, hydxpacucott }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 7, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, olhrfncspuea, &gxanzhyuafjw };
-static const struct vsghnouiwbyk htmqewjjuchg = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 97, {96, 1, 0, 0}, { 0, 1, 0x0F, 0, qlbsybjbuuwq }, { 0, 4, 0x70, 4, hlwjchgwhrxt }, { 0, 4, 0x03, 0, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 8}, 5, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk quusmcsmbrdg = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, { 0, 1, 0x0F, 0, huxsncyaliwc }, { 0, 0, 0x07, 0, fumlhnuvtjti }, { 0, 0, 0xf0, 4, riybiayodery }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, lenaojpypmgf, NULL };
-static const struct vsghnouiwbyk potqaxxhcsxu = { {0, 0, 0, 0, 0, 1, 0}, 0x36, 140, {140, 0, 0, 0}, { 0, 16, 0xff, 0, hzaxbgzfvbgn }, { 0, 15, 0x70, 4, sjcyohrqpoaq }, { 0, 15, 0x0f, 0, hydxpacucott }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,3}, 14, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, cfwgnoydaeun, NULL };
-static const struct vsghnouiwbyk sgmoovzwkufu = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 64, {64, 0, 0, 0}, { 0, 5, 0xf0, 4, huxsncyaliwc }, { 0, 4, 0x70, 4, uhvnpakabflt }, { 0, 4, 0x03, 0, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,9}, 4, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, fmqkqpymqyvi, NULL };
-static const struct vsghnouiwbyk ebevanqcipbu = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 62, {31, 31, 0, 0}, { 0, 3, 0x1e, 1, duzqslhlvrbd }, { 0, 0, 0xf0, 4, gzwyyudcsgwr }, { 0, 1, 0x03, 0, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 1, 0x20}}, fqgiigpemcaz, NULL };
-static const struct vsghnouiwbyk wvybpsgtheih = { {0, 1, 0, 1, 1, 1, 0}, 0x36, 262, {64, 64, 0, 0}, { 0, 6, 0xFF, 0, hzaxbgzfvbgn }, { 0, 1, 0x0F, 0, sjcyohrqpoaq }, { 0, 1, 0xf0, 4, hydxpacucott }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 7, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{1, 3}, 2, 0x04}}, tmzqoiuybvgp, &yppgniqoksfm };
-static const struct vsghnouiwbyk hiluulshukkt = { {0, 1, 0, 0, 0, 0, 0}, 0x35, 201, {35,67,67,32}, { 0, 1, 0x0f, 0, qlbsybjbuuwq }, { 0, 0, 0x07, 0, hsuvxgtgltjj }, { 0x82, 2, 0x70, 4, vsldpvefbakr }, { 0, 0, 0x30, 4, dvtgclyxpwol }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, nfuqjxctiyow, NULL };
-static const struct vsghnouiwbyk bbmxprqsumyr = { {0, 0, 1, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, { 0, 2, 0x7f, 0, mnqdymgkrwjk }, { 0, 1, 0x70, 4, mjzkesqcmxsp }, { 0, 7, 0x03, 0, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.jylyhhlxgchq=(const bc7215DataVarPkt_t*)qlhchaocgvwk}, trsclbhfsdgr, NULL };
-static const struct vsghnouiwbyk urfurxwqooqq = { {0, 1, 0, 0, 0, 0, 1}, 0x34, 95, {22, 60, 8, 5}, { 1, 0, 0x1f, 0, nemjsunvswft }, { 0, 2, 0x38, 3, mtqttagzkyvk }, { 1, 0, 0x60, 5, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &ipinhabavepz, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 6, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, stucxxyamdmv, NULL };
-static const struct vsghnouiwbyk xkdlcjkwyutn = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 48, {48, 0, 0, 0}, { 0, 2, 0x1f, 0, nemjsunvswft }, { 0, 1, 0xE0, 5, ddrkrcyvihjd }, { 0, 2, 0xe0, 5, ioyqosfwejrk }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 3, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk tunbaebrcugn = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 72, {16, 56, 0, 0}, { 1, 1, 0x0f, 0, aekximikujqn }, { 1, 0, 0x07, 0, gjckeliagtvm }, { 1, 0, 0x30, 4, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dyoerhuugkim, &kpmkxpudvpbo };
-static const struct vsghnouiwbyk qyiaaavqpcrj = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, { 0, 1, 0xF0, 4, qlbsybjbuuwq }, { 0, 6, 0x07, 0, gjckeliagtvm }, { 0, 6, 0x30, 4, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, &parpdhefvtab };
-static const struct vsghnouiwbyk nrzxnreoqfes = { {1, 1, 0, 0, 0, 0, 0}, 0x32, 256, {72, 72, 56, 56}, { 0, 5, 0xF0, 4, pqzbdwgjzgjg }, { 0, 6, 0x07, 0, vdgjgcoiublr }, { 0, 6, 0xe0, 5, jeqgpekhirgy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 6, 0x07}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, xqxlikpvrrsq, NULL };
-static const struct vsghnouiwbyk rmwdswfttmbu = { {1, 1, 0, 0, 0, 0, 0}, 0x36, 96, {48, 48, 0, 0}, { 0, 2, 0x0f, 0, pqzbdwgjzgjg }, { 0, 1, 0x07, 0, mpbrctckhasl }, { 0, 1, 0x18, 3, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, aduwdhgzncqz, NULL };
-static const struct vsghnouiwbyk yqsapwqtglab = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 56, {56, 0, 0, 0}, { 0, 3, 0x0f, 0, qlbsybjbuuwq }, { 0, 2, 0x07, 0, hsuvxgtgltjj }, { 0, 2, 0x70, 4, vsldpvefbakr }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, qllnjqsepdux, NULL };
-static const struct vsghnouiwbyk hmmzijkzbnxa = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, { 0, 3, 0x0f, 0, qlbsybjbuuwq }, { 0, 2, 0x07, 0, hsuvxgtgltjj }, { 0, 2, 0x70, 4, vsldpvefbakr }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, lmkxtcrveiui, NULL };
-static const struct vsghnouiwbyk qcgrsxpxneke = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 104, {104, 0, 0, 0}, { 0, 4, 0x0f, 0, pqzbdwgjzgjg }, { 0, 6, 0x07, 0, lcfcdrxiqyzz }, { 0, 6, 0x70, 4, qzwqicrgdjvb }, { 0, 5, 0x30, 4, bwmvykmymvdg }, &xxklregglwyz, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, zvwjvnoedyko, NULL };
-static const struct vsghnouiwbyk vhahdjtyhnev = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 104, {104, 0, 0, 0}, { 0, 4, 0x1e, 1, xgmfromrdrwl }, { 0, 6, 0x0f, 0, saueijuhxhjx }, { 0, 6, 0x70, 4, qzwqicrgdjvb }, { 0, 5, 0x30, 4, bwmvykmymvdg }, &xxklregglwyz, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, zvwjvnoedyko, &xdcmbuypvmwr };
-static const struct vsghnouiwbyk wpdkfzbiblvr = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 104, {104, 0, 0, 0}, { 0, 4, 0x0f, 0, huxsncyaliwc }, { 0, 6, 0x07, 0, lcfcdrxiqyzz }, { 0, 6, 0x70, 4, qzwqicrgdjvb }, { 0, 5, 0x30, 4, bwmvykmymvdg }, &ujqhykhpmude, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, zvwjvnoedyko, NULL };
-static const struct vsghnouiwbyk ddzjxyrgrftr = { {1, 1, 0, 0, 0, 0, 0}, 0x37, 96, {32, 32, 32, 0}, { 1, 1, 0xf0, 4, pqzbdwgjzgjg }, { 1, 1, 0x07, 0, lcfcdrxiqyzz }, { 1, 2, 0x70, 4, vsldpvefbakr }, { 1, 3, 0x03, 0, bwmvykmymvdg }, &lsxrgzunwiuv, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, xbqqeploqxoa, NULL };
-static const struct vsghnouiwbyk vsdfyxzyqdfv = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 44, {44, 0, 0, 0}, { 0, 1, 0xF0, 4, ujhihmyhohwg }, { 0, 0, 0xe0, 5, dcxgciynobhy }, { 0, 0, 0x0c, 2, odzevozycpja }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,8}, 0, 0x00}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, byrdqdaczwxz, NULL };
-static const struct vsghnouiwbyk dsftotuwiohl = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, { 0, 5, 0x0f, 0, qlbsybjbuuwq }, { 0, 3, 0x0e, 1, eidniawnhpyq }, { 0, 6, 0x03, 0, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 3, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk pekcqfxtulwr = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, { 0, 7, 0x0f, 0, auwyugwmwlso }, { 0, 6, 0x0f, 0, niaotlqdftsv }, { 0, 8, 0x07, 0, xknpcbptryfb }, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, cxxqpwnfospn, NULL };
-static const struct vsghnouiwbyk ihyhevxycowr = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, { 0, 7, 0xff, 0, hzaxbgzfvbgn }, { 0, 6, 0x0f, 0, niaotlqdftsv }, { 0, 8, 0x07, 0, xknpcbptryfb }, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk iywngrxojtws = { {0, 1, 0, 0, 0, 1, 0}, 0x30, 64, {32, 32, 0, 0}, { 0, 0, 0x0f, 0, huxsncyaliwc }, { 0, 2, 0x07, 0, koatbgekibjo }, { 0, 0, 0xf0, 4, tdwegvcedrpe }, { 0, 0, 0, 0, NULL }, &ocwpowzplqnb, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, amkaibhhhfsc, NULL };
-static const struct vsghnouiwbyk asmgemmtkzbl = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 144, {48, 48, 48, 0}, { 0, 2, 0xf0, 4, huxsncyaliwc }, { 0, 3, 0x07, 0, qqnypqpywrvq }, { 0, 3, 0x70, 4, aglvlpkugvof }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 8}, 2, 0xb8}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, lgosiqlfwtjf, NULL };
-static const struct vsghnouiwbyk frgkgovuctak = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, { 0, 5, 0x0f, 0, qlbsybjbuuwq }, { 0, 2, 0xe0, 5, hsuvxgtgltjj }, { 0, 5, 0x60, 5, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, irmhhvnxqwbx, NULL };
-static const struct vsghnouiwbyk gcmchtjnfppj = { {0, 1, 0, 0, 0, 0, 0}, 0x31, 312, {160, 152, 0, 0}, { 1, 6, 0xfe, 1, dirmsniyzxmk }, { 1, 5, 0x70, 4, nzrkfuvfonaq }, { 1, 8, 0xf0, 4, sodnmplfotvu }, { 0, 0, 0, 0, NULL }, &mdxfijtgnbep, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 6, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{1, 9}, 5, 0x01}}, vixgnerqasdw, &xzgukzrwqvln };
-static const struct vsghnouiwbyk yhdblojcgnva = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 160, {56, 104, 0, 0}, { 1, 9, 0x3E, 1, atzscyghbqee }, { 1, 5, 0x70, 4, cmvjkmxfoogt }, { 1, 10, 0x0f, 0, sodnmplfotvu }, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dyoerhuugkim, NULL };
-static const struct vsghnouiwbyk qrwbqaqglhxy = { {0, 1, 0, 0, 0, 0, 0}, 0x32, 128, {32, 32, 32, 32}, { 0, 0x0, 0x0f, 0, huxsncyaliwc }, { 0x00, 2, 0x07, 0, ltlemtyukwcf }, { 0, 0, 0xf0, 4, buuehtaguyng }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, mbtdrqfkrhlf, NULL };
-static const struct vsghnouiwbyk czhnihunkwan = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 84, {84, 0, 0, 0}, { 0, 1, 0xff, 0, mcmwdzsspsij }, { 0x00, 0, 0x07, 0, hsuvxgtgltjj }, { 0, 0, 0x30, 4, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &rbmxpyedhqsi, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk bxwfmlvnqwnr = { {0, 0, 0, 0, 0, 0, 0}, 0x36, 72, {72, 0, 0, 0}, { 0, 6, 0xff, 0, lrpkzrzobwqs }, { 0, 1, 0x0F, 0, sjcyohrqpoaq }, { 0, 1, 0xf0, 4, hydxpacucott }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 7, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0} }, olhrfncspuea, NULL };
-static const struct vsghnouiwbyk fsskyqkxdhcs = { {0, 0, 1, 0, 0, 0, 0}, 0x34, 96, {96, 0, 0, 0}, { 0, 1, 0x1f, 0, nemjsunvswft }, { 0x80, 3, 0x30, 4, bbdoduitrwbi }, { 0, 3, 0x03, 0, gwmvscjwshzk }, { 0, 2, 0xff, 0, mznzdziymvik }, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)abrviblocjbf }, trsclbhfsdgr, NULL };
-static const struct vsghnouiwbyk unlmpectkiei = { {0, 0, 1, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, { 0, 1, 0x1f, 0, nemjsunvswft }, { 0x80, 3, 0x30, 4, bbdoduitrwbi }, { 0, 3, 0x03, 0, gwmvscjwshzk }, { 0, 2, 0xff, 0, bzkuzronqwts }, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)spqsxntkdvjb }, trsclbhfsdgr, NULL };
-static const struct vsghnouiwbyk tyhxfbrsvtat = { {0, 0, 0, 0, 0, 1, 0}, 0x34, 48, {48, 0, 0, 0}, { 0, 4, 0x0f, 0, zmuhmziggshb }, { 0, 4, 0x30, 4, xramcvgpilnw }, { 0, 2, 0x07, 0, mctpbidjvrsb }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 4, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
-static const struct vsghnouiwbyk antbjenlltbx = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 80, {80, 0, 0, 0}, { 0, 2, 0x0f, 0, duzqslhlvrbd }, { 0, 4, 0x18, 3, cuyzhcvurjqp }, { 0, 4, 0x07, 0, zazdvdrlgoxw }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 3}, 4, 0x20}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
-static const struct vsghnouiwbyk sbynchcbxvzz = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 80, {80, 0, 0, 0}, { 0, 2, 0xf0, 4, duzqslhlvrbd }, { 0, 2, 0x07, 0, umjxfsvzcsro }, { 0, 0, 0x18, 3, watlqftdktqz }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
-static const struct vsghnouiwbyk tpoussptlpir = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 80, {80, 0, 0, 0}, { 0, 2, 0xf0, 4, duzqslhlvrbd }, { 0, 2, 0x03, 0, cuyzhcvurjqp }, { 0, 0, 0x18, 3, watlqftdktqz }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
-static const struct vsghnouiwbyk bjyacowgclrs = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 64, {64, 0, 0, 0}, { 0, 4, 0xf0, 4, duzqslhlvrbd }, { 0x0, 4, 0x07, 0, bafqaozlnera }, { 0, 2, 0x70, 4, zazdvdrlgoxw }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0,3},4,0x08}}, vjmyvdqynrdc, NULL };
-static const struct vsghnouiwbyk xjhuruxmsxur = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 64, {32, 32, 0, 0}, { 0, 2, 0x0f, 0, pqzbdwgjzgjg }, { 0x0, 2, 0x70, 4, nbgcalmcrydn }, { 0, 1, 0x70, 4, jiytyamonchm }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dsuxtremdabv, NULL };
-static const struct vsghnouiwbyk ahqnxetdjfhw = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 152, {152, 0, 0, 0}, { 0, 6, 0x3e, 1, nemjsunvswft }, { 0x80, 5, 0xe0, 5, gboajlxtrvem }, { 0, 5, 0x0c, 2, gwmvscjwshzk }, { 0, 6, 0x80, 7, pvaqlkvrylaf }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 9}, 8, 0x20}}, vqivsbeaooll, &zeshamptsbtz };
-static const struct vsghnouiwbyk hwszgljvdrlq = { {0, 1, 1, 0, 0, 0, 0}, 0x37, 113, {12, 45, 12, 44}, { 3, 3, 0x0f, 0, qlbsybjbuuwq }, { 3, 4, 0x07, 0, hsuvxgtgltjj }, { 3, 3, 0xe0, 5, ylmeljrhbupr }, { 0, 0, 0, 0, NULL }, &uwamrtxlewym, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)tmcuunujvvxt}, qoxwndjnfccy, NULL };
-static const struct vsghnouiwbyk cwbxuyltciee = { {1, 1, 1, 0 , 0, 0, 0}, 0x36, 160, {80, 80, 0, 0}, { 0, 5, 0xf0, 4, pqzbdwgjzgjg}, { 0, 6, 0x07, 0, vdgjgcoiublr}, { 0, 6, 0xC0, 6, jstalkdbnehx }, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)owujvsewldzf}, fwastflmujzt, NULL };
-static const struct vsghnouiwbyk yefbhjuaaukj = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 72, {72, 0, 0, 0}, { 0, 3, 0x0f, 0, qlbsybjbuuwq }, { 0, 1, 0x0f, 0, ujgogupnevgb }, { 0, 1, 0xe0, 5, irftdmkwcmwl }, { 0, 6, 0x1f, 0, arrgrcqyizqk }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk gwjuvxfrhkda = { {0, 1, 1, 0, 0, 0, 0}, 0x32, 192, {96, 48, 48, 0}, { 1, 4, 0x0f, 0, zmuhmziggshb }, { 1, 4, 0x30, 4, xramcvgpilnw }, { 1, 2, 0x07, 0, mctpbidjvrsb }, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.jylyhhlxgchq = (const bc7215DataVarPkt_t*)rfvsrlawowjl}, snczkqcpgjfu, NULL };
-static const struct vsghnouiwbyk pbwzfbkdvpdh = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 161, {56, 104, 1, 0}, { 1, 9, 0xFE, 1, xgmfromrdrwl }, { 1, 5, 0x70, 4, cmvjkmxfoogt }, { 1, 10, 0x0f, 0, sodnmplfotvu }, { 0, 0, 0, 0, NULL}, &nxrdhuyhzxrv, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dyoerhuugkim, NULL };
-static const struct vsghnouiwbyk tnmzrgshvqop = { {1, 0, 0, 0, 0, 0, 0}, 0x36, 52, {52, 0, 0, 0}, { 0, 5, 0x0f, 0, qlbsybjbuuwq }, { 0x0, 5, 0x70, 4, ybuezpmusfwy }, { 0, 4, 0x07, 0, eobqxjqhbanf }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x03}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, byrdqdaczwxz, NULL };
-static const struct vsghnouiwbyk qehnqekdxhfv = { {1, 0, 0, 0, 0, 0, 0}, 0x36, 52, {52, 0, 0, 0}, { 0, 5, 0x0f, 0, qlbsybjbuuwq }, { 0x40, 5, 0xf0, 4, ueqljpyepgwu }, { 0, 5, 0xf0, 4, jrumdzqovxoi }, { 0, 0, 0, 0, NULL }, &xhvvxndvofwx, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x03}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 0, 0x80}}, byrdqdaczwxz, NULL };
-static const struct vsghnouiwbyk zpzfevkcpjud = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 52, {52, 0, 0, 0}, { 0, 5, 0x0f, 0, qlbsybjbuuwq }, { 0x40, 5, 0xf0, 4, ueqljpyepgwu }, { 0, 5, 0xf0, 4, jrumdzqovxoi }, { 0, 0, 0, 0, NULL }, &xhvvxndvofwx, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x03}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 0, 0x80}}, byrdqdaczwxz, NULL };
+static const struct vsghnouiwbyk ianducitsrqp = { {1, 1, 0, 0, 0, 0, 0}, 0x34, 96, {16, 80, 0, 0}, 304, 305, 306, 18, &eyvjsnhgibgz, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 8}, 0, 0x82}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, ewcwtwtnjumd, NULL };
+static const struct vsghnouiwbyk nonrnqmxwbmk = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, 307, 308, 36, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk kxpowzotobxt = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 136, {136, 0, 0, 0}, 128, 129, 130, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 8, 0x20}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, iprctvkigumk, NULL };
+static const struct vsghnouiwbyk dhjcyvqfsjfv = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, 151, 149, 150, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,8}, 2, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk dckwpjtrcquf = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, 1, 309, 310, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,8}, 1, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, lenaojpypmgf, NULL };
+static const struct vsghnouiwbyk ugrwnkglmliy = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 47, {47, 0, 0, 0}, 311, 312, 62, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,9}, 1, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk szcgozpgdhlj = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 30, {7, 8, 7, 8}, 313, 314, 315, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,8}, 0, 0x35}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (rruxbybbhcov+2), NULL };
+static const struct vsghnouiwbyk gfzhwwyanuvr = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 32, {32, 0, 0, 0}, 299, 316, 317, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,8}, 1, 0x0c}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk dphdfbfzweey = { {1, 1, 1, 0, 0, 0, 0}, 0x32, 192, {48, 48, 48, 48}, 84, 85, 88, 318, &jtfyeafstjuo, {.jylyhhlxgchq = (const bc7215DataVarPkt_t*)abgtrwyfidmh}, puyhqnzygnrs, NULL };
+static const struct vsghnouiwbyk avpnqbczfhid = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 368, {64, 152, 152, 0}, 6, 7, 8, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, etzpkrbcxmgi, NULL };
+static const struct vsghnouiwbyk adjhkkqsdmqh = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 40, {32, 8, 0, 0}, 15, 16, 17, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,3}, 1, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, cxxqpwnfospn, NULL };
+static const struct vsghnouiwbyk cdkxnbhpkwur = { {0, 1, 0, 0, 0, 1, 0}, 0x36, 168, {16, 96,56, 0}, 202, 141, 142, 143, &umwiydxghooo, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 0, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dvlmbpsinqoo, &snhznrtscwoh };
+static const struct vsghnouiwbyk yqoylwgfvree = { {0, 0, 0, 0, 0, 1, 0}, 0x36, 64, {64, 0, 0, 0}, 274, 275, 276, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 7, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, olhrfncspuea, &gxanzhyuafjw };
+static const struct vsghnouiwbyk htmqewjjuchg = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 97, {96, 1, 0, 0}, 1, 267, 268, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 8}, 5, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk quusmcsmbrdg = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, 65, 13, 319, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, lenaojpypmgf, NULL };
+static const struct vsghnouiwbyk potqaxxhcsxu = { {0, 0, 0, 0, 0, 1, 0}, 0x36, 140, {140, 0, 0, 0}, 320, 321, 322, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,3}, 14, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, cfwgnoydaeun, NULL };
+static const struct vsghnouiwbyk sgmoovzwkufu = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 64, {64, 0, 0, 0}, 323, 324, 268, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,9}, 4, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, fmqkqpymqyvi, NULL };
+static const struct vsghnouiwbyk ebevanqcipbu = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 62, {31, 31, 0, 0}, 325, 326, 327, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 1, 0x20}}, (fwastflmujzt+1), NULL };
+static const struct vsghnouiwbyk wvybpsgtheih = { {0, 1, 0, 1, 1, 1, 0}, 0x36, 262, {64, 64, 0, 0}, 274, 275, 276, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 7, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{1, 3}, 2, 0x04}}, tmzqoiuybvgp, &yppgniqoksfm };
+static const struct vsghnouiwbyk hiluulshukkt = { {0, 1, 0, 0, 0, 0, 0}, 0x35, 201, {35,67,67,32}, 1, 2, 328, 4, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, nfuqjxctiyow, NULL };
+static const struct vsghnouiwbyk bbmxprqsumyr = { {0, 0, 1, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, 329, 330, 331, 0, &olbtwhlypieh, {.jylyhhlxgchq=(const bc7215DataVarPkt_t*)qlhchaocgvwk}, trsclbhfsdgr, NULL };
+static const struct vsghnouiwbyk urfurxwqooqq = { {0, 1, 0, 0, 0, 0, 1}, 0x34, 95, {22, 60, 8, 5}, 332, 333, 334, 0, &ipinhabavepz, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 6, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, stucxxyamdmv, NULL };
+static const struct vsghnouiwbyk xkdlcjkwyutn = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 48, {48, 0, 0, 0}, 335, 336, 337, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 3, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk tunbaebrcugn = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 72, {16, 56, 0, 0}, 338, 339, 340, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (vixgnerqasdw+1), &kpmkxpudvpbo };
+static const struct vsghnouiwbyk qyiaaavqpcrj = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, 111, 341, 342, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), &parpdhefvtab };
+static const struct vsghnouiwbyk nrzxnreoqfes = { {1, 1, 0, 0, 0, 0, 0}, 0x32, 256, {72, 72, 56, 56}, 28, 29, 343, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 6, 0x07}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, xqxlikpvrrsq, NULL };
+static const struct vsghnouiwbyk rmwdswfttmbu = { {1, 1, 0, 0, 0, 0, 0}, 0x36, 96, {48, 48, 0, 0}, 344, 345, 346, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, aduwdhgzncqz, NULL };
+static const struct vsghnouiwbyk yqsapwqtglab = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 56, {56, 0, 0, 0}, 299, 347, 348, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, qllnjqsepdux, NULL };
+static const struct vsghnouiwbyk hmmzijkzbnxa = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, 299, 347, 348, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, lmkxtcrveiui, NULL };
+static const struct vsghnouiwbyk qcgrsxpxneke = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 104, {104, 0, 0, 0}, 349, 350, 351, 352, &xxklregglwyz, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, zvwjvnoedyko, NULL };
+static const struct vsghnouiwbyk vhahdjtyhnev = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 104, {104, 0, 0, 0}, 353, 354, 351, 352, &xxklregglwyz, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, zvwjvnoedyko, &xdcmbuypvmwr };
+static const struct vsghnouiwbyk wpdkfzbiblvr = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 104, {104, 0, 0, 0}, 355, 350, 351, 352, &ujqhykhpmude, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, zvwjvnoedyko, NULL };
+static const struct vsghnouiwbyk ddzjxyrgrftr = { {1, 1, 0, 0, 0, 0, 0}, 0x37, 96, {32, 32, 32, 0}, 356, 357, 358, 359, &lsxrgzunwiuv, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, xbqqeploqxoa, NULL };
+static const struct vsghnouiwbyk vsdfyxzyqdfv = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 44, {44, 0, 0, 0}, 360, 361, 362, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0,8}, 0, 0x00}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, byrdqdaczwxz, NULL };
+static const struct vsghnouiwbyk dsftotuwiohl = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, 14, 363, 364, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 3, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk pekcqfxtulwr = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, 34, 35, 36, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, cxxqpwnfospn, NULL };
+static const struct vsghnouiwbyk ihyhevxycowr = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, 365, 35, 36, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk iywngrxojtws = { {0, 1, 0, 0, 0, 1, 0}, 0x30, 64, {32, 32, 0, 0}, 78, 366, 367, 0, &ocwpowzplqnb, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, furfqjhejfgv, NULL };
+static const struct vsghnouiwbyk asmgemmtkzbl = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 144, {48, 48, 48, 0}, 131, 368, 369, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 8}, 2, 0xb8}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, lgosiqlfwtjf, NULL };
+static const struct vsghnouiwbyk frgkgovuctak = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, 14, 370, 371, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, irmhhvnxqwbx, NULL };
+static const struct vsghnouiwbyk gcmchtjnfppj = { {0, 1, 0, 0, 0, 0, 0}, 0x31, 312, {160, 152, 0, 0}, 56, 7, 8, 0, &mdxfijtgnbep, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 6, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{1, 9}, 5, 0x01}}, vixgnerqasdw, &xzgukzrwqvln };
+static const struct vsghnouiwbyk yhdblojcgnva = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 160, {56, 104, 0, 0}, 372, 54, 55, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (vixgnerqasdw+1), NULL };
+static const struct vsghnouiwbyk qrwbqaqglhxy = { {0, 1, 0, 0, 0, 0, 0}, 0x32, 128, {32, 32, 32, 32}, 78, 373, 80, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, mbtdrqfkrhlf, NULL };
+static const struct vsghnouiwbyk czhnihunkwan = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 84, {84, 0, 0, 0}, 374, 2, 5, 0, &rbmxpyedhqsi, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk bxwfmlvnqwnr = { {0, 0, 0, 0, 0, 0, 0}, 0x36, 72, {72, 0, 0, 0}, 292, 275, 276, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 7, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0} }, olhrfncspuea, NULL };
+static const struct vsghnouiwbyk fsskyqkxdhcs = { {0, 0, 1, 0, 0, 0, 0}, 0x34, 96, {96, 0, 0, 0}, 31, 375, 376, 377, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)abrviblocjbf }, trsclbhfsdgr, NULL };
+static const struct vsghnouiwbyk unlmpectkiei = { {0, 0, 1, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, 31, 375, 376, 378, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)spqsxntkdvjb }, trsclbhfsdgr, NULL };
+static const struct vsghnouiwbyk tyhxfbrsvtat = { {0, 0, 0, 0, 0, 1, 0}, 0x34, 48, {48, 0, 0, 0}, 50, 51, 52, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 4, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
+static const struct vsghnouiwbyk antbjenlltbx = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 80, {80, 0, 0, 0}, 379, 380, 381, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 3}, 4, 0x20}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
+static const struct vsghnouiwbyk sbynchcbxvzz = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 80, {80, 0, 0, 0}, 43, 41, 382, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
+static const struct vsghnouiwbyk tpoussptlpir = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 80, {80, 0, 0, 0}, 43, 383, 382, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk={{0, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, NULL };
+static const struct vsghnouiwbyk bjyacowgclrs = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 64, {64, 0, 0, 0}, 219, 220, 384, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0,3},4,0x08}}, vjmyvdqynrdc, NULL };
+static const struct vsghnouiwbyk xjhuruxmsxur = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 64, {32, 32, 0, 0}, 344, 126, 385, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (aduwdhgzncqz+1), NULL };
+static const struct vsghnouiwbyk ahqnxetdjfhw = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 152, {152, 0, 0, 0}, 224, 386, 226, 387, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 9}, 8, 0x20}}, vqivsbeaooll, &zeshamptsbtz };
+static const struct vsghnouiwbyk hwszgljvdrlq = { {0, 1, 1, 0, 0, 0, 0}, 0x37, 113, {12, 45, 12, 44}, 237, 238, 239, 0, &uwamrtxlewym, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)tmcuunujvvxt}, qoxwndjnfccy, NULL };
+static const struct vsghnouiwbyk cwbxuyltciee = { {1, 1, 1, 0 , 0, 0, 0}, 0x36, 160, {80, 80, 0, 0}, 28, 29, 388, 0, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)owujvsewldzf}, fwastflmujzt, NULL };
+static const struct vsghnouiwbyk yefbhjuaaukj = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 72, {72, 0, 0, 0}, 299, 389, 390, 391, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk gwjuvxfrhkda = { {0, 1, 1, 0, 0, 0, 0}, 0x32, 192, {96, 48, 48, 0}, 392, 393, 394, 0, &olbtwhlypieh, {.jylyhhlxgchq = (const bc7215DataVarPkt_t*)rfvsrlawowjl}, snczkqcpgjfu, NULL };
+static const struct vsghnouiwbyk pbwzfbkdvpdh = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 161, {56, 104, 1, 0}, 53, 54, 55, 0, &nxrdhuyhzxrv, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (vixgnerqasdw+1), NULL };
+static const struct vsghnouiwbyk tnmzrgshvqop = { {1, 0, 0, 0, 0, 0, 0}, 0x36, 52, {52, 0, 0, 0}, 14, 120, 121, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x03}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, byrdqdaczwxz, NULL };
+static const struct vsghnouiwbyk qehnqekdxhfv = { {1, 0, 0, 0, 0, 0, 0}, 0x36, 52, {52, 0, 0, 0}, 14, 395, 396, 0, &xhvvxndvofwx, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x03}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 0, 0x80}}, byrdqdaczwxz, NULL };
+static const struct vsghnouiwbyk zpzfevkcpjud = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 52, {52, 0, 0, 0}, 14, 395, 396, 0, &xhvvxndvofwx, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x03}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 0, 0x80}}, byrdqdaczwxz, NULL };
 static const struct fehyfyrgmlkh negidwahpefw = {NULL, &yeobnxyjvwij, 2, 165};
-static const struct vsghnouiwbyk igqwlbaumthx = { {0, 0, 0, 0, 0, 0, 0}, 0x35, 20, {20, 0, 0, 0}, { 0, 0x1, 0x0f, 0, imegbmhoswpz }, { 0x00, 1, 0x30, 4, zoxbzpgkrild }, { 0, 1, 0xc0, 6, bqkwjhxmdzlf }, { 0x80, 2, 0x0f, 0, wowphqlodpqt }, &emvapmianrew, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0,9},0,0x10}}, gcpbulrrerdq, NULL };
+static const struct vsghnouiwbyk igqwlbaumthx = { {0, 0, 0, 0, 0, 0, 0}, 0x35, 20, {20, 0, 0, 0}, 182, 183, 184, 397, &emvapmianrew, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0,9},0,0x10}}, (neblmufxjobh+5), NULL };
 static const struct fehyfyrgmlkh cymtnhfkrgtc = {NULL, &hiwirhjbknsp, 2, 165};
-static const struct vsghnouiwbyk grxqbegngbcc = { {0, 0, 0, 0, 0, 0, 0}, 0x35, 20, {20, 0, 0, 0}, { 0, 0x1, 0x0f, 0, mscxujnqnuhc }, { 0x00, 1, 0x30, 4, zoxbzpgkrild }, { 0, 1, 0xc0, 6, bqkwjhxmdzlf }, { 0x80, 2, 0x0f, 0, bitfqvjznjnl }, &hiloxabfxord, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0,9},0,0x10}}, gcpbulrrerdq, NULL };
+static const struct vsghnouiwbyk grxqbegngbcc = { {0, 0, 0, 0, 0, 0, 0}, 0x35, 20, {20, 0, 0, 0}, 186, 183, 184, 398, &hiloxabfxord, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0,9},0,0x10}}, (neblmufxjobh+5), NULL };
 static const struct fehyfyrgmlkh rvwpmredthnx = {NULL, &pkozyrktbizw, 2, 165};
-static const struct vsghnouiwbyk semrpkmgzkes = { {0, 0, 0, 0, 0, 0, 0}, 0x35, 20, {20, 0, 0, 0}, { 0, 0x1, 0x0f, 0, mscxujnqnuhc }, { 0x00, 1, 0x30, 4, zoxbzpgkrild }, { 0, 1, 0xc0, 6, bqkwjhxmdzlf }, { 0x80, 2, 0x0f, 0, wowphqlodpqt }, &rkaabhrcosee, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0,9},0,0x10}}, gcpbulrrerdq, NULL };
+static const struct vsghnouiwbyk semrpkmgzkes = { {0, 0, 0, 0, 0, 0, 0}, 0x35, 20, {20, 0, 0, 0}, 186, 183, 184, 397, &rkaabhrcosee, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0,9},0,0x10}}, (neblmufxjobh+5), NULL };
 static const struct fehyfyrgmlkh bfynarpwhgxo = {NULL, &fkblteeqdvec, 2, 165};
-static const struct vsghnouiwbyk byypyoadghjd = { {0, 0, 0, 0, 0, 0, 0}, 0x35, 20, {20, 0, 0, 0}, { 0, 0x1, 0x0f, 0, yqfsdnalmyna }, { 0x00, 1, 0x30, 4, zoxbzpgkrild }, { 0, 1, 0xc0, 6, bqkwjhxmdzlf }, { 0x80, 2, 0x0f, 0, bitfqvjznjnl }, &kwukecrusnya, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0,9},0,0x10}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk rrcjryshsgce = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, { 0x40, 0, 0, 0, NULL}, { 0x40, 0, 0, 0, NULL}, { 0x40, 0, 0, 0, sroodvqdigbh }, { 0xc0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, mjrcpzynekqf, NULL };
-static const struct vsghnouiwbyk unvnzhegbnrb = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 64, {64, 0, 0, 0}, { 0x40, 0, 0, 0, NULL}, { 0x40, 0, 0, 0, NULL}, { 0x40, 0, 0, 0, stgqkuoucjmg }, { 0xc0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, lijheqifumjh, NULL };
-static const struct vsghnouiwbyk vzyoelzqdgzg = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 32, {32, 0, 0, 0}, { 0, 3, 0x0f, 0, qlbsybjbuuwq }, { 0, 1, 0xF0, 4, lnfwnedlkogu }, { 0, 1, 0x0F, 0, tdwegvcedrpe }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0X80}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk zkkvabkzxgem = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 104, {24, 80, 0, 0}, { 1, 2, 0xf0, 4, duzqslhlvrbd }, { 1, 2, 0x07, 0, bafqaozlnera }, { 1, 4, 0xe0, 5, idmdsvmdrdfb }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, wiuiioibmfwg, NULL };
-static const struct vsghnouiwbyk nfjszktunhfg = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 35, {35,0,0,0}, { 0, 1, 0x0f, 0, rnzkhkybayht }, { 0, 0, 0x07, 0, hsuvxgtgltjj}, { 0, 0, 0x30, 4, tgvozcdkwizi}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk spugopwtbinl = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 35, {35,0,0,0}, { 0, 1, 0x0f, 0, huxsncyaliwc }, { 0, 0, 0x07, 0, hsuvxgtgltjj}, { 0, 0, 0x30, 4, tgvozcdkwizi}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk iymxxfzgmije = { {1, 1, 0, 0, 0, 0, 0}, 0x30, 144, {16, 56, 16, 56}, { 1, 3, 0xf0, 4, qlbsybjbuuwq }, { 1, 0, 0xF0, 4, xwsylmhoratf }, { 1, 1, 0x30, 4, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0Xf0}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, hzekdkbdrpvm, NULL };
-static const struct vsghnouiwbyk ynfoubjzgmxd = { {1, 1, 0, 0, 0, 0, 0}, 0x30, 160, {16, 64, 16, 64}, { 1, 3, 0xf0, 4, qlbsybjbuuwq }, { 1, 0, 0xF0, 4, xwsylmhoratf }, { 1, 1, 0x30, 4, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0Xf0}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, hzekdkbdrpvm, NULL };
-static const struct vsghnouiwbyk rojtzzhagiut = { {0, 1, 0, 0, 0, 1, 0}, 0x37, 48, {24, 24, 0, 0}, { 0, 2, 0x0f, 0, rnzkhkybayht }, { 0, 2, 0x70, 4, nbgcalmcrydn }, { 0, 1, 0x70, 4, aqptxectdvef }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 8}, 2, 0xa7}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, dsuxtremdabv, NULL };
-static const struct vsghnouiwbyk rubegqvxrpww = { {0, 1, 0, 0, 0, 1, 0}, 0x21, 102, {34, 34, 34, 0}, { 0, 1, 0x1E, 1, huxsncyaliwc }, { 0, 0, 0x70, 4, hiqcqegacvct }, { 0, 0, 0x0c, 2, watlqftdktqz }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 8}, 0, 0x9c}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, ydnuhcvrirma, NULL };
-static const struct vsghnouiwbyk dvrsczfkecqr = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 100, {50, 50, 0, 0}, { 0, 3, 0x78, 3, duzqslhlvrbd }, { 0x80, 0, 0x0c, 2, qkzbyzcluece }, { 0, 0, 0x30, 4, tgvozcdkwizi }, { 0, 4, 0xff, 0, lmcndmewtobi }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 9}, 5, 0x30}}, fqgiigpemcaz, NULL };
-static const struct vsghnouiwbyk yjxtcmaacuig = { {0, 0, 0, 0, 0, 1, 0}, 0x30, 64, {64, 0, 0, 0}, { 0, 6, 0xFF, 0, hzaxbgzfvbgn }, { 0, 1, 0x0F, 0, sjcyohrqpoaq }, { 0, 1, 0xf0, 4, hydxpacucott }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 7, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, olhrfncspuea, &gxanzhyuafjw };
-static const struct vsghnouiwbyk zgbyxgpkyebe = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 112, {112, 0, 0, 0}, { 0, 7, 0x0f, 0, auwyugwmwlso}, { 0, 6, 0x0f, 0, niaotlqdftsv}, { 0, 8, 0x07, 0, wlrehuclbzxu }, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk abcafvsejaij = { {1, 1, 0, 0, 0, 0, 0}, 0x34, 17, {16, 1, 0, 0}, { 0, 1, 0xF8, 3, tkgjxmqmrafm }, { 0, 1, 0x07, 0, hsuvxgtgltjj }, { 0, 0, 0x03, 0, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 0, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, jhhgzesmesgc, NULL };
-static const struct vsghnouiwbyk ipipwyqtpaaj = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 144, {48, 48, 48, 0}, { 0, 5, 0x0f, 0, huxsncyaliwc }, { 0, 4, 0x70, 4, hsuvxgtgltjj }, { 0, 4, 0x03, 0, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 3, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, ukusubqnfddc, NULL };
-static const struct vsghnouiwbyk paezwzulvdgx = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 144, {48, 48, 48, 0}, { 0, 2, 0xf0, 4, rnzkhkybayht }, { 0, 3, 0x07, 0, eidniawnhpyq }, { 0, 3, 0x70, 4, aglvlpkugvof }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, snxzripxaitf, NULL };
-static const struct vsghnouiwbyk epyoqnvgghdy = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 35, {35,0,0,0}, { 0, 1, 0x0f, 0, qlbsybjbuuwq}, { 0, 0, 0x07, 0, hsuvxgtgltjj}, { 0, 3, 0x03, 0, tgvozcdkwizi}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk mbxiqyepxsjn = { {1, 1, 0, 0, 0, 0, 0}, 0x37, 176, {112, 64, 0, 0}, { 0, 1, 0xf0, 4, qlbsybjbuuwq }, { 0, 7, 0xe0, 5, vfbfuutoazdp }, { 0, 5, 0xe0, 5, vukdbvtfigfk }, { 0, 12, 0x07, 0, tfnbefmjojvh }, &zmhblajtiiim, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vixgnerqasdw, NULL };
-static const struct vsghnouiwbyk tpomjhykpjuo = { {1, 1, 0, 0, 0, 0, 0}, 0x34, 56, {8, 48, 0, 0}, { 1, 2, 0x0f, 0, qlbsybjbuuwq }, { 1, 0, 0x0f, 0, tajyfdalqtrk }, { 1, 1, 0x07, 0, owzoglwzsxda }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, yfkkffuyjdjc, NULL };
-static const struct vsghnouiwbyk fcgssliofujs = { {1, 1, 0, 0, 0, 0, 0}, 0x34, 56, {8, 48, 0, 0}, { 1, 2, 0x7E, 1, rzgdiuvzpbzk }, { 1, 0, 0x0f, 0, tajyfdalqtrk }, { 1, 1, 0x07, 0, owzoglwzsxda }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, yfkkffuyjdjc, &euxkwzlzuwaf };
-static const struct vsghnouiwbyk ctgmvkldoisb = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 168, {16, 96, 56, 0}, { 1, 1, 0xf0, 4, aekximikujqn }, { 1, 1, 0x07, 0, einaxguqxgdv }, { 1, 0, 0x03, 0, ygdgsrknfpiy }, { 2, 1, 0xff, 0, bhpujprhbbzz }, &ygodycsenfrr, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dvlmbpsinqoo, &ymzofyqomcwt };
-static const struct vsghnouiwbyk vkkvnwdbdxmk = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 52, {52, 0, 0, 0}, { 0, 5, 0x0f, 0, qlbsybjbuuwq }, { 0x0, 5, 0x70, 4, ybuezpmusfwy }, { 0, 4, 0x07, 0, aqptxectdvef }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, byrdqdaczwxz, NULL };
-static const struct vsghnouiwbyk wfmzshwqbivk = { {0, 1, 0, 0, 0, 0, 0}, 0x33, 285, {5, 64, 64, 152}, { 3, 6, 0xfe, 1, dirmsniyzxmk }, { 3, 5, 0x70, 4, nzrkfuvfonaq }, { 3, 8, 0xf0, 4, klltwbstguam }, { 0, 0, 0, 0, NULL }, &nxrdhuyhzxrv, {.xdvjpfttnymn.yeltdjdwiegk = {{3, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{3, 9}, 9, 0x0f}}, tqokiavwcgfc, &bnqhrpudkhrd };
-static const struct vsghnouiwbyk ovmlwnlrsevm = { {0, 1, 0, 0 ,0, 0, 0}, 0x36, 216, {64, 152, 0, 0}, { 1, 6, 0xff, 0, jvyasvocpwas }, { 1, 5, 0x70, 4, cmvjkmxfoogt }, { 1, 8, 0xf0, 4, sodnmplfotvu }, { 0, 0, 0, 0, NULL}, &rnlrefsedaas, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, vixgnerqasdw, NULL };
-static const struct vsghnouiwbyk bzjfuxzokxxj = { {0, 1, 0, 0, 0, 0, 0}, 0x31, 317, {5, 160, 152, 0}, { 2, 6, 0xfe, 1, dirmsniyzxmk }, { 2, 5, 0x70, 4, nzrkfuvfonaq }, { 2, 8, 0xf0, 4, sodnmplfotvu }, { 0, 0, 0, 0, NULL }, &fykqxdnfxwad, {.xdvjpfttnymn.yeltdjdwiegk = {{2, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{1, 3}, 12, 0x80}}, qyqoaflwwyom, NULL };
-static const struct vsghnouiwbyk zlgllbxgjtyv = { {0, 1, 0, 0, 0, 1, 0}, 0x30, 128, {64, 64, 0, 0}, { 0, 6, 0xff, 0, hzaxbgzfvbgn }, { 0, 1, 0x0f, 0, sjcyohrqpoaq }, { 0, 1, 0xf0, 4, hydxpacucott }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 7, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, olhrfncspuea, &gxanzhyuafjw };
-static const struct vsghnouiwbyk yxnnabussnqb = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 424, {24, 400, 0, 0}, { 1, 10, 0x3c, 2, qlbsybjbuuwq }, { 1, 22, 0x07, 0, hhhswelrvjuh }, { 1, 22, 0x70, 4, xkbkyujymdhn }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 24, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, wiuiioibmfwg, NULL };
-static const struct vsghnouiwbyk vbzncqmbrymb = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, { 0, 0x1, 0xff, 0, hzaxbgzfvbgn }, { 0, 0, 0x07, 0, ezdvwkrfawmx }, { 0, 0, 0x30, 4, tgvozcdkwizi }, { 0x80, 0, 0, 0, NULL }, &ancqczfcjgbu, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0,8},1,0x16}}, gcpbulrrerdq, NULL };
-static const struct vsghnouiwbyk tiaehomwqyan = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 64, {20, 44, 0, 0}, { 1, 0, 0xf0, 4, qlbsybjbuuwq }, { 1, 0, 0x03, 0, lkbvugtuxcmh }, { 1, 0, 0x0c, 2, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 2, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, ycpdjrrnteir, NULL };
-static const struct vsghnouiwbyk gklxmouxhpyd = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 64, {64, 0, 0, 0}, { 0, 1, 0x0f, 0, pqzbdwgjzgjg }, { 0, 2, 0x0e, 1, fumlhnuvtjti }, { 0, 1, 0x60, 5, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &lsawdfksfpqm, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk tptgodlwulpv = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 192, {32, 160, 0, 0}, { 1, 6, 0x1e, 1, qlbsybjbuuwq }, { 1, 4, 0x07, 0, azkyukdfmqqr }, { 1, 8, 0x07, 0, qtpbyvcfejdx }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 2, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, wiuiioibmfwg, NULL };
-static const struct vsghnouiwbyk yupaowqbbyxt = { {1, 0, 0, 0, 0, 0, 0}, 0x35, 80, {80, 0, 0, 0}, { 0, 3, 0x0f, 0, qlbsybjbuuwq }, { 0, 1, 0x0f, 0, ujgogupnevgb }, { 0, 1, 0xe0, 5, irftdmkwcmwl }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, cxxqpwnfospn, NULL };
-static const struct vsghnouiwbyk qeaqrsqdkjpk = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 56, {56, 0, 0, 0}, { 0, 2, 0x1f, 0, sjmbrhgdfrrn }, { 0, 1, 0x03, 0, smlahnhsfqyk }, { 0, 1, 0x38, 3, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, &lyldgksdaetb };
-static const struct vsghnouiwbyk apjkjngzznni = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 120, {56, 64, 0, 0}, { 1, 1, 0xF0, 4, qlbsybjbuuwq }, { 1, 2, 0x07, 0, hsuvxgtgltjj }, { 1, 3, 0x03, 0, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)ciufpmfcmooy}, yfkkffuyjdjc, NULL };
-static const struct vsghnouiwbyk jqxvxuicdqvd = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 56, {12, 44, 0, 0}, { 1, 3, 0x0f, 0, qlbsybjbuuwq }, { 1, 4, 0x07, 0, hsuvxgtgltjj }, { 1, 3, 0xe0, 5, ylmeljrhbupr }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x03}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, bcvrjesyhbss, NULL };
-static const struct vsghnouiwbyk vmdcinvqgjjl = { {0, 0, 0, 0, 0, 1, 0}, 0x34, 140, {140, 0, 0, 0}, { 0, 16, 0xFF, 0, hzaxbgzfvbgn }, { 0, 15, 0xf0, 4, sjcyohrqpoaq }, { 0, 15, 0x0f, 0, hydxpacucott }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 14, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, cfwgnoydaeun, NULL };
-static const struct vsghnouiwbyk skauvfotzjza = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 128, {112, 16, 0, 0}, { 0, 3, 0x3C, 2, qlbsybjbuuwq }, { 0x80, 2, 0x0e, 1, hlwjchgwhrxt }, { 0, 2, 0x70, 4, xadprewnqthb }, { 0, 3, 0x02, 1, uaghrucblmcx }, &wotkcqwgqcsh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk ussuoboqklzs = { {1, 1, 0, 0, 0, 0, 0}, 0x34, 64, {48, 16, 0, 0}, { 0, 1, 0x0f, 0, huxsncyaliwc }, { 0, 1, 0xc0, 6, ewocvipkuzaw }, { 0x80, 1, 0x30, 4, ygdgsrknfpiy }, { 1, 0, 0x07, 0, enbhuleqjjhe }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, falpnhpaffep, NULL };
-static const struct vsghnouiwbyk etnqgcxgdpra = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 46, {46, 0, 0, 0}, { 0, 3, 0x0f, 0, qlbsybjbuuwq }, { 0, 1, 0x07, 0, wxkwcmkryxyu }, { 0, 2, 0x70, 4, vsldpvefbakr }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x38}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, otmsnntvfxwn, NULL };
-static const struct vsghnouiwbyk jmscofcbmmrb = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 64, {64, 0, 0, 0}, { 0, 1, 0x1f, 0, nemjsunvswft }, { 0, 4, 0x1f, 2, ckgvxwpdxdyf }, { 0, 4, 0x03, 0, gwmvscjwshzk }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 5, 0x40}}, trsclbhfsdgr, NULL };
-static const struct vsghnouiwbyk ddtmmbwuarfg = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 64, {64, 0, 0, 0}, { 0, 1, 0x1f, 0, nemjsunvswft }, { 0, 4, 0x70, 4, acrrvmmzqyhj }, { 0, 4, 0x03, 0, gwmvscjwshzk }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 5, 0x40}}, trsclbhfsdgr, NULL };
-static const struct vsghnouiwbyk zfwbxcjfkwyp = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 96, {96, 0, 0, 0}, { 0, 1, 0x0f, 0, huxsncyaliwc }, { 0, 5, 0xe0, 5, hsuvxgtgltjj }, { 0, 7, 0x60, 5, ygdgsrknfpiy }, { 0, 1, 0xf0, 4, mtfsewvbqxgq }, &lsawdfksfpqm, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 3, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0} }, rlwfjarwbyva, NULL };
-static const struct vsghnouiwbyk mcsyenchtyxw = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 28, {28, 0, 0, 0}, { 0, 2, 0xf0, 4, huxsncyaliwc }, { 0, 1, 0x07, 0, ygcjwyoxujmy }, { 0, 2, 0x07, 0, qtpbyvcfejdx }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, wotxnpmxljzj, NULL };
-static const struct vsghnouiwbyk sprotmwvllqi = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 62, {23, 8, 23, 8}, { 1, 0, 0x78, 3, qlbsybjbuuwq }, { 0, 0, 0x38, 3, hsuvxgtgltjj }, { 1, 0, 0x07, 0, ctwleblehvbl }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, ygcxahquzvij, NULL };
-static const struct vsghnouiwbyk hqmecwqarkrn = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 62, {25, 6, 25, 6}, { 1, 0, 0x0f, 0, auwyugwmwlso }, { 0, 0, 0xe0, 5, qqnypqpywrvq }, { 0, 1, 0x03, 0, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, ygcxahquzvij, NULL };
-static const struct vsghnouiwbyk nmtecvulgoip = { {0, 1, 0, 0, 0, 0, 0}, 0x3C, 85, {76, 9, 0, 0}, { 0, 2, 0xFF, 0, hzaxbgzfvbgn }, { 0, 0, 0x70, 4, ltegqbgfgmvt }, { 0, 1, 0x03, 0, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 1}, 0, 0x0F}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, auqvzdazqbtj, NULL };
-static const struct vsghnouiwbyk fcscuihheeml = { {0, 1, 0, 0, 0, 1, 0}, 0x36, 86, {43, 43, 0, 0}, { 0, 2, 0xf0, 4, duzqslhlvrbd }, { 0x80, 0, 0x0c, 2, qkzbyzcluece }, { 0, 0, 0x30, 4, tgvozcdkwizi }, { 0, 4, 0x30, 4, gogtxxkhbwxb }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 0, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, fqgiigpemcaz, NULL };
-static const struct vsghnouiwbyk tocohkcjkzna = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 104, {104, 0, 0, 0}, { 0, 10, 0x7c, 2, huxsncyaliwc }, { 0, 6, 0xe0, 5, vfbfuutoazdp}, { 0, 4, 0xe0, 5, vukdbvtfigfk}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 9, 0x20}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, &kkcvhmnjrioa };
-static const struct vsghnouiwbyk umuinsqkmnsg = { {1, 1, 0, 0, 0, 0, 0}, 0x36, 96, {48, 48, 0, 0}, { 0, 2, 0x1e, 1, aekximikujqn }, { 0, 1, 0x07, 0, mpbrctckhasl }, { 0, 1, 0x38, 3, qnjhecxddjvg }, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, aduwdhgzncqz, &ylbzoubndlfv };
-static const struct vsghnouiwbyk zvhkxffgmics = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 96, {96, 0, 0, 0}, { 0, 8, 0x1e, 1, duzqslhlvrbd }, { 0x0, 8, 0xe0, 5, bafqaozlnera }, { 0, 6, 0x70, 4, zazdvdrlgoxw }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 6, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, &mqkmpsmdmiru };
-static const struct vsghnouiwbyk njygywbwkqlf = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, { 0, 7, 0x7e, 1, ughfpjcxzynj }, { 0x0, 6, 0x0f, 0, mulochthnhgc }, { 0, 8, 0x07, 0, ctwleblehvbl }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, &orenitlhzwnl };
-static const struct vsghnouiwbyk mqajitxxsmfu = { {1, 1, 0, 0, 0, 0, 0}, 0x34, 33, {1, 32, 0, 0}, { 1, 0, 0x1e, 1, pqzbdwgjzgjg }, { 1, 1, 0xe0, 5, fumlhnuvtjti }, { 1, 0, 0x60, 5, souulsuvkqvp }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, kuyrhcxxyktb, &znvsgukzefgj };
-static const struct vsghnouiwbyk thqkbclxtycm = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, { 0, 7, 0x1e, 1, nvtfnxgsqyky }, { 0x80, 6, 0x07, 0, jzebnhioprnt }, { 0, 8, 0x07, 0, xknpcbptryfb }, { 0, 8, 0xc0, 6, mislybzummhh }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, &somajjvmnyqn };
-static const struct vsghnouiwbyk qmbtwufeeqfl = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 108, {36, 36, 36, 0}, { 0, 2, 0xf0, 4, pqzbdwgjzgjg }, { 0, 3, 0x0c, 2, cuyzhcvurjqp }, { 0, 3, 0x03, 0, tdwegvcedrpe }, { 0, 2, 0x0c, 2, epeeaeljzebe }, &iokfcjotdmmq, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, ydnuhcvrirma, &eycioytqknsx };
-static const struct vsghnouiwbyk fiqbtmhrupvz = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 96, {96, 0, 0, 0}, { 0, 9, 0x1e, 1, pqzbdwgjzgjg }, { 0x0, 9, 0xe0, 5, hsuvxgtgltjj }, { 0, 7, 0x60, 5, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 7, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, &ppycqtphwnuz };
-static const struct vsghnouiwbyk jamxquvfkdsg = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 176, {56, 120, 0, 0}, { 1, 10, 0x7e, 1, ughfpjcxzynj }, { 0x81, 7, 0x70, 4, tmjxndimiwqv }, { 1, 11, 0x70, 4, vsldpvefbakr }, { 1, 5, 0xF0, 4, xnxeqdrldfpq }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 7, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, vixgnerqasdw, &dpcbraygfzzq };
-static const struct vsghnouiwbyk ldugexycddov = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, { 0, 1, 0x1e, 1, pbcogogavqpp }, { 0, 2, 0x06, 1, fonpcaohdilk }, { 0, 1, 0xc0, 6, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, gcpbulrrerdq, &xoktxtcxkstd };
-static const struct vsghnouiwbyk owlrwxanofwz = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 32, {32, 0, 0, 0}, { 0, 3, 0x7e, 1, ughfpjcxzynj }, { 0, 1, 0xf0, 4, lnfwnedlkogu }, { 0, 1, 0x0F, 0, tdwegvcedrpe }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, gcpbulrrerdq, &apvpceeiydcx };
-static const struct vsghnouiwbyk damvxrmxfnmp = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 104, {104, 0, 0, 0}, { 0, 9, 0x0f, 0, qlbsybjbuuwq }, { 0, 6, 0x7f, 0, cwmdpzszkgpi }, { 0, 7, 0x03, 0, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, rlwfjarwbyva, &syjbmjkopivb };
-static const struct vsghnouiwbyk uirdsamgrhxw = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 48, {48, 0, 0, 0}, { 0, 0, 0x1e, 1, rlymjpnqwqxi }, { 0x80, 1, 0x03, 0, wrcxnynhcibi }, { 0, 1, 0x30, 4, tgvozcdkwizi }, { 0, 0, 0x60, 5, cuyzhcvurjqp }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, rlwfjarwbyva, &xlctxukfagla };
-static const struct vsghnouiwbyk awssoupcazci = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, { 0, 2, 0x1e, 1, qlbsybjbuuwq }, { 0, 1, 0x70, 4, mjzkesqcmxsp }, { 0, 7, 0x03, 0, ufmvcxxcfxly }, { 0, 1, 0x0c, 2, batckafsxjzu }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, gcpbulrrerdq, &nydfxdilyimh };
-static const struct vsghnouiwbyk qorspmelxqhz = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 56, {56, 0, 0, 0}, { 0, 1, 0x7e, 1, rzgdiuvzpbzk }, { 0, 0, 0x70, 4, lpolqyvgduhp }, { 0, 0, 0x07, 0, mctpbidjvrsb }, { 0, 5, 0x70, 4, nplzubhhgday }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0x09}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, rlwfjarwbyva, &kawiuujoybwz };
-static const struct vsghnouiwbyk noontgieowal = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 88, {88, 0, 0, 0}, { 0, 2, 0x7e, 1, ughfpjcxzynj }, { 0, 1, 0x70, 4, lpolqyvgduhp }, { 0, 1, 0x07, 0, qnjhecxddjvg }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, trsclbhfsdgr, &ylbzoubndlfv };
-static const struct vsghnouiwbyk fnaluuygdmfe = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 128, {56, 72, 0, 0}, { 1, 1, 0xf8, 3, atzscyghbqee }, { 1, 2, 0x07, 0, hsuvxgtgltjj }, { 1, 3, 0x03, 0, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)aouwrujpaztm}, yfkkffuyjdjc, &gtnfysdofxif };
-static const struct vsghnouiwbyk mroyrcogfukl = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 68, {68, 0, 0, 0}, { 0, 1, 0x0e, 1, ekkpcyyobtwh }, { 0, 0, 0x07, 0, hsuvxgtgltjj }, { 0, 0, 0x30, 4, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, gcpbulrrerdq, &qxdzvqddehie };
-static const struct vsghnouiwbyk ukcuxetjdvyq = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, { 0, 1, 0xf0, 4, qlbsybjbuuwq }, { 0x0, 7, 0xe0, 5, vfbfuutoazdp }, { 0, 5, 0xe0, 5, vukdbvtfigfk }, { 0, 12, 0x07, 0, tfnbefmjojvh }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, &hotyxxcmorep };
-static const struct vsghnouiwbyk wepkfdfscqze = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 72, {72, 0, 0, 0}, { 0, 1, 0xf0, 4, qlbsybjbuuwq }, { 0x0, 6, 0x07, 0, hsuvxgtgltjj }, { 0, 6, 0x30, 4, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, &parpdhefvtab };
-static const struct vsghnouiwbyk ngvwimfmeyod = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 168, {16, 96, 56, 0}, { 1, 1, 0xf0, 4, qlbsybjbuuwq }, { 1, 1, 0x07, 0, einaxguqxgdv }, { 1, 0, 0x03, 0, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{2, 9}, 4, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dvlmbpsinqoo, &dlqgxetzemki };
-static const struct vsghnouiwbyk wjnwczhtuuxp = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 28, {28, 0, 0, 0}, { 0, 2, 0xf0, 4, qasyaeygoyda }, { 0, 1, 0x07, 0, ygcjwyoxujmy }, { 0, 2, 0x07, 0, qtpbyvcfejdx }, { 0, 1, 0x08, 3, wowphqlodpqt }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, olhrfncspuea, &gxanzhyuafjw };
-static const struct vsghnouiwbyk ipkveucjvngp = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 176, {40, 136, 0, 0}, { 1, 5, 0x1E, 1, qlbsybjbuuwq }, { 1, 6, 0x07, 0, smlahnhsfqyk }, { 1, 7, 0x0E, 1, jvocmwauessk }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dyoerhuugkim, &qwctzlqurxdy };
-static const struct vsghnouiwbyk ydbbmldnfdil = { {0, 1, 0, 0, 0, 0, 0}, 0x33, 168, {12, 44, 68, 44}, { 3, 3, 0x0f, 0, qlbsybjbuuwq }, { 3, 4, 0x07, 0, hsuvxgtgltjj }, { 3, 3, 0xe0, 5, ylmeljrhbupr }, { 0, 0, 0, 0, NULL }, &uwamrtxlewym, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x03}, .xdvjpfttnymn.umavhyptrjjy = {{3, 9}, 5, 0x03}}, lxeqknsnwmvy, &qpwvppcoajoo };
-static const struct vsghnouiwbyk qzpzjfwrthog = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 170, {12, 44, 70, 44}, { 3, 3, 0x1e, 1, qlbsybjbuuwq }, { 3, 4, 0x07, 0, hsuvxgtgltjj }, { 3, 3, 0xe0, 5, ylmeljrhbupr }, { 0, 0, 0, 0, NULL }, &uwamrtxlewym, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x03}, .xdvjpfttnymn.umavhyptrjjy = {{3, 9}, 5, 0x03}}, lxeqknsnwmvy, &kxlehxjhafxr };
-static const struct vsghnouiwbyk petmgpdweweo = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 48, {40, 8, 0, 0}, { 0x80, 3, 0x0e, 1, xpatrucniagd }, { 0, 2, 0x07, 0, etirvoycmsmy }, { 0, 2, 0x60, 5, watlqftdktqz }, { 1, 0, 0x0f, 0, nbroaydguqzt }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, yzwkptrlibny, &dzwyylvjtzmk };
-static const struct vsghnouiwbyk umqwspijlhcz = { {1, 1, 0, 0, 0, 0, 0}, 0x34, 72, {8, 64, 0, 0}, { 1, 3, 0x7e, 1, ughfpjcxzynj }, { 1, 1, 0x07, 0, hsuvxgtgltjj }, { 1, 1, 0x70, 4, cnbszmkdlatp }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dyoerhuugkim, &iypacpobzjuo };
-static const struct vsghnouiwbyk jnzhhyvqiztn = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 120, {120, 0, 0, 0}, { 0, 13, 0x1e, 1, nvtfnxgsqyky }, { 0, 6, 0x0f, 0, niaotlqdftsv }, { 0, 8, 0x07, 0, xknpcbptryfb }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, &zjslofaamxyp };
-static const struct vsghnouiwbyk rwdfveovpjgo = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 32, {32, 0, 0, 0}, { 0, 0, 0x1e, 1, qlbsybjbuuwq }, { 0, 1, 0xf0, 4, rnqrphdpnqzx }, { 0, 0, 0x60, 5, souulsuvkqvp }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, ybjlgbokpeap, &bkzbnevwnggk };
-static const struct vsghnouiwbyk qwizybjtbyyb = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 64, {64, 0, 0, 0}, { 0, 1, 0x1e, 1, aekximikujqn }, { 0, 2, 0x0e, 1, fumlhnuvtjti }, { 0, 1, 0x60, 5, ygdgsrknfpiy }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, rlwfjarwbyva, &zbneyfdgjmgd };
-static const struct vsghnouiwbyk xodqjcutcknr = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 32, {32, 0, 0, 0}, { 0, 3, 0x1e, 1, aekximikujqn }, { 0, 1, 0xc0, 6, hprejobsvxdc }, { 0, 1, 0x3f, 0, awyoxyekofnl }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 8}, 2, 0x32}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, &fwvzshasvmyo };
-static const struct vsghnouiwbyk swxieailoqav = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 28, {28, 0, 0, 0}, { 0, 2, 0xf0, 4, qlbsybjbuuwq }, { 0, 1, 0x07, 0, ygcjwyoxujmy }, { 0, 2, 0x07, 0, qtpbyvcfejdx }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, rjvlmqcbgtfl, &gxrgmhwlrkhg };
-static const struct vsghnouiwbyk wiflguavtgql = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 52, {52,0,0,0}, { 0, 5, 0x0e, 1, ekkpcyyobtwh }, { 0, 0, 0x07, 0, fumlhnuvtjti}, { 0, 0, 0x30, 4, ygdgsrknfpiy}, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, gcpbulrrerdq, &xdyyxheudbee };
-static const struct vsghnouiwbyk gnyiirrqqhyi = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 134, {35,32,35,32}, { 0, 1, 0x0f, 0, qlbsybjbuuwq }, { 0, 0, 0x07, 0, pssscpmmpywo }, { 0, 0, 0x30, 4, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, iomtqjccekux, &eftthwofcwcr };
-static const struct vsghnouiwbyk bdgzjstkaojo = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 134, {35,32,35,32}, { 0, 1, 0x0f, 0, oaqarbuqcnzi }, { 0, 0, 0x07, 0, pssscpmmpywo }, { 0, 0, 0x30, 4, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, iomtqjccekux, &xiwmtfzsqzfw };
-static const struct vsghnouiwbyk ncrhbvscpkbn = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 28, {28, 0, 0, 0}, { 0, 2, 0xe0, 5, xwpxrjafcuyl }, { 0, 1, 0x07, 0, ygcjwyoxujmy }, { 0, 2, 0x07, 0, qtpbyvcfejdx }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, rjvlmqcbgtfl, &xaqmghgmbkpb };
-static const struct vsghnouiwbyk xcvzjrborzuw = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 56, {56, 0, 0, 0}, { 0, 1, 0x7e, 1, rzgdiuvzpbzk }, { 0, 4, 0x0e, 1, xodtxovxrqdi }, { 0, 4, 0x70, 4, watlqftdktqz }, { 0, 5, 0xff, 0, mlkdcgbktsbx }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, rlwfjarwbyva, &kawiuujoybwz };
-static const struct vsghnouiwbyk ochjxctvllxd = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 40, {24, 8, 8, 0}, { 1, 0, 0xe0, 5, xgmfromrdrwl }, { 0, 1, 0x70, 4, mtqttagzkyvk }, { 0, 1, 0x03, 0, watlqftdktqz }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0,9},2,0x11}}, tckarflpcrau, &msmrusgxkqtj };
-static const struct vsghnouiwbyk rpssiugcdqmb = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 104, {16, 88, 0, 0}, { 1, 1, 0x7e, 1, rzgdiuvzpbzk }, { 1, 2, 0x07, 0, vsgkdejbfslk }, { 1, 2, 0x38, 3, aglvlpkugvof }, { 0, 0, 0, 0, NULL }, &undgocczxhwe, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 2, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, yfkkffuyjdjc, &hblgrlgpyoet };
-static const struct vsghnouiwbyk chjvxjtvnjfs = { {0, 0, 0, 0, 0, 1, 0}, 0x34, 48, {48, 0, 0, 0}, { 0, 1, 0xf0, 4, aekximikujqn }, { 0, 3, 0x07, 0, lcfcdrxiqyzz }, { 0, 2, 0x03, 0, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x07}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, gcpbulrrerdq, &njduflecdoqp };
-static const struct vsghnouiwbyk mebgwbmezkqk = { {0, 1, 0, 0, 0, 0, 0}, 0x33, 285, {5, 64, 64, 152}, { 3, 6, 0xfc, 2, qlbsybjbuuwq }, { 3, 5, 0x70, 4, nzrkfuvfonaq }, { 3, 8, 0xf0, 4, sodnmplfotvu }, { 0, 0, 0, 0, NULL }, &nxrdhuyhzxrv, {.xdvjpfttnymn.yeltdjdwiegk = {{3, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{3, 9}, 9, 0x0f}}, tqokiavwcgfc, &auaewvylxkez };
-static const struct vsghnouiwbyk kvfopwxchhrg = { {0, 1, 0, 0, 0, 0, 0}, 0x31, 312, {160, 152, 0, 0}, { 1, 6, 0xfe, 1, dirmsniyzxmk }, { 1, 5, 0x70, 4, nzrkfuvfonaq }, { 1, 8, 0xf0, 4, sodnmplfotvu }, { 0, 0, 0, 0, NULL }, &mdxfijtgnbep, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 6, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{1, 9}, 5, 0x01}}, fqdumxtpfoqx, &xzgukzrwqvln };
-static const struct vsghnouiwbyk hbzwausdnyfi = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 56, {48, 8, 0, 0}, { 0, 1, 0xfe, 1, tqqemhnsqtkj }, { 0, 2, 0x0f, 0, swbgzrukfhqt }, { 0, 2, 0x30, 4, tgvozcdkwizi }, { 0, 0, 0, 0, NULL }, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, tcdmydkfkcqe, &kawiuujoybwz };
-static const struct vsghnouiwbyk tmqowiwlbajd = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 67, {35,32,0,0}, { 0, 1, 0x0f, 0, aekximikujqn }, { 0, 0, 0x07, 0, fpcdqkhazcgk }, { 0, 0, 0x30, 4, tgvozcdkwizi }, { 0, 0, 0, 0, NULL}, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vvivsaqmctsn, &dovydskcoyph };
+static const struct vsghnouiwbyk byypyoadghjd = { {0, 0, 0, 0, 0, 0, 0}, 0x35, 20, {20, 0, 0, 0}, 188, 183, 184, 398, &kwukecrusnya, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0,9},0,0x10}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk rrcjryshsgce = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, 399, 399, 400, 401, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, mjrcpzynekqf, NULL };
+static const struct vsghnouiwbyk unvnzhegbnrb = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 64, {64, 0, 0, 0}, 399, 399, 402, 401, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, lijheqifumjh, NULL };
+static const struct vsghnouiwbyk vzyoelzqdgzg = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 32, {32, 0, 0, 0}, 299, 403, 404, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0X80}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk zkkvabkzxgem = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 104, {24, 80, 0, 0}, 211, 212, 405, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 3}, 2, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, wiuiioibmfwg, NULL };
+static const struct vsghnouiwbyk nfjszktunhfg = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 35, {35,0,0,0}, 406, 2, 5, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk spugopwtbinl = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 35, {35,0,0,0}, 65, 2, 5, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk iymxxfzgmije = { {1, 1, 0, 0, 0, 0, 0}, 0x30, 144, {16, 56, 16, 56}, 102, 407, 104, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0Xf0}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, hzekdkbdrpvm, NULL };
+static const struct vsghnouiwbyk ynfoubjzgmxd = { {1, 1, 0, 0, 0, 0, 0}, 0x30, 160, {16, 64, 16, 64}, 102, 407, 104, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0Xf0}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, hzekdkbdrpvm, NULL };
+static const struct vsghnouiwbyk rojtzzhagiut = { {0, 1, 0, 0, 0, 1, 0}, 0x37, 48, {24, 24, 0, 0}, 408, 126, 409, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 8}, 2, 0xa7}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (aduwdhgzncqz+1), NULL };
+static const struct vsghnouiwbyk rubegqvxrpww = { {0, 1, 0, 0, 0, 1, 0}, 0x21, 102, {34, 34, 34, 0}, 410, 411, 412, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 8}, 0, 0x9c}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (qjwvrgtjudlw+1), NULL };
+static const struct vsghnouiwbyk dvrsczfkecqr = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 100, {50, 50, 0, 0}, 413, 414, 5, 415, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 9}, 5, 0x30}}, (fwastflmujzt+1), NULL };
+static const struct vsghnouiwbyk yjxtcmaacuig = { {0, 0, 0, 0, 0, 1, 0}, 0x30, 64, {64, 0, 0, 0}, 274, 275, 276, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 7, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, olhrfncspuea, &gxanzhyuafjw };
+static const struct vsghnouiwbyk zgbyxgpkyebe = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 112, {112, 0, 0, 0}, 34, 35, 416, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk abcafvsejaij = { {1, 1, 0, 0, 0, 0, 0}, 0x34, 17, {16, 1, 0, 0}, 417, 16, 418, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 0, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, jhhgzesmesgc, NULL };
+static const struct vsghnouiwbyk ipipwyqtpaaj = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 144, {48, 48, 48, 0}, 419, 420, 268, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 3, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, ukusubqnfddc, NULL };
+static const struct vsghnouiwbyk paezwzulvdgx = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 144, {48, 48, 48, 0}, 280, 421, 369, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, snxzripxaitf, NULL };
+static const struct vsghnouiwbyk epyoqnvgghdy = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 35, {35,0,0,0}, 1, 2, 169, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk mbxiqyepxsjn = { {1, 1, 0, 0, 0, 0, 0}, 0x37, 176, {112, 64, 0, 0}, 111, 112, 113, 114, &zmhblajtiiim, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vixgnerqasdw, NULL };
+static const struct vsghnouiwbyk tpomjhykpjuo = { {1, 1, 0, 0, 0, 0, 0}, 0x34, 56, {8, 48, 0, 0}, 422, 423, 424, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, yfkkffuyjdjc, NULL };
+static const struct vsghnouiwbyk fcgssliofujs = { {1, 1, 0, 0, 0, 0, 0}, 0x34, 56, {8, 48, 0, 0}, 425, 423, 424, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, yfkkffuyjdjc, &euxkwzlzuwaf };
+static const struct vsghnouiwbyk ctgmvkldoisb = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 168, {16, 96, 56, 0}, 140, 141, 142, 426, &ygodycsenfrr, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dvlmbpsinqoo, &ymzofyqomcwt };
+static const struct vsghnouiwbyk vkkvnwdbdxmk = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 52, {52, 0, 0, 0}, 14, 120, 427, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, byrdqdaczwxz, NULL };
+static const struct vsghnouiwbyk wfmzshwqbivk = { {0, 1, 0, 0, 0, 0, 0}, 0x33, 285, {5, 64, 64, 152}, 57, 58, 428, 0, &nxrdhuyhzxrv, {.xdvjpfttnymn.yeltdjdwiegk = {{3, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{3, 9}, 9, 0x0f}}, tqokiavwcgfc, &bnqhrpudkhrd };
+static const struct vsghnouiwbyk ovmlwnlrsevm = { {0, 1, 0, 0 ,0, 0, 0}, 0x36, 216, {64, 152, 0, 0}, 429, 54, 8, 0, &rnlrefsedaas, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, vixgnerqasdw, NULL };
+static const struct vsghnouiwbyk bzjfuxzokxxj = { {0, 1, 0, 0, 0, 0, 0}, 0x31, 317, {5, 160, 152, 0}, 269, 270, 271, 0, &fykqxdnfxwad, {.xdvjpfttnymn.yeltdjdwiegk = {{2, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{1, 3}, 12, 0x80}}, qyqoaflwwyom, NULL };
+static const struct vsghnouiwbyk zlgllbxgjtyv = { {0, 1, 0, 0, 0, 1, 0}, 0x30, 128, {64, 64, 0, 0}, 274, 275, 276, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 7, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, olhrfncspuea, &gxanzhyuafjw };
+static const struct vsghnouiwbyk yxnnabussnqb = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 424, {24, 400, 0, 0}, 255, 256, 264, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 24, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, wiuiioibmfwg, NULL };
+static const struct vsghnouiwbyk vbzncqmbrymb = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, 68, 69, 5, 18, &ancqczfcjgbu, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0,8},1,0x16}}, (neblmufxjobh+5), NULL };
+static const struct vsghnouiwbyk tiaehomwqyan = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 64, {20, 44, 0, 0}, 304, 430, 431, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 2, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, ycpdjrrnteir, NULL };
+static const struct vsghnouiwbyk gklxmouxhpyd = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 64, {64, 0, 0, 0}, 432, 433, 434, 0, &lsawdfksfpqm, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk tptgodlwulpv = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 192, {32, 160, 0, 0}, 6, 435, 436, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 2, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, wiuiioibmfwg, NULL };
+static const struct vsghnouiwbyk yupaowqbbyxt = { {1, 0, 0, 0, 0, 0, 0}, 0x35, 80, {80, 0, 0, 0}, 299, 389, 390, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, cxxqpwnfospn, NULL };
+static const struct vsghnouiwbyk qeaqrsqdkjpk = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 56, {56, 0, 0, 0}, 437, 438, 439, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), &lyldgksdaetb };
+static const struct vsghnouiwbyk apjkjngzznni = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 120, {56, 64, 0, 0}, 202, 241, 242, 0, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)ciufpmfcmooy}, yfkkffuyjdjc, NULL };
+static const struct vsghnouiwbyk jqxvxuicdqvd = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 56, {12, 44, 0, 0}, 234, 235, 236, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x03}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, bcvrjesyhbss, NULL };
+static const struct vsghnouiwbyk vmdcinvqgjjl = { {0, 0, 0, 0, 0, 1, 0}, 0x34, 140, {140, 0, 0, 0}, 320, 440, 322, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 14, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, cfwgnoydaeun, NULL };
+static const struct vsghnouiwbyk skauvfotzjza = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 128, {112, 16, 0, 0}, 441, 442, 443, 444, &wotkcqwgqcsh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk ussuoboqklzs = { {1, 1, 0, 0, 0, 0, 0}, 0x34, 64, {48, 16, 0, 0}, 65, 445, 446, 447, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, falpnhpaffep, NULL };
+static const struct vsghnouiwbyk etnqgcxgdpra = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 46, {46, 0, 0, 0}, 299, 448, 348, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x38}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, otmsnntvfxwn, NULL };
+static const struct vsghnouiwbyk jmscofcbmmrb = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 64, {64, 0, 0, 0}, 31, 449, 33, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 5, 0x40}}, trsclbhfsdgr, NULL };
+static const struct vsghnouiwbyk ddtmmbwuarfg = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 64, {64, 0, 0, 0}, 31, 450, 33, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 3}, 5, 0x40}}, trsclbhfsdgr, NULL };
+static const struct vsghnouiwbyk zfwbxcjfkwyp = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 96, {96, 0, 0, 0}, 65, 451, 286, 452, &lsawdfksfpqm, {.xdvjpfttnymn.yeltdjdwiegk={{0, 9}, 3, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0} }, (yidkopkslqak+1), NULL };
+static const struct vsghnouiwbyk mcsyenchtyxw = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 28, {28, 0, 0, 0}, 131, 132, 133, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, wotxnpmxljzj, NULL };
+static const struct vsghnouiwbyk sprotmwvllqi = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 62, {23, 8, 23, 8}, 453, 454, 455, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, (rruxbybbhcov+2), NULL };
+static const struct vsghnouiwbyk hqmecwqarkrn = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 62, {25, 6, 25, 6}, 456, 457, 327, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, (rruxbybbhcov+2), NULL };
+static const struct vsghnouiwbyk nmtecvulgoip = { {0, 1, 0, 0, 0, 0, 0}, 0x3C, 85, {76, 9, 0, 0}, 458, 459, 460, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 1}, 0, 0x0F}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, auqvzdazqbtj, NULL };
+static const struct vsghnouiwbyk fcscuihheeml = { {0, 1, 0, 0, 0, 1, 0}, 0x36, 86, {43, 43, 0, 0}, 43, 414, 5, 461, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 0, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (fwastflmujzt+1), NULL };
+static const struct vsghnouiwbyk tocohkcjkzna = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 104, {104, 0, 0, 0}, 462, 20, 21, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 9, 0x20}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), &kkcvhmnjrioa };
+static const struct vsghnouiwbyk umuinsqkmnsg = { {1, 1, 0, 0, 0, 0, 0}, 0x36, 96, {48, 48, 0, 0}, 463, 345, 464, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, aduwdhgzncqz, &ylbzoubndlfv };
+static const struct vsghnouiwbyk zvhkxffgmics = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 96, {96, 0, 0, 0}, 465, 135, 466, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 6, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vjmyvdqynrdc, &mqkmpsmdmiru };
+static const struct vsghnouiwbyk njygywbwkqlf = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, 467, 468, 469, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), &orenitlhzwnl };
+static const struct vsghnouiwbyk mqajitxxsmfu = { {1, 1, 0, 0, 0, 0, 0}, 0x34, 33, {1, 32, 0, 0}, 470, 471, 472, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (falpnhpaffep+1), &znvsgukzefgj };
+static const struct vsghnouiwbyk thqkbclxtycm = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, 473, 474, 36, 475, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), &somajjvmnyqn };
+static const struct vsghnouiwbyk qmbtwufeeqfl = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 108, {36, 36, 36, 0}, 476, 477, 478, 479, &iokfcjotdmmq, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (qjwvrgtjudlw+1), &eycioytqknsx };
+static const struct vsghnouiwbyk fiqbtmhrupvz = { {0, 0, 0, 0, 0, 0, 0}, 0x37, 96, {96, 0, 0, 0}, 480, 285, 286, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 7, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), &ppycqtphwnuz };
+static const struct vsghnouiwbyk jamxquvfkdsg = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 176, {56, 120, 0, 0}, 481, 482, 230, 483, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 7, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, vixgnerqasdw, &dpcbraygfzzq };
+static const struct vsghnouiwbyk ldugexycddov = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 40, {40, 0, 0, 0}, 484, 485, 317, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (neblmufxjobh+5), &xoktxtcxkstd };
+static const struct vsghnouiwbyk owlrwxanofwz = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 32, {32, 0, 0, 0}, 486, 403, 404, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (neblmufxjobh+5), &apvpceeiydcx };
+static const struct vsghnouiwbyk damvxrmxfnmp = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 104, {104, 0, 0, 0}, 284, 487, 488, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (yidkopkslqak+1), &syjbmjkopivb };
+static const struct vsghnouiwbyk uirdsamgrhxw = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 48, {48, 0, 0, 0}, 489, 490, 17, 491, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (yidkopkslqak+1), &xlctxukfagla };
+static const struct vsghnouiwbyk awssoupcazci = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 72, {72, 0, 0, 0}, 95, 330, 492, 493, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 0}, 0, 0}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (neblmufxjobh+5), &nydfxdilyimh };
+static const struct vsghnouiwbyk qorspmelxqhz = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 56, {56, 0, 0, 0}, 494, 495, 496, 497, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0x09}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (yidkopkslqak+1), &kawiuujoybwz };
+static const struct vsghnouiwbyk noontgieowal = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 88, {88, 0, 0, 0}, 498, 499, 500, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, trsclbhfsdgr, &ylbzoubndlfv };
+static const struct vsghnouiwbyk fnaluuygdmfe = { {0, 1, 1, 0, 0, 0, 0}, 0x34, 128, {56, 72, 0, 0}, 501, 241, 242, 0, &olbtwhlypieh, {.jylyhhlxgchq = (bc7215DataVarPkt_t*)aouwrujpaztm}, yfkkffuyjdjc, &gtnfysdofxif };
+static const struct vsghnouiwbyk mroyrcogfukl = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 68, {68, 0, 0, 0}, 502, 2, 5, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (neblmufxjobh+5), &qxdzvqddehie };
+static const struct vsghnouiwbyk ukcuxetjdvyq = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 112, {112, 0, 0, 0}, 111, 112, 113, 114, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), &hotyxxcmorep };
+static const struct vsghnouiwbyk wepkfdfscqze = { {1, 0, 0, 0, 0, 0, 0}, 0x37, 72, {72, 0, 0, 0}, 111, 503, 342, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x02}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), &parpdhefvtab };
+static const struct vsghnouiwbyk ngvwimfmeyod = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 168, {16, 96, 56, 0}, 202, 141, 142, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{2, 9}, 4, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, dvlmbpsinqoo, &dlqgxetzemki };
+static const struct vsghnouiwbyk wjnwczhtuuxp = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 28, {28, 0, 0, 0}, 504, 132, 133, 505, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, olhrfncspuea, &gxanzhyuafjw };
+static const struct vsghnouiwbyk ipkveucjvngp = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 176, {40, 136, 0, 0}, 506, 507, 508, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x40}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (vixgnerqasdw+1), &qwctzlqurxdy };
+static const struct vsghnouiwbyk ydbbmldnfdil = { {0, 1, 0, 0, 0, 0, 0}, 0x33, 168, {12, 44, 68, 44}, 237, 238, 239, 0, &uwamrtxlewym, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x03}, .xdvjpfttnymn.umavhyptrjjy = {{3, 9}, 5, 0x03}}, lxeqknsnwmvy, &qpwvppcoajoo };
+static const struct vsghnouiwbyk qzpzjfwrthog = { {0, 1, 0, 0, 0, 0, 0}, 0x36, 170, {12, 44, 70, 44}, 240, 238, 239, 0, &uwamrtxlewym, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 5, 0x03}, .xdvjpfttnymn.umavhyptrjjy = {{3, 9}, 5, 0x03}}, lxeqknsnwmvy, &kxlehxjhafxr };
+static const struct vsghnouiwbyk petmgpdweweo = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 48, {40, 8, 0, 0}, 509, 266, 510, 511, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0x10}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, yzwkptrlibny, &dzwyylvjtzmk };
+static const struct vsghnouiwbyk umqwspijlhcz = { {1, 1, 0, 0, 0, 0, 0}, 0x34, 72, {8, 64, 0, 0}, 512, 513, 514, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (vixgnerqasdw+1), &iypacpobzjuo };
+static const struct vsghnouiwbyk jnzhhyvqiztn = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 120, {120, 0, 0, 0}, 515, 35, 36, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 5, 0x04}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), &zjslofaamxyp };
+static const struct vsghnouiwbyk rwdfveovpjgo = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 32, {32, 0, 0, 0}, 516, 517, 518, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, ybjlgbokpeap, &bkzbnevwnggk };
+static const struct vsghnouiwbyk qwizybjtbyyb = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 64, {64, 0, 0, 0}, 519, 433, 434, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 2, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (yidkopkslqak+1), &zbneyfdgjmgd };
+static const struct vsghnouiwbyk xodqjcutcknr = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 32, {32, 0, 0, 0}, 520, 521, 522, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 8}, 2, 0x32}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), &fwvzshasvmyo };
+static const struct vsghnouiwbyk swxieailoqav = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 28, {28, 0, 0, 0}, 293, 132, 133, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, rjvlmqcbgtfl, &gxrgmhwlrkhg };
+static const struct vsghnouiwbyk wiflguavtgql = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 52, {52,0,0,0}, 523, 13, 12, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+5), &xdyyxheudbee };
+static const struct vsghnouiwbyk gnyiirrqqhyi = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 134, {35,32,35,32}, 1, 524, 5, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+1), &eftthwofcwcr };
+static const struct vsghnouiwbyk bdgzjstkaojo = { {0, 1, 0, 0, 0, 0, 0}, 0x30, 134, {35,32,35,32}, 525, 524, 5, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, (neblmufxjobh+1), &xiwmtfzsqzfw };
+static const struct vsghnouiwbyk ncrhbvscpkbn = { {1, 0, 0, 0, 0, 0, 0}, 0x34, 28, {28, 0, 0, 0}, 526, 132, 133, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 1, 0xc0}, .xdvjpfttnymn.umavhyptrjjy = {{0,0}, 0, 0}}, rjvlmqcbgtfl, &xaqmghgmbkpb };
+static const struct vsghnouiwbyk xcvzjrborzuw = { {0, 0, 0, 0, 0, 0, 0}, 0x34, 56, {56, 0, 0, 0}, 494, 527, 528, 529, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 4, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (yidkopkslqak+1), &kawiuujoybwz };
+static const struct vsghnouiwbyk ochjxctvllxd = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 40, {24, 8, 8, 0}, 530, 531, 532, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 1, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0,9},2,0x11}}, tckarflpcrau, &msmrusgxkqtj };
+static const struct vsghnouiwbyk rpssiugcdqmb = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 104, {16, 88, 0, 0}, 533, 534, 535, 0, &undgocczxhwe, {.xdvjpfttnymn.yeltdjdwiegk = {{1, 9}, 2, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, yfkkffuyjdjc, &hblgrlgpyoet };
+static const struct vsghnouiwbyk chjvxjtvnjfs = { {0, 0, 0, 0, 0, 1, 0}, 0x34, 48, {48, 0, 0, 0}, 536, 537, 62, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 2, 0x07}, .xdvjpfttnymn.umavhyptrjjy = {{0,0},0,0}}, (neblmufxjobh+5), &njduflecdoqp };
+static const struct vsghnouiwbyk mebgwbmezkqk = { {0, 1, 0, 0, 0, 0, 0}, 0x33, 285, {5, 64, 64, 152}, 538, 58, 59, 0, &nxrdhuyhzxrv, {.xdvjpfttnymn.yeltdjdwiegk = {{3, 9}, 5, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{3, 9}, 9, 0x0f}}, tqokiavwcgfc, &auaewvylxkez };
+static const struct vsghnouiwbyk kvfopwxchhrg = { {0, 1, 0, 0, 0, 0, 0}, 0x31, 312, {160, 152, 0, 0}, 56, 7, 8, 0, &mdxfijtgnbep, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 3}, 6, 0x80}, .xdvjpfttnymn.umavhyptrjjy = {{1, 9}, 5, 0x01}}, fqdumxtpfoqx, &xzgukzrwqvln };
+static const struct vsghnouiwbyk hbzwausdnyfi = { {0, 1, 0, 0, 0, 0, 0}, 0x34, 56, {48, 8, 0, 0}, 539, 540, 541, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x01}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, tcdmydkfkcqe, &kawiuujoybwz };
+static const struct vsghnouiwbyk tmqowiwlbajd = { {0, 1, 0, 0, 0, 0, 0}, 0x37, 67, {35,32,0,0}, 162, 542, 5, 0, &olbtwhlypieh, {.xdvjpfttnymn.yeltdjdwiegk = {{0, 9}, 0, 0x08}, .xdvjpfttnymn.umavhyptrjjy = {{0, 0}, 0, 0}}, vvivsaqmctsn, &dovydskcoyph };
+static const lieoifkbswcz fieldRecs[FIELD_REC_CNT] = { { 0, 0, 0, 0, NULL }, { 0, 1, 0x0f, 0, qlbsybjbuuwq }, { 0, 0, 0x07, 0, hsuvxgtgltjj }, { 0x83, 2, 0x70, 4, vsldpvefbakr }, { 0, 0, 0x30, 4, dvtgclyxpwol }, { 0, 0, 0x30, 4, tgvozcdkwizi }, { 1, 6, 0x1E, 1, qlbsybjbuuwq }, { 1, 5, 0x70, 4, nzrkfuvfonaq }, { 1, 8, 0xf0, 4, sodnmplfotvu }, { 0, 0, 0x70, 4, owzoglwzsxda }, { 0, 5, 0x0f, 0, (nmolzfmcdyct+3) }, { 0, 0, 0x07, 0, fonpcaohdilk }, { 0, 0, 0x30, 4, ygdgsrknfpiy }, { 0, 0, 0x07, 0, fumlhnuvtjti }, { 0, 5, 0x0f, 0, qlbsybjbuuwq }, { 0, 2, 0x0f, 0, qlbsybjbuuwq }, { 0, 1, 0x07, 0, hsuvxgtgltjj }, { 0, 1, 0x30, 4, tgvozcdkwizi }, { 0x80, 0, 0, 0, NULL }, { 0, 1, 0xf8, 3, jlxcxegylhom }, { 0, 6, 0xe0, 5, vfbfuutoazdp }, { 0, 4, 0xe0, 5, vukdbvtfigfk }, { 0, 11, 0x07, 0, tfnbefmjojvh }, { 0, 4, 0xe0, 5, balsfqyllobd }, { 0, 8, 0xff, 0, hzaxbgzfvbgn }, { 0, 0, 0xf0, 4, tajyfdalqtrk }, { 0, 9, 0x03, 0, tgvozcdkwizi }, { 0, 0, 0x07, 0, jprvapuookmy }, { 0, 5, 0xf0, 4, (nmolzfmcdyct+3) }, { 0, 6, 0x07, 0, vdgjgcoiublr }, { 0, 6, 0xC0, 6, tgvozcdkwizi }, { 0, 1, 0x1f, 0, (awiacyajkfbv+11) }, { 0, 4, 0x70, 4, aegickjxmxsj }, { 0, 4, 0x03, 0, gwmvscjwshzk }, { 0, 7, 0x0f, 0, auwyugwmwlso }, { 0, 6, 0x0f, 0, niaotlqdftsv }, { 0, 8, 0x07, 0, xknpcbptryfb }, { 0, 7, 0x0f, 0, evrgvsxldwse }, { 0, 8, 0x07, 0, xzzewdxxicyp }, { 0, 7, 0xff, 0, hmcmmhtpafcl }, { 0, 2, 0xf0, 4, auwyugwmwlso }, { 0, 2, 0x07, 0, umjxfsvzcsro }, { 0, 0, 0xe0, 5, zhfepltcdgom }, { 0, 2, 0xf0, 4, duzqslhlvrbd }, { 0, 2, 0x07, 0, bafqaozlnera }, { 0, 0, 0xe0, 5, qogdydoechiy }, { 0, 0, 0xC0, 6, watlqftdktqz }, { 0, 2, 0x0f, 0, usdftdsdonen }, { 0, 0, 0xff, 0, cdtozclqdgpe }, { 0, 0, 0xe0, 5, wiesewazwfjj }, { 0, 4, 0x0f, 0, zmuhmziggshb }, { 0, 4, 0x30, 4, xramcvgpilnw }, { 0, 2, 0x07, 0, mctpbidjvrsb }, { 1, 9, 0xFE, 1, xgmfromrdrwl }, { 1, 5, 0x70, 4, cmvjkmxfoogt }, { 1, 10, 0x0f, 0, sodnmplfotvu }, { 1, 6, 0xfe, 1, dirmsniyzxmk }, { 3, 6, 0xfe, 1, dirmsniyzxmk }, { 3, 5, 0x70, 4, nzrkfuvfonaq }, { 3, 8, 0xf0, 4, sodnmplfotvu }, { 0, 0x83, 0xff, 0, hzaxbgzfvbgn }, { 0, 1, 0x70, 4, hsuvxgtgltjj }, { 0, 2, 0x03, 0, tgvozcdkwizi }, { 0, 0, 0x70, 4, eertyilkoola }, { 0, 1, 0x30, 4, ygdgsrknfpiy }, { 0, 0x1, 0x0f, 0, huxsncyaliwc }, { 0, 1, 0x70, 4, enfaqllpjsst }, { 0, 0, 0x0f, 0, awcyzokqylxb }, { 0, 0x1, 0xff, 0, hzaxbgzfvbgn }, { 0x00, 0, 0x07, 0, ezdvwkrfawmx }, { 0, 0, 0x30, 6, tgvozcdkwizi }, { 0, 2, 0x60, 5, hsuvxgtgltjj }, { 0, 3, 0xc0, 6, tgvozcdkwizi }, { 0, 0x0, 0xff, 0, klgznqqxptrf }, { 0, 4, 0xf0, 4, gzwyyudcsgwr }, { 0, 7, 0x0f, 0, skpwqtbrungz }, { 0, 0, 0x0f, 0, gpjvwopzumaf }, { 0, 2, 0xf0, 4, xoikkvjtpeyh }, { 0, 0x0, 0x0f, 0, huxsncyaliwc }, { 0x00, 2, 0x07, 0, ajxmlmqzwxcy }, { 0, 0, 0xf0, 4, buuehtaguyng }, { 0x00, 10, 0x07, 0, lcfcdrxiqyzz }, { 0, 4, 0x70, 4, gezfbtusiggj }, { 0, 12, 0x07, 0, pipnpmrpkedm }, { 0, 4, 0xf0, 4, mmaikokpzmiv }, { 0x00, 4, 0x0c, 2, rwxhlwtqcuxy }, { 0x80, 2, 0xe0, 5, oobbdzmmtido }, { 2, 1, 0xff, 0, dijowucrnhyr }, { 0x80, 2, 0xe0, 5, rxjkcgzrlsjg }, { 2, 1, 0xff, 0, khirzhpliszk }, { 0, 3, 0xf0, 4, rnzkhkybayht }, { 0x40, 3, 0xf0, 4, skpwqtbrungz }, { 0, 3, 0x0f, 0, asymsdykfyoh }, { 0x80, 0, 0x0f, 0, kfznlnimdous }, { 0, 4, 0x40, 6, (rowxxcmqcmsr+20) }, { 0, 2, 0x1e, 1, qlbsybjbuuwq }, { 0x0, 1, 0x07, 0, shqsgblklcuc }, { 0, 1, 0x70, 4, mveqqstfduyf }, { 0x0, 0, 0x70, 4, fumlhnuvtjti }, { 0, 0, 0x07, 0, vczurmymtuxp }, { 0x0, 0, 0x70, 4, wrcxnynhcibi }, { 0, 0, 0x0f, 0, qkjrwmuzbyzt }, { 1, 3, 0xf0, 4, qlbsybjbuuwq }, { 0x81, 0, 0xc0, 6, iquqznqnoydo }, { 1, 1, 0x30, 4, ygdgsrknfpiy }, { 0, 0, 0xc0, 6, ploddrlwbsqf }, { 0x40, 3, 0xf0, 4, qlbsybjbuuwq }, { 0, 3, 0xf0, 4, skpwqtbrungz }, { 0, 3, 0x0f, 0, djntjwrzxoau }, { 0, 3, 0x0f, 0, rlymjpnqwqxi }, { 0x0, 3, 0x70, 4, vdgjgcoiublr }, { 0, 1, 0xf0, 4, qlbsybjbuuwq }, { 0x0, 7, 0xe0, 5, vfbfuutoazdp }, { 0, 5, 0xe0, 5, vukdbvtfigfk }, { 0, 12, 0x07, 0, tfnbefmjojvh }, { 0x0, 6, 0xf0, 4, rnuwicqokfnq }, { 0, 5, 0xc0, 6, ygdgsrknfpiy }, { 0, 1, 0x07, 0, dhljfflougxp }, { 0x0, 6, 0xe0, 5, owzoglwzsxda }, { 0, 5, 0xe0, 5, dyzevacnxdjd }, { 0x0, 5, 0x70, 4, (nmolzfmcdyct+4) }, { 0, 4, 0x07, 0, eobqxjqhbanf }, { 1, 5, 0xe0, 5, yzpeqodnfhra }, { 1, 1, 0x30, 4, tfyyqgwxvmya }, { 0x0, 4, 0xFF, 0, tjbeparnujnx }, { 0, 12, 0x0f, 0, (htkixwbtswrg+15) }, { 0x0, 2, 0x70, 4, nbgcalmcrydn }, { 0, 1, 0x30, 4, watlqftdktqz }, { 0, 0x46, 0xFF, 0, nuyihfymrlxy }, { 0x0, 5, 0xf0, 4, txsbffnaanwl }, { 0, 5, 0x0f, 0, obqdvlxymdam }, { 0, 2, 0xf0, 4, huxsncyaliwc }, { 0, 1, 0x07, 0, ygcjwyoxujmy }, { 0, 2, 0x07, 0, qtpbyvcfejdx }, { 0, 8, 0x0f, 0, auwyugwmwlso }, { 0x0, 8, 0xe0, 5, bafqaozlnera }, { 0, 6, 0x60, 5, watlqftdktqz }, { 0, 4, 0x07, 0, obdcmcvhlbdy }, { 0x0, 4, 0x07, 0, skpwqtbrungz }, { 0, 6, 0xe0, 5, qogdydoechiy }, { 1, 1, 0xf0, 4, (nmolzfmcdyct+2) }, { 1, 1, 0x07, 0, einaxguqxgdv }, { 1, 0, 0x03, 0, ygdgsrknfpiy }, { 2, 1, 0xff, 0, bxstpkifthlt }, { 1, 3, 0xff, 0, ybxjhnxfyjgb }, { 1, 0, 0x3f, 0, cxsyqmosciuu }, { 1, 1, 0xff, 0, lhegdqcihvky }, { 1, 16, 0xff, 0, zbzgguwefrup }, { 0, 3, 0xf0, 4, (nmolzfmcdyct+2) }, { 0, 3, 0x07, 0, einaxguqxgdv }, { 0, 2, 0x03, 0, ygdgsrknfpiy }, { 0, 3, 0xf0, 4, qlbsybjbuuwq }, { 1, 12, 0xfe, 1, vmrjepqklhrp }, { 1, 14, 0x0f, 0, ollwywbmbdun }, { 1, 14, 0xf0, 4, riybiayodery }, { 1, 8, 0x0f, 0, zgmshkbdxzgj }, { 0x41, 12, 0xfe, 1, vmrjepqklhrp }, { 0x61, 12, 0x0f, 0, (const uint8_t*)&voimbfxlagws }, { 1, 12, 0xf0, 4, riybiayodery }, { 0, 4, 0x30, 4, bbdoduitrwbi }, { 0x80, 4, 0x30, 4, bbdoduitrwbi }, { 0, 2, 0xff, 0, ggppmvgyklcq }, { 0, 1, 0x0f, 0, (nmolzfmcdyct+2) }, { 0x80, 4, 0x30, 4, kzndtcqngbci }, { 0, 2, 0x10, 4, cztawhzyjhpm }, { 0, 4, 0x0c, 2, gwmvscjwshzk }, { 0, 2, 0xff, 0, pdymzidejhjm }, { 0, 12, 0xff, 0, qdwabnumooho }, { 0, 5, 0xf0, 4, jnwrrmemhpqv }, { 0, 3, 0x03, 0, tgvozcdkwizi }, { 0, 5, 0x20, 5, (nwkwcjmwpwir+13) }, { 0x80, 6, 0x0f, 0, niaotlqdftsv }, { 0, 8, 0xf8, 0, aobugicxmdfl }, { 0, 5, 0xf0, 4, gzobhywjwzgu }, { 0, 3, 0x03, 0, ygdgsrknfpiy }, { 0, 1, 0xff, 0, pyxakjclofwa }, { 0, 7, 0x1e, 1, qlbsybjbuuwq }, { 0, 5, 0x07, 0, hsuvxgtgltjj }, { 0, 6, 0xff, 0, roldsnmewkty }, { 1, 7, 0x0f, 0, auwyugwmwlso }, { 1, 6, 0x0f, 0, niaotlqdftsv }, { 0x01, 8, 0x07, 0, xknpcbptryfb }, { 0, 0x1, 0x0f, 0, imegbmhoswpz }, { 0x00, 1, 0x30, 4, zoxbzpgkrild }, { 0, 1, 0xc0, 6, (tfyyqgwxvmya+1) }, { 0, 2, 0x0f, 0, wowphqlodpqt }, { 0, 0x1, 0x0f, 0, mscxujnqnuhc }, { 0, 2, 0x0f, 0, bitfqvjznjnl }, { 0, 0x1, 0x0f, 0, yqfsdnalmyna }, { 0, 7, 0x0f, 0, qlbsybjbuuwq }, { 0x80, 6, 0x38, 3, qkzbyzcluece }, { 0, 9, 0x07, 0, owzoglwzsxda }, { 0, 8, 0x07, 0, fevrkzpoqnlu }, { 0x1, 6, 0x07, 0, qkzbyzcluece }, { 1, 8, 0x07, 0, tgvozcdkwizi }, { 1, 7, 0x0f, 0, qlbsybjbuuwq }, { 0x81, 6, 0x38, 3, niaotlqdftsv }, { 1, 9, 0x03, 0, tgvozcdkwizi }, { 1, 8, 0x07, 0, fevrkzpoqnlu }, { 1, 6, 0xf0, 4, hnqfngbztkvd }, { 1, 6, 0x07, 0, bafqaozlnera }, { 1, 4, 0xe0, 5, aorqinwjsvvt }, { 1, 1, 0xf0, 4, qlbsybjbuuwq }, { 1, 1, 0x07, 0, smlahnhsfqyk }, { 1, 2, 0x06, 1, tgvozcdkwizi }, { 1, 0, 0x1e, 1, qlbsybjbuuwq }, { 0, 1, 0x0f, 0, niaotlqdftsv }, { 0, 2, 0x07, 0, vsldpvefbakr }, { 0, 0, 0x70, 4, tsasjsbzwxie }, { 1, 6, 0xf0, 4, nvtfnxgsqyky }, { 1, 6, 0xf0, 4, duzqslhlvrbd }, { 1, 2, 0xf0, 4, duzqslhlvrbd }, { 1, 2, 0x07, 0, bafqaozlnera }, { 1, 8, 0x18, 3, souulsuvkqvp }, { 0x80, 0, 0x0c, 2, (uwxqupuffcsf+6) }, { 0, 4, 0x20, 5, vubaykzztfch }, { 1, 1, 0xf0, 4, auwyugwmwlso }, { 1, 0, 0xe0, 5, cnvzopxnosqn }, { 1, 2, 0x70, 4, xknpcbptryfb }, { 0, 4, 0xf0, 4, duzqslhlvrbd }, { 0x0, 4, 0x07, 0, bafqaozlnera }, { 0, 2, 0x70, 4, ghixxwbtroxk }, { 1, 4, 0x0f, 0, duzqslhlvrbd }, { 1, 6, 0x07, 0, xbkwqzgpisrs }, { 0, 6, 0x3e, 1, (awiacyajkfbv+11) }, { 0, 5, 0xc0, 6, lcfcdrxiqyzz }, { 0, 5, 0x0c, 2, gwmvscjwshzk }, { 0, 0, 0x70, 4, buuehtaguyng }, { 1, 10, 0x3e, 1, atzscyghbqee }, { 1, 7, 0x70, 4, tmjxndimiwqv }, { 1, 11, 0x70, 4, vsldpvefbakr }, { 1, 6, 0x04, 2, mwkgnbawnupn }, { 0, 5, 0xe0, 5, gboajlxtrvem }, { 0, 5, 0x0e, 1, hmcqxpcagkyb }, { 1, 3, 0x0f, 0, qlbsybjbuuwq }, { 1, 4, 0x07, 0, hsuvxgtgltjj }, { 1, 3, 0xe0, 5, ylmeljrhbupr }, { 3, 3, 0x0f, 0, qlbsybjbuuwq }, { 3, 4, 0x07, 0, hsuvxgtgltjj }, { 3, 3, 0xe0, 5, ylmeljrhbupr }, { 3, 3, 0x1e, 1, qlbsybjbuuwq }, { 1, 2, 0x07, 0, hsuvxgtgltjj }, { 1, 3, 0x03, 0, ygdgsrknfpiy }, { 0, 4, 0x07, 0, wxkwcmkryxyu }, { 0, 4, 0x30, 4, tgvozcdkwizi }, { 0, 4, 0x0f, 0, iwibokxoamdr }, { 1, 1, 0xfe, 1, vmrjepqklhrp }, { 1, 0, 0x0f, 0, lejoqyagfyzp }, { 1, 0, 0x70, 4, owzoglwzsxda }, { 1, 1, 0xF8, 3, jlxcxegylhom }, { 1, 3, 0x0f, 0, pdsivkkogkpw }, { 1, 1, 0x01, 0, mwkgnbawnupn }, { 0, 3, 0xFF, 0, hzaxbgzfvbgn }, { 0, 1, 0x0f, 0, nzxfabradldm }, { 0, 1, 0xf0, 4, tdwegvcedrpe }, { 1, 10, 0x3c, 2, qlbsybjbuuwq }, { 1, 22, 0x07, 0, hhhswelrvjuh }, { 1, 22, 0x70, 4, cnbszmkdlatp }, { 1, 8, 0xff, 0, lzedgpxidpwo }, { 1, 4, 0x3e, 1, dirmsniyzxmk }, { 1, 3, 0x0f, 0, ziszrqxokrda }, { 1, 6, 0x07, 0, zdumkkqrzozd }, { 1, 2, 0x0f, 0, ntreoxngymvu }, { 1, 22, 0x0f, 0, rdgxenokefnn }, { 1, 22, 0x70, 4, xkbkyujymdhn }, { 0, 3, 0x0f, 0, auwyugwmwlso }, { 0, 2, 0x07, 0, etirvoycmsmy }, { 0, 4, 0x70, 4, hlwjchgwhrxt }, { 0, 4, 0x03, 0, tgvozcdkwizi }, { 2, 6, 0xfe, 1, dirmsniyzxmk }, { 2, 5, 0x70, 4, nzrkfuvfonaq }, { 2, 8, 0xf0, 4, sodnmplfotvu }, { 1, 7, 0x70, 4, tmjxndimiwqv }, { 0, 0x0, 0x0f, 0, qlbsybjbuuwq }, { 0, 6, 0xFF, 0, hzaxbgzfvbgn }, { 0, 1, 0x0F, 0, sjcyohrqpoaq }, { 0, 1, 0xf0, 4, hydxpacucott }, { 0, 4, 0x0f, 0, qlbsybjbuuwq }, { 0, 1, 0x70, 4, buylqkkswbpc }, { 0, 5, 0xe0, 5, exghimrmmgkb }, { 0, 2, 0xf0, 4, rnzkhkybayht }, { 0xC0, 3, 0x0f, 0, wtkljughxyhz }, { 0x40, 4, 0x0f, 0, tgvozcdkwizi }, { 0, 4, 0xff, 0, (rowxxcmqcmsr+21) }, { 0, 9, 0x0f, 0, qlbsybjbuuwq }, { 0, 9, 0xe0, 5, hsuvxgtgltjj }, { 0, 7, 0x60, 5, ygdgsrknfpiy }, { 0, 5, 0x1f, 0, hflaumdbxlvi }, { 0, 5, 0x70, 4, dhxclxrtlauf }, { 0, 4, 0x07, 0, uyyrvcoowruy }, { 0x80, 1, 0xc0, 6, ewocvipkuzaw }, { 0, 4, 0x02, 1, (rowxxcmqcmsr+20) }, { 0, 6, 0xFF, 0, lrpkzrzobwqs }, { 0, 2, 0xf0, 4, qlbsybjbuuwq }, { 0xC0, 3, 0x0f, 0, kmaatknfqqxv }, { 0, 2, 0x07, 0, vdgjgcoiublr }, { 0, 2, 0x60, 5, tgvozcdkwizi }, { 0, 6, 0x70, 4, hsuvxgtgltjj }, { 0, 6, 0x03, 0, (nmolzfmcdyct+4) }, { 0, 3, 0x0F, 0, qlbsybjbuuwq }, { 0, 4, 0x07, 0, jwphqmnoiuwo }, { 0, 4, 0x70, 4, aqptxectdvef }, { 0, 7, 0xe0, 5, ygdgsrknfpiy }, { 0, 5, 0xff, 0, hflaumdbxlvi }, { 1, 0, 0xf0, 4, qlbsybjbuuwq }, { 1, 0, 0x07, 0, sohkunnzjygb }, { 1, 8, 0xf0, 4, riybiayodery }, { 0, 7, 0xff, 0, hmcmmhtpafcl }, { 0, 6, 0x0f, 0, (nwkwcjmwpwir+17) }, { 0, 0, 0x8C, 2, psyzdexniwbw }, { 0, 0, 0x03, 0, souulsuvkqvp }, { 0, 5, 0x1F, 0, duzqslhlvrbd }, { 0, 2, 0x0C, 2, jzebnhioprnt }, { 1, 0, 0x0F, 0, jxwvazqfgoxj }, { 0, 0, 0x07, 0, gboajlxtrvem }, { 0, 0, 0x70, 4, plbsqfqwtdxy }, { 0, 1, 0x30, 4, eoaliifvrjnc }, { 0, 1, 0xc0, 6, tgvozcdkwizi }, { 2, 2, 0xff, 0, lrypgvboynfb }, { 0, 0, 0xf0, 4, riybiayodery }, { 0, 16, 0xff, 0, hzaxbgzfvbgn }, { 0, 15, 0x70, 4, sjcyohrqpoaq }, { 0, 15, 0x0f, 0, hydxpacucott }, { 0, 5, 0xf0, 4, huxsncyaliwc }, { 0, 4, 0x70, 4, uhvnpakabflt }, { 0, 3, 0x1e, 1, duzqslhlvrbd }, { 0, 0, 0xf0, 4, gzwyyudcsgwr }, { 0, 1, 0x03, 0, ygdgsrknfpiy }, { 0x82, 2, 0x70, 4, vsldpvefbakr }, { 0, 2, 0x7f, 0, mnqdymgkrwjk }, { 0, 1, 0x70, 4, mjzkesqcmxsp }, { 0, 7, 0x03, 0, ygdgsrknfpiy }, { 1, 0, 0x1f, 0, (awiacyajkfbv+11) }, { 0, 2, 0x38, 3, mtqttagzkyvk }, { 1, 0, 0x60, 5, tgvozcdkwizi }, { 0, 2, 0x1f, 0, (awiacyajkfbv+11) }, { 0, 1, 0xE0, 5, ddrkrcyvihjd }, { 0, 2, 0xe0, 5, ioyqosfwejrk }, { 1, 1, 0x0f, 0, (nmolzfmcdyct+2) }, { 1, 0, 0x07, 0, gjckeliagtvm }, { 1, 0, 0x30, 4, tgvozcdkwizi }, { 0, 6, 0x07, 0, gjckeliagtvm }, { 0, 6, 0x30, 4, tgvozcdkwizi }, { 0, 6, 0xe0, 5, jeqgpekhirgy }, { 0, 2, 0x0f, 0, (nmolzfmcdyct+3) }, { 0, 1, 0x07, 0, mpbrctckhasl }, { 0, 1, 0x18, 3, tgvozcdkwizi }, { 0, 2, 0x07, 0, hsuvxgtgltjj }, { 0, 2, 0x70, 4, vsldpvefbakr }, { 0, 4, 0x0f, 0, (nmolzfmcdyct+3) }, { 0, 6, 0x07, 0, lcfcdrxiqyzz }, { 0, 6, 0x70, 4, qzwqicrgdjvb }, { 0, 5, 0x30, 4, bwmvykmymvdg }, { 0, 4, 0x1e, 1, xgmfromrdrwl }, { 0, 6, 0x0f, 0, saueijuhxhjx }, { 0, 4, 0x0f, 0, huxsncyaliwc }, { 1, 1, 0xf0, 4, (nmolzfmcdyct+3) }, { 1, 1, 0x07, 0, lcfcdrxiqyzz }, { 1, 2, 0x70, 4, vsldpvefbakr }, { 1, 3, 0x03, 0, bwmvykmymvdg }, { 0, 1, 0xF0, 4, ujhihmyhohwg }, { 0, 0, 0xe0, 5, dcxgciynobhy }, { 0, 0, 0x0c, 2, lcfcdrxiqyzz }, { 0, 3, 0x0e, 1, eidniawnhpyq }, { 0, 6, 0x03, 0, ygdgsrknfpiy }, { 0, 7, 0xff, 0, hzaxbgzfvbgn }, { 0, 2, 0x07, 0, koatbgekibjo }, { 0, 0, 0xf0, 4, tdwegvcedrpe }, { 0, 3, 0x07, 0, qqnypqpywrvq }, { 0, 3, 0x70, 4, awiacyajkfbv }, { 0, 2, 0xe0, 5, hsuvxgtgltjj }, { 0, 5, 0x60, 5, tgvozcdkwizi }, { 1, 9, 0x3E, 1, atzscyghbqee }, { 0x00, 2, 0x07, 0, ltlemtyukwcf }, { 0, 1, 0xff, 0, mcmwdzsspsij }, { 0x80, 3, 0x30, 4, bbdoduitrwbi }, { 0, 3, 0x03, 0, gwmvscjwshzk }, { 0, 2, 0xff, 0, mznzdziymvik }, { 0, 2, 0xff, 0, bzkuzronqwts }, { 0, 2, 0x0f, 0, duzqslhlvrbd }, { 0, 4, 0x18, 3, cuyzhcvurjqp }, { 0, 4, 0x07, 0, zazdvdrlgoxw }, { 0, 0, 0x18, 3, watlqftdktqz }, { 0, 2, 0x03, 0, cuyzhcvurjqp }, { 0, 2, 0x70, 4, zazdvdrlgoxw }, { 0, 1, 0x70, 4, (awiacyajkfbv+3) }, { 0x80, 5, 0xe0, 5, gboajlxtrvem }, { 0, 6, 0x80, 7, (rowxxcmqcmsr+20) }, { 0, 6, 0xC0, 6, jstalkdbnehx }, { 0, 1, 0x0f, 0, ujgogupnevgb }, { 0, 1, 0xe0, 5, irftdmkwcmwl }, { 0, 6, 0x1f, 0, arrgrcqyizqk }, { 1, 4, 0x0f, 0, zmuhmziggshb }, { 1, 4, 0x30, 4, xramcvgpilnw }, { 1, 2, 0x07, 0, mctpbidjvrsb }, { 0x40, 5, 0xf0, 4, ueqljpyepgwu }, { 0, 5, 0xf0, 4, jrumdzqovxoi }, { 0x80, 2, 0x0f, 0, wowphqlodpqt }, { 0x80, 2, 0x0f, 0, bitfqvjznjnl }, { 0x40, 0, 0, 0, NULL }, { 0x40, 0, 0, 0, sroodvqdigbh }, { 0xc0, 0, 0, 0, NULL }, { 0x40, 0, 0, 0, stgqkuoucjmg }, { 0, 1, 0xF0, 4, lnfwnedlkogu }, { 0, 1, 0x0F, 0, tdwegvcedrpe }, { 1, 4, 0xe0, 5, idmdsvmdrdfb }, { 0, 1, 0x0f, 0, rnzkhkybayht }, { 1, 0, 0xF0, 4, xwsylmhoratf }, { 0, 2, 0x0f, 0, rnzkhkybayht }, { 0, 1, 0x70, 4, aqptxectdvef }, { 0, 1, 0x1E, 1, huxsncyaliwc }, { 0, 0, 0x70, 4, hiqcqegacvct }, { 0, 0, 0x0c, 2, watlqftdktqz }, { 0, 3, 0x78, 3, duzqslhlvrbd }, { 0x80, 0, 0x0c, 2, qkzbyzcluece }, { 0, 4, 0xff, 0, lmcndmewtobi }, { 0, 8, 0x07, 0, wlrehuclbzxu }, { 0, 1, 0xF8, 3, (awiacyajkfbv+10) }, { 0, 0, 0x03, 0, tgvozcdkwizi }, { 0, 5, 0x0f, 0, huxsncyaliwc }, { 0, 4, 0x70, 4, hsuvxgtgltjj }, { 0, 3, 0x07, 0, eidniawnhpyq }, { 1, 2, 0x0f, 0, qlbsybjbuuwq }, { 1, 0, 0x0f, 0, tajyfdalqtrk }, { 1, 1, 0x07, 0, owzoglwzsxda }, { 1, 2, 0x7E, 1, rzgdiuvzpbzk }, { 2, 1, 0xff, 0, bhpujprhbbzz }, { 0, 4, 0x07, 0, aqptxectdvef }, { 3, 8, 0xf0, 4, klltwbstguam }, { 1, 6, 0xff, 0, jvyasvocpwas }, { 1, 0, 0x03, 0, lkbvugtuxcmh }, { 1, 0, 0x0c, 2, tgvozcdkwizi }, { 0, 1, 0x0f, 0, (nmolzfmcdyct+3) }, { 0, 2, 0x0e, 1, fumlhnuvtjti }, { 0, 1, 0x60, 5, ygdgsrknfpiy }, { 1, 4, 0x07, 0, azkyukdfmqqr }, { 1, 8, 0x07, 0, qtpbyvcfejdx }, { 0, 2, 0x1f, 0, sjmbrhgdfrrn }, { 0, 1, 0x03, 0, smlahnhsfqyk }, { 0, 1, 0x38, 3, tgvozcdkwizi }, { 0, 15, 0xf0, 4, sjcyohrqpoaq }, { 0, 3, 0x3C, 2, qlbsybjbuuwq }, { 0x80, 2, 0x0e, 1, hlwjchgwhrxt }, { 0, 2, 0x70, 4, xadprewnqthb }, { 0, 3, 0x02, 1, (nwkwcjmwpwir+14) }, { 0, 1, 0xc0, 6, ewocvipkuzaw }, { 0x80, 1, 0x30, 4, ygdgsrknfpiy }, { 1, 0, 0x07, 0, enbhuleqjjhe }, { 0, 1, 0x07, 0, wxkwcmkryxyu }, { 0, 4, 0x1f, 2, ckgvxwpdxdyf }, { 0, 4, 0x70, 4, acrrvmmzqyhj }, { 0, 5, 0xe0, 5, hsuvxgtgltjj }, { 0, 1, 0xf0, 4, mtfsewvbqxgq }, { 1, 0, 0x78, 3, qlbsybjbuuwq }, { 0, 0, 0x38, 3, hsuvxgtgltjj }, { 1, 0, 0x07, 0, owzoglwzsxda }, { 1, 0, 0x0f, 0, auwyugwmwlso }, { 0, 0, 0xe0, 5, qqnypqpywrvq }, { 0, 2, 0xFF, 0, hzaxbgzfvbgn }, { 0, 0, 0x70, 4, ltegqbgfgmvt }, { 0, 1, 0x03, 0, tgvozcdkwizi }, { 0, 4, 0x30, 4, gogtxxkhbwxb }, { 0, 10, 0x7c, 2, huxsncyaliwc }, { 0, 2, 0x1e, 1, (nmolzfmcdyct+2) }, { 0, 1, 0x38, 3, qnjhecxddjvg }, { 0, 8, 0x1e, 1, duzqslhlvrbd }, { 0, 6, 0x70, 4, zazdvdrlgoxw }, { 0, 7, 0x7e, 1, ughfpjcxzynj }, { 0x0, 6, 0x0f, 0, mulochthnhgc }, { 0, 8, 0x07, 0, owzoglwzsxda }, { 1, 0, 0x1e, 1, (nmolzfmcdyct+3) }, { 1, 1, 0xe0, 5, fumlhnuvtjti }, { 1, 0, 0x60, 5, souulsuvkqvp }, { 0, 7, 0x1e, 1, nvtfnxgsqyky }, { 0x80, 6, 0x07, 0, jzebnhioprnt }, { 0, 8, 0xc0, 6, mislybzummhh }, { 0, 2, 0xf0, 4, (nmolzfmcdyct+3) }, { 0, 3, 0x0c, 2, cuyzhcvurjqp }, { 0, 3, 0x03, 0, tdwegvcedrpe }, { 0, 2, 0x0c, 2, epeeaeljzebe }, { 0, 9, 0x1e, 1, (nmolzfmcdyct+3) }, { 1, 10, 0x7e, 1, ughfpjcxzynj }, { 0x81, 7, 0x70, 4, tmjxndimiwqv }, { 1, 5, 0xF0, 4, xnxeqdrldfpq }, { 0, 1, 0x1e, 1, (awiacyajkfbv+1) }, { 0, 2, 0x06, 1, fonpcaohdilk }, { 0, 3, 0x7e, 1, ughfpjcxzynj }, { 0, 6, 0x7f, 0, cwmdpzszkgpi }, { 0, 7, 0x03, 0, tgvozcdkwizi }, { 0, 0, 0x1e, 1, rlymjpnqwqxi }, { 0x80, 1, 0x03, 0, wrcxnynhcibi }, { 0, 0, 0x60, 5, cuyzhcvurjqp }, { 0, 7, 0x03, 0, ufmvcxxcfxly }, { 0, 1, 0x0c, 2, batckafsxjzu }, { 0, 1, 0x7e, 1, rzgdiuvzpbzk }, { 0, 0, 0x70, 4, lpolqyvgduhp }, { 0, 0, 0x07, 0, mctpbidjvrsb }, { 0, 5, 0x70, 4, nplzubhhgday }, { 0, 2, 0x7e, 1, ughfpjcxzynj }, { 0, 1, 0x70, 4, lpolqyvgduhp }, { 0, 1, 0x07, 0, qnjhecxddjvg }, { 1, 1, 0xf8, 3, atzscyghbqee }, { 0, 1, 0x0e, 1, ekkpcyyobtwh }, { 0x0, 6, 0x07, 0, hsuvxgtgltjj }, { 0, 2, 0xf0, 4, qasyaeygoyda }, { 0, 1, 0x08, 3, wowphqlodpqt }, { 1, 5, 0x1E, 1, qlbsybjbuuwq }, { 1, 6, 0x07, 0, smlahnhsfqyk }, { 1, 7, 0x0E, 1, jvocmwauessk }, { 0x80, 3, 0x0e, 1, xpatrucniagd }, { 0, 2, 0x60, 5, watlqftdktqz }, { 1, 0, 0x0f, 0, nbroaydguqzt }, { 1, 3, 0x7e, 1, ughfpjcxzynj }, { 1, 1, 0x07, 0, hsuvxgtgltjj }, { 1, 1, 0x70, 4, cnbszmkdlatp }, { 0, 13, 0x1e, 1, nvtfnxgsqyky }, { 0, 0, 0x1e, 1, qlbsybjbuuwq }, { 0, 1, 0xf0, 4, rnqrphdpnqzx }, { 0, 0, 0x60, 5, souulsuvkqvp }, { 0, 1, 0x1e, 1, (nmolzfmcdyct+2) }, { 0, 3, 0x1e, 1, (nmolzfmcdyct+2) }, { 0, 1, 0xc0, 6, hprejobsvxdc }, { 0, 1, 0x3f, 0, awyoxyekofnl }, { 0, 5, 0x0e, 1, ekkpcyyobtwh }, { 0, 0, 0x07, 0, pssscpmmpywo }, { 0, 1, 0x0f, 0, oaqarbuqcnzi }, { 0, 2, 0xe0, 5, xwpxrjafcuyl }, { 0, 4, 0x0e, 1, xodtxovxrqdi }, { 0, 4, 0x70, 4, watlqftdktqz }, { 0, 5, 0xff, 0, mlkdcgbktsbx }, { 1, 0, 0xe0, 5, xgmfromrdrwl }, { 0, 1, 0x70, 4, mtqttagzkyvk }, { 0, 1, 0x03, 0, watlqftdktqz }, { 1, 1, 0x7e, 1, rzgdiuvzpbzk }, { 1, 2, 0x07, 0, vsgkdejbfslk }, { 1, 2, 0x38, 3, awiacyajkfbv }, { 0, 1, 0xf0, 4, (nmolzfmcdyct+2) }, { 0, 3, 0x07, 0, lcfcdrxiqyzz }, { 3, 6, 0xfc, 2, qlbsybjbuuwq }, { 0, 1, 0xfe, 1, tqqemhnsqtkj }, { 0, 2, 0x0f, 0, swbgzrukfhqt }, { 0, 2, 0x30, 4, tgvozcdkwizi }, { 0, 0, 0x07, 0, fpcdqkhazcgk } };
 static const struct vsghnouiwbyk* jywzwyhwwlhx[] = { &nqcbntpcorjm, &lavqdnlmfywx, &uqxtkwpbvaef, &lnixlwqvlojn, &rdrmpuilokvu, &bbtufostpjbn, &axvbwdtfvhkc, &qsmxzwgieita, &wufgaucrdccc, &gcxkgmwfmkkv, &tvyphljcxzkw, &kppvtjneyxhb, &cceakbeevmud, &xeqmegjnmmpr, &zkopkesbzzkw, &kaskusfbgaxm, &ljfouolbospn, &zpfemwcmdlhc, &zaqvffklbcyp, &gpqtamyqeqso, &tzipwgwupqcm, &rlfryyoglzrw, &ebfnvsnflmhb, &fbvhyfrcgtcj, &xrytsfutulct, &lojhanzqocev, &yhyihafcrqzf, &iqdlpewgtvoz, &vmqwdugblegd, &zloqfhsmqelq, &tqovgenkcvjz, &zdmoxydkfenc, &nemfndaxmwgo, &ahoqbmpvzfaz, &ahtjazfgxldu, &xocvywzuttti, &ucprgxlmtvlr, &qxlwosojboju, &amocaoutzpci, &tinqbldkzibi, &avpnqbczfhid, &xkezaitiqdge, &woieapgobeld, &btzfcptiiggh, &tppabwmpfsci, &jcfjaasgehsc, &dwfwqcqaetxc, &ucejhiuyefrv, &bxqzmmiuriyv, &eqerrehxcrry, &irfhqjyyjfex, &rpujthbsfwef, &srxdyhqmibfa, &dhofleujcyqk, &fgmnwssblgaj, &xgptoowiyydc, &ewjtujleqbzy, &hyhmmikyarju, &sjcrexjwrwdo, &zgncyrorazyy, &bhflfavdejpw, &azbagyhwbkam, &swengmrqfiyi, &nfbkkzawavpt, &bhpjvcjfkgvb, &stftccshxgnw, &cqnelpafgwig, &nzdbxyzkviod, &rhprqrmokjlb, &ezsuqdpbzkob, &htzcsdyeeraq, &uatfwllghqdo, &zjaazwkayftb, &hzvlxeswzobp, &vneficeevhug, &fvcrjmuwsxkv, &beoemlhmiccv, &kghadgokegob, &ncxukazluhfy, &htuklbdisezz, &sonenrionuiu, &ewfrcrrklmuk, &wglwzvhacgmn, &rszgjuhrfwgm, &gmcpklxaurat, &alhjruiazrwi, &dzosszksdzoo, &myjcflmkkgsc, &ukpfcrfhrgug, &kqrwyfcvgnlz, &paeqqjdsrfnt, &dbjsltpmbgoq, &xttfnmbgjwal, &wyksgpticuwi, &nrbveilpjfbw, &yeobnxyjvwij, &fndleauamszv, &zuvkfvvzyyvr, &mzcdqaqfysil, &nvryyqqoomlz, &hdxztezasnbk, &letfeiyhgyvy, &wnjkpivtckvq, &uhnrnfbmaaio, &jhuxbtudabwa, &dsognanhpusz, &kjtwgbydsbrq, &tvjbmiqkyvwz, &zkgdfyieyoxv, &kfiqxgisnmmy, &iewpqkzsaedj, &xngxarrljybh, &bpebpxzcqusj, &jpskkxgsaugj, &mrhrhhgqqtue, &sdnwwfepitur, &vtknycnjzuot, &jaipseoqfjjd, &ticlibjvrnfr, &owovpmzrtkei, &ixhwaobvqsdk, &nlbbipzajbsk, &qzfyfmozspcz, &hinfjnehedmf, &srwcsqpoanux, &nechawtmavfr, &xiumgqrccrjw, &jsmmifwtmhwr, &ljsxaptbeslq, &hsvzyjdwasju, &vkfadeonobsh, &rtprmcyraybo, &ynhxmgxuetst, &onumnaqimutd, &dacyvuezeond, &xlyyyyguhirh, &qnarboxjrxzn, &vxdzvmepjvvw, &belikbrskevt, &vdvubiodajlu, &bujdavsupzey, &bzpgxccuygdj, &xgapiyfdyqej, &ezugptpfzbsu, &amwxhlmwgweb, &usjjkfzdtivx, &tinobgdjddsw, &fychrhgzshew, &zfwbxcjfkwyp, &xprioipfdfus, &rfnrflwnuqav, &ruwlldvyquwu, &rhfhkstmsxtp, &nonrnqmxwbmk, &dxwdteyifhxf, &jnzhhyvqiztn, &kxpowzotobxt, &dhjcyvqfsjfv, &dckwpjtrcquf, &ugrwnkglmliy, &szcgozpgdhlj, &gfzhwwyanuvr, &dphdfbfzweey, &adjhkkqsdmqh, &cdkxnbhpkwur, &yqoylwgfvree, &htmqewjjuchg, &quusmcsmbrdg, &potqaxxhcsxu, &sgmoovzwkufu, &ebevanqcipbu, &ianducitsrqp, &wvybpsgtheih, &hiluulshukkt, &bbmxprqsumyr, &urfurxwqooqq, &xkdlcjkwyutn, &tunbaebrcugn, &qyiaaavqpcrj, &nrzxnreoqfes, &rmwdswfttmbu, &yqsapwqtglab, &hmmzijkzbnxa, &qcgrsxpxneke, &wpdkfzbiblvr, &ddzjxyrgrftr, &vsdfyxzyqdfv, &dsftotuwiohl, &pekcqfxtulwr, &ihyhevxycowr, &iywngrxojtws, &asmgemmtkzbl, &frgkgovuctak, &gcmchtjnfppj, &yhdblojcgnva, &qrwbqaqglhxy, &czhnihunkwan, &bxwfmlvnqwnr, &fsskyqkxdhcs, &unlmpectkiei, &tyhxfbrsvtat, &antbjenlltbx, &sbynchcbxvzz, &tpoussptlpir, &bjyacowgclrs, &xjhuruxmsxur, &ahqnxetdjfhw, &hwszgljvdrlq, &cwbxuyltciee, &yefbhjuaaukj, &gwjuvxfrhkda, &pbwzfbkdvpdh, &tnmzrgshvqop, &omblkccmiqyr, &vzyoelzqdgzg, &qehnqekdxhfv, &zpzfevkcpjud, &zkkvabkzxgem, &nfjszktunhfg, &spugopwtbinl, &iymxxfzgmije, &ynfoubjzgmxd, &rojtzzhagiut, &rubegqvxrpww, &dvrsczfkecqr, &yjxtcmaacuig, &zgbyxgpkyebe, &abcafvsejaij, &ipipwyqtpaaj, &paezwzulvdgx, &epyoqnvgghdy, &mbxiqyepxsjn, &tpomjhykpjuo, &ctgmvkldoisb, &vkkvnwdbdxmk, &wfmzshwqbivk, &ovmlwnlrsevm, &bzjfuxzokxxj, &zlgllbxgjtyv, &yxnnabussnqb, &vbzncqmbrymb, &tiaehomwqyan, &gklxmouxhpyd, &tptgodlwulpv, &yupaowqbbyxt, &qeaqrsqdkjpk, &apjkjngzznni, &jqxvxuicdqvd, &vmdcinvqgjjl, &qzqgxblouioh, &yplqlejdjgfi, &dsiqvttdffga, &cwhedsgdrjao, &skauvfotzjza, &ussuoboqklzs, &dgilrfxeerlc, &etnqgcxgdpra, &jmscofcbmmrb, &ddtmmbwuarfg, &mcsyenchtyxw, &sprotmwvllqi, &hqmecwqarkrn, &nmtecvulgoip, &fcscuihheeml, &tocohkcjkzna, &umuinsqkmnsg, &zvhkxffgmics, &njygywbwkqlf, &mqajitxxsmfu, &thqkbclxtycm, &qmbtwufeeqfl, &fiqbtmhrupvz, &jamxquvfkdsg, &ldugexycddov, &owlrwxanofwz, &damvxrmxfnmp, &uirdsamgrhxw, &awssoupcazci, &fcgssliofujs, &qorspmelxqhz, &noontgieowal, &fnaluuygdmfe, &mroyrcogfukl, &ukcuxetjdvyq, &wepkfdfscqze, &vxpodajlcgua, &ngvwimfmeyod, &wjnwczhtuuxp, &ipkveucjvngp, &bztrmruvgbmz, &ydbbmldnfdil, &wmdxzowfnxmt, &qzpzjfwrthog, &vhahdjtyhnev, &pneqdrabhsuz, &petmgpdweweo, &umqwspijlhcz, &rwdfveovpjgo, &qwizybjtbyyb, &xodqjcutcknr, &swxieailoqav, &wiflguavtgql, &gnyiirrqqhyi, &bdgzjstkaojo, &ncrhbvscpkbn, &xcvzjrborzuw, &ochjxctvllxd, &rpssiugcdqmb, &chjvxjtvnjfs, &mebgwbmezkqk, &kvfopwxchhrg, &hbzwausdnyfi, &tmqowiwlbajd, &igqwlbaumthx, &rrcjryshsgce, &unvnzhegbnrb, &grxqbegngbcc, &semrpkmgzkes, &byypyoadghjd };
 static const uint16_t kbyuvmrshpgh=sizeof(jywzwyhwwlhx)/sizeof(struct vsghnouiwbyk*);
-static uint8_t ipnoikyhfvsm(const lieoifkbswcz* hgdodzdmndla, uint8_t rmlgjqrjacis, bool cxgyosaemdts) { uint8_t atabkdlhwzfl;
+static uint8_t BC7215_HOT_CODE ipnoikyhfvsm(const lieoifkbswcz* hgdodzdmndla, uint8_t rmlgjqrjacis, bool cxgyosaemdts) { uint8_t atabkdlhwzfl;
 uint8_t prkpozyhrlcy;
 uint8_t czwsbpvwbczl = 0;
 if (hgdodzdmndla->hgdodzdmndla != NULL) { atabkdlhwzfl = (nhbvuvmcmmez[hgdodzdmndla->mcddolhbanax&0x03][hgdodzdmndla->ovadtjwxdzya&0x3f]&hgdodzdmndla->maltsbbficvg)>>(hgdodzdmndla->afuqqmowbboa&0x07);
@@ -1364,7 +1366,7 @@ for (zbsbxrmgwhhr=0; zbsbxrmgwhhr<hgdodzdmndla->afuqqmowbboa; zbsbxrmgwhhr++)
 { czwsbpvwbczl |= ipnoikyhfvsm(&fcnqdoabctnl[zbsbxrmgwhhr], rmlgjqrjacis, cxgyosaemdts);
 } } else { czwsbpvwbczl = ipnoikyhfvsm(hgdodzdmndla, rmlgjqrjacis, cxgyosaemdts);
 } return czwsbpvwbczl;
-} static bool qzuszmtpefbs(const struct vsghnouiwbyk* cssjkjaqtock, bool ahyzslokqilb) { uint8_t zbsbxrmgwhhr = 0;
+} static bool BC7215_HOT_CODE qzuszmtpefbs(const struct vsghnouiwbyk* cssjkjaqtock, bool ahyzslokqilb) { uint8_t zbsbxrmgwhhr = 0;
 algorithm_t lfnyzttyzqex;
 jixidamdohep = NULL;
 while (cssjkjaqtock->watvzlijecjx[zbsbxrmgwhhr].lkwfsmdlhdgq != NULL) { lfnyzttyzqex = cssjkjaqtock->watvzlijecjx[zbsbxrmgwhhr].lkwfsmdlhdgq;
@@ -1418,8 +1420,8 @@ rqmmmuvrfikr(ulvlopcjlbnz, iigdpskkkics-1, cwtlqowljkvm);
 } else { binbdllxxutl = iigdpskkkics;
 } noeqfrjfnbkw += cssjkjaqtock->kbuoarkttzag[conewbandlaz];
 conewbandlaz++;
-} } static uint8_t nnkrhrkeffev(uint8_t byte) { return (tqvtyeimyhpa[byte & 0x0F] << 4) | tqvtyeimyhpa[byte >> 4];
-} static uint8_t sjzgkdjqvgzq(uint8_t byte) { return (lxlfwpcgkpnw[byte >> 4]<<4) | lxlfwpcgkpnw[byte & 0x0f];
+} } static uint8_t BC7215_HOT_CODE nnkrhrkeffev(uint8_t byte) { return (tqvtyeimyhpa[byte & 0x0F] << 4) | tqvtyeimyhpa[byte >> 4];
+} static uint8_t BC7215_HOT_CODE sjzgkdjqvgzq(uint8_t byte) { return (lxlfwpcgkpnw[byte >> 4]<<4) | lxlfwpcgkpnw[byte & 0x0f];
 } static void uubekixzgshu(const struct vsghnouiwbyk* cssjkjaqtock) { uint8_t zbsbxrmgwhhr, xogdafopzzfe;
 for (zbsbxrmgwhhr=0; zbsbxrmgwhhr<4; zbsbxrmgwhhr++)
 { for (xogdafopzzfe=0; xogdafopzzfe<(cssjkjaqtock->kbuoarkttzag[zbsbxrmgwhhr]+7)/8; xogdafopzzfe++)
@@ -1432,8 +1434,9 @@ for (zbsbxrmgwhhr=0; zbsbxrmgwhhr<4; zbsbxrmgwhhr++)
 if (fahrenheitInit) { if (ylalbobacimq->nhaqybpfptll != NULL) { xjgqucrcjtuj = ylalbobacimq->nhaqybpfptll->iqhduifjeusb[nwafzsyodvlc-60];
 } else { xjgqucrcjtuj = ghgjjuztaesj.iqhduifjeusb[nwafzsyodvlc-60];
 } } else { xjgqucrcjtuj = cdceqlsppczl-16;
-} if (ipnoikyhfvsm(&cssjkjaqtock->urotzxmebdry, xjgqucrcjtuj, dieecgizrxee) != 0) { return false;
-} if (ipnoikyhfvsm(&cssjkjaqtock->rozfsolwsfzh, MODE_COOL, dieecgizrxee) != 0) { return false;
+} if (anyStateInit) { if ((gvmzfeyguymh(&FIELD_REC(cssjkjaqtock->urotzxmebdry), 15) < 0) || (gvmzfeyguymh(&FIELD_REC(cssjkjaqtock->rozfsolwsfzh), 5) < 0)) { return false;
+} } else if (ipnoikyhfvsm(&FIELD_REC(cssjkjaqtock->urotzxmebdry), xjgqucrcjtuj, dieecgizrxee) != 0) { return false;
+} else if (ipnoikyhfvsm(&FIELD_REC(cssjkjaqtock->rozfsolwsfzh), MODE_COOL, dieecgizrxee) != 0) { return false;
 } return qzuszmtpefbs(cssjkjaqtock, dieecgizrxee);
 } static int8_t gvmzfeyguymh(const lieoifkbswcz* hgdodzdmndla, uint8_t bgxrgfmymfwn) { lieoifkbswcz smnosuqabxcv = *hgdodzdmndla;
 int8_t zbsbxrmgwhhr;
@@ -1447,7 +1450,7 @@ while (zbsbxrmgwhhr >= 0) { if (ipnoikyhfvsm(&smnosuqabxcv, zbsbxrmgwhhr, dieecg
 } static int8_t wgocioibmpsi(const struct wscodbmjbktx* mgqnuqcefqhy) { int8_t zbsbxrmgwhhr;
 int8_t qxmdmyxasydo, xtxmdvizxndc;
 int8_t ncpzpizkzeve = -1;
-lieoifkbswcz smnosuqabxcv = ylalbobacimq->urotzxmebdry;
+lieoifkbswcz smnosuqabxcv = FIELD_REC(ylalbobacimq->urotzxmebdry);
 smnosuqabxcv.mcddolhbanax &= 0x3f;
 for (zbsbxrmgwhhr=0; zbsbxrmgwhhr<15; zbsbxrmgwhhr++)
 { qxmdmyxasydo = 14-zbsbxrmgwhhr;
@@ -1459,7 +1462,7 @@ if (mgqnuqcefqhy->vzkqjiprdpjc.hgdodzdmndla != NULL ) { if (edebutywnedh(&mgqnuq
 } } } } return ncpzpizkzeve;
 } static int8_t iznnydsjihel(const struct vsghnouiwbyk* cssjkjaqtock) { int8_t dskbycvacpfu;
 dskbycvacpfu = 1;
-if (!cssjkjaqtock->spec.ymmnbayvgjbe) { if ((cssjkjaqtock->wlujocdbskis.hgdodzdmndla != NULL) && (cssjkjaqtock->wlujocdbskis.hgdodzdmndla[0] != cssjkjaqtock->wlujocdbskis.hgdodzdmndla[4]) && !((cssjkjaqtock->urotzxmebdry.mcddolhbanax&0x80) || (cssjkjaqtock->rozfsolwsfzh.mcddolhbanax&0x80) || (cssjkjaqtock->ofajzwessiol.mcddolhbanax&0x80))) { if (ipnoikyhfvsm(&cssjkjaqtock->wlujocdbskis, 4, dieecgizrxee) == 0) { if (cssjkjaqtock->wlujocdbskis.hgdodzdmndla[4] == cssjkjaqtock->wlujocdbskis.hgdodzdmndla[5]) { dskbycvacpfu = 2;
+if (!cssjkjaqtock->spec.ymmnbayvgjbe) { if ((FIELD_REC(cssjkjaqtock->wlujocdbskis).hgdodzdmndla != NULL) && (FIELD_REC(cssjkjaqtock->wlujocdbskis).hgdodzdmndla[0] != FIELD_REC(cssjkjaqtock->wlujocdbskis).hgdodzdmndla[4]) && !((FIELD_REC(cssjkjaqtock->urotzxmebdry).mcddolhbanax&0x80) || (FIELD_REC(cssjkjaqtock->rozfsolwsfzh).mcddolhbanax&0x80) || (FIELD_REC(cssjkjaqtock->ofajzwessiol).mcddolhbanax&0x80))) { if (ipnoikyhfvsm(&FIELD_REC(cssjkjaqtock->wlujocdbskis), 4, dieecgizrxee) == 0) { if (FIELD_REC(cssjkjaqtock->wlujocdbskis).hgdodzdmndla[4] == FIELD_REC(cssjkjaqtock->wlujocdbskis).hgdodzdmndla[5]) { dskbycvacpfu = 2;
 } else { dskbycvacpfu = 0;
 return dskbycvacpfu;
 } } } if ( !( (ylalbobacimq->lzjiegmlwhzf.xdvjpfttnymn.yeltdjdwiegk.mekzztbhyjqh.enrplqfjlsgv == 0) && (ylalbobacimq->lzjiegmlwhzf.xdvjpfttnymn.yeltdjdwiegk.bits == 0) && (ylalbobacimq->lzjiegmlwhzf.xdvjpfttnymn.umavhyptrjjy.mekzztbhyjqh.enrplqfjlsgv == 0) && (ylalbobacimq->lzjiegmlwhzf.xdvjpfttnymn.umavhyptrjjy.bits == 0) ) ) { if ( ocfvqbiqxxim(&ylalbobacimq->lzjiegmlwhzf.xdvjpfttnymn.yeltdjdwiegk, dieecgizrxee) && ocfvqbiqxxim(&ylalbobacimq->lzjiegmlwhzf.xdvjpfttnymn.umavhyptrjjy, dieecgizrxee) ) { dskbycvacpfu = 0;
@@ -1468,19 +1471,19 @@ return dskbycvacpfu;
 } else { dskbycvacpfu = 2;
 } } } } else { dskbycvacpfu = -1;
 } return dskbycvacpfu;
-} static uint8_t gqmcotevjdlf(uint8_t ulvlopcjlbnz, uint8_t bits, uint8_t* jtpeziwhttww) { uint8_t byte;
+} static uint8_t BC7215_HOT_CODE gqmcotevjdlf(uint8_t ulvlopcjlbnz, uint8_t bits, uint8_t* jtpeziwhttww) { uint8_t byte;
 if ((bits != 8) && (bits != 0)) { byte = ulvlopcjlbnz&gtlmwdqemewe[bits];
 ulvlopcjlbnz >>= bits;
 ulvlopcjlbnz |= (*jtpeziwhttww<<(8-bits));
 *jtpeziwhttww = byte;
 } return ulvlopcjlbnz;
-} static uint8_t nihsdvwrwdok(uint8_t ulvlopcjlbnz, uint8_t bits, uint8_t* jtpeziwhttww) { uint8_t byte;
+} static uint8_t BC7215_HOT_CODE nihsdvwrwdok(uint8_t ulvlopcjlbnz, uint8_t bits, uint8_t* jtpeziwhttww) { uint8_t byte;
 if ((bits != 8) && (bits != 0)) { byte = ulvlopcjlbnz&zcrduqdktess[bits];
 ulvlopcjlbnz <<= bits;
 ulvlopcjlbnz |= (*jtpeziwhttww>>(8-bits));
 *jtpeziwhttww = byte;
 } return ulvlopcjlbnz;
-} static void gefhjoxgjdgt(const struct vsghnouiwbyk* cssjkjaqtock) { uint8_t mcddolhbanax;
+} static void BC7215_HOT_CODE gefhjoxgjdgt(const struct vsghnouiwbyk* cssjkjaqtock) { uint8_t mcddolhbanax;
 uint16_t xogdafopzzfe;
 uint8_t wvlrpkxtsolz = 0;
 uint16_t igftupmalrfe = 0;
@@ -1501,7 +1504,7 @@ roadpqxtnnar = (8-qyijmidcihgt)&0x07;
 if ((roadpqxtnnar != 0) && (mcddolhbanax != 3) && (cssjkjaqtock->kbuoarkttzag[mcddolhbanax+1] != 0)){ if ((cssjkjaqtock->signature&0x30) == 0x30) { nheotrjqxqej.data[wvlrpkxtsolz-1] = (nheotrjqxqej.data[wvlrpkxtsolz-1]&gtlmwdqemewe[qyijmidcihgt]) | (gqikxxqqjecf[mcddolhbanax+1][0] << qyijmidcihgt);
 } else { nheotrjqxqej.data[wvlrpkxtsolz-1] = (nheotrjqxqej.data[wvlrpkxtsolz-1]&zcrduqdktess[qyijmidcihgt]) | (gqikxxqqjecf[mcddolhbanax+1][0] >> qyijmidcihgt);
 } } } } if (cssjkjaqtock->spec.haibeofkrlkw && cssjkjaqtock->spec.zqbpbblioehh) { memcpy(iukuxevqncnf.data, nheotrjqxqej.data, (nheotrjqxqej.bitLen+7)/8);
-memcpy(nheotrjqxqej.data, exhfmkybxmek.data, (nheotrjqxqej.bitLen+7)/8);
+memcpy(nheotrjqxqej.data, encodeBase->data, (nheotrjqxqej.bitLen+7)/8);
 igftupmalrfe = 0;
 for (xogdafopzzfe=0; xogdafopzzfe<nheotrjqxqej.bitLen/2; xogdafopzzfe++)
 { wvlrpkxtsolz = xogdafopzzfe/4;
@@ -1530,7 +1533,7 @@ if ((ujhiewtyxcqw & 0xaa) == 0) { if ((ujhiewtyxcqw & 0x55) == 0) { iukuxevqncnf
 } static void ckbvbvcobbdk(const struct vsghnouiwbyk* cssjkjaqtock, bc7215DataVarPkt_t* ulvlopcjlbnz) { mfvmvvsrgpmq(nhbvuvmcmmez, ulvlopcjlbnz, cssjkjaqtock);
 if (cssjkjaqtock->spec.xhxfnnwqvdiy) { uubekixzgshu(cssjkjaqtock);
 } if (cssjkjaqtock->spec.haibeofkrlkw && !cssjkjaqtock->spec.zqbpbblioehh) { musinwgvcyci(cssjkjaqtock);
-} } static void qswuykmdmlug(const struct vsghnouiwbyk* cssjkjaqtock) { uint8_t zbsbxrmgwhhr, xogdafopzzfe;
+} } static void BC7215_HOT_CODE qswuykmdmlug(const struct vsghnouiwbyk* cssjkjaqtock) { uint8_t zbsbxrmgwhhr, xogdafopzzfe;
 uint8_t hwubnddjolvl;
 uint8_t drkbvldzxnru;
 for (zbsbxrmgwhhr=0; zbsbxrmgwhhr<4; zbsbxrmgwhhr++)
@@ -1558,7 +1561,7 @@ exhfmkybxmek = eokpcvziyoim;
 } static bool gwtlojdyjddv(uint16_t ouejkknsqeke) { ylalbobacimq = jywzwyhwwlhx[ouejkknsqeke];
 altProtocolUsing = false;
 if (((ymndlmvtogxm&0xbf) == ylalbobacimq->signature) && (exhfmkybxmek.bitLen == ylalbobacimq->bitLen)) { spitddtdgatl(ylalbobacimq, ymndlmvtogxm, (const bc7215DataVarPkt_t*)&exhfmkybxmek);
-if (jjnbcsyhvcga(ylalbobacimq)) { if (ylalbobacimq->rozfsolwsfzh.mcddolhbanax&0x20) { ((const struct sxpegamfsrfd*)ylalbobacimq->rozfsolwsfzh.hgdodzdmndla)->cssjkjaqtock.lzjiegmlwhzf.dmfwafbbczce(NULL, NULL);
+if (jjnbcsyhvcga(ylalbobacimq)) { if (FIELD_REC(ylalbobacimq->rozfsolwsfzh).mcddolhbanax&0x20) { ((const struct sxpegamfsrfd*)FIELD_REC(ylalbobacimq->rozfsolwsfzh).hgdodzdmndla)->cssjkjaqtock.lzjiegmlwhzf.dmfwafbbczce(NULL, NULL);
 } return true;
 } } return false;
 } static bool kkmytcenwsqk(bc7215FormatPkt_t* format, uint16_t nuxphdlgtwhq, uint8_t gukarciyihed, uint8_t qiplgeopecdc) { uint8_t zbsbxrmgwhhr, xogdafopzzfe, oldSpecial, newSpecial, oldTypeCnt;
@@ -1626,17 +1629,17 @@ gefhjoxgjdgt(&finjgceabaok);
 return true;
 } return false;
 } static void gzeafamodmeb(const struct vsghnouiwbyk* cssjkjaqtock) { const srbjiaxreyht* inmcnwbfvdrq;
-if (cssjkjaqtock->wlujocdbskis.mcddolhbanax&0x80) { inmcnwbfvdrq = ((const struct fehyfyrgmlkh*)cssjkjaqtock->urjrhromzium->set.rvrkwqgflpkv)->hffaidvvtesl;
+if (FIELD_REC(cssjkjaqtock->wlujocdbskis).mcddolhbanax&0x80) { inmcnwbfvdrq = ((const struct fehyfyrgmlkh*)cssjkjaqtock->urjrhromzium->set.rvrkwqgflpkv)->hffaidvvtesl;
 } else { inmcnwbfvdrq = cssjkjaqtock->urjrhromzium->set.rvrkwqgflpkv;
 } while ((inmcnwbfvdrq != NULL) && (inmcnwbfvdrq->swagwauldrhl != NULL)) { if ((awafvcglyvyh[inmcnwbfvdrq->wehefbyxzswp] >= 0) && (awafvcglyvyh[inmcnwbfvdrq->wehefbyxzswp] < 0x0f)) { nhbvuvmcmmez[inmcnwbfvdrq->mcddolhbanax][inmcnwbfvdrq->ovadtjwxdzya&0x3f] = (nhbvuvmcmmez[inmcnwbfvdrq->mcddolhbanax][inmcnwbfvdrq->ovadtjwxdzya&0x3f]&(~inmcnwbfvdrq->maltsbbficvg)) | (inmcnwbfvdrq->swagwauldrhl[awafvcglyvyh[inmcnwbfvdrq->wehefbyxzswp]]&inmcnwbfvdrq->maltsbbficvg);
 } inmcnwbfvdrq++;
-} } static const bc7215DataVarPkt_t* rjnjgrjfaldn(uint8_t newlbelwshvz) { spitddtdgatl(ylalbobacimq, ymndlmvtogxm, (const bc7215DataVarPkt_t*)&exhfmkybxmek);
+} } static const bc7215DataVarPkt_t* rjnjgrjfaldn(uint8_t newlbelwshvz) { extractBase();
 if ((newlbelwshvz == 4) || ylalbobacimq->spec.cmdkwamqxjvi) { ocfvqbiqxxim(&ylalbobacimq->lzjiegmlwhzf.xdvjpfttnymn.yeltdjdwiegk, xclzxnzrkvdh);
 ocfvqbiqxxim(&ylalbobacimq->lzjiegmlwhzf.xdvjpfttnymn.umavhyptrjjy, xclzxnzrkvdh);
 } daileifiahoj[0] = 0;
 daileifiahoj[1] = 0;
 daileifiahoj[2] = 0;
-daileifiahoj[3] = ipnoikyhfvsm(&ylalbobacimq->wlujocdbskis, newlbelwshvz, xclzxnzrkvdh);
+daileifiahoj[3] = ipnoikyhfvsm(&FIELD_REC(ylalbobacimq->wlujocdbskis), newlbelwshvz, xclzxnzrkvdh);
 awafvcglyvyh[0] = -1;
 awafvcglyvyh[1] = -1;
 awafvcglyvyh[2] = -1;
@@ -1645,12 +1648,12 @@ gzeafamodmeb(ylalbobacimq);
 qzuszmtpefbs(ylalbobacimq, xclzxnzrkvdh);
 qswuykmdmlug(ylalbobacimq);
 gefhjoxgjdgt(ylalbobacimq);
-spitddtdgatl(ylalbobacimq, ymndlmvtogxm, (const bc7215DataVarPkt_t*)&exhfmkybxmek);
+extractBase();
 if (altProtocolUsing) { seuhgjhlwgpz.body.msg.fmt = &dayyhlonocwg;
 seuhgjhlwgpz.body.msg.datPkt = (bc7215DataVarPkt_t*)&nheotrjqxqej;
 return (const bc7215DataVarPkt_t*)&seuhgjhlwgpz;
 } else { return (const bc7215DataVarPkt_t*)&nheotrjqxqej;
-} } static void wbcduhhgptha(uint8_t gngxjwglbvkk, uint8_t qbocfcxvlfwp) { uint8_t jcaugigjuxpp;
+} } static void BC7215_HOT_CODE wbcduhhgptha(uint8_t gngxjwglbvkk, uint8_t qbocfcxvlfwp) { uint8_t jcaugigjuxpp;
 uint8_t kbeujlhwezcc;
 uint8_t hgdodzdmndla;
 jcaugigjuxpp = gngxjwglbvkk >> 4 ;
@@ -1669,6 +1672,12 @@ const bc7215FormatPkt_t* fmt = NULL;
 ylalbobacimq = NULL;
 formatLoaded = false;
 secFmtLoaded = false;
+baseRestorePending = false;
+dropBaseSegments();
+#if BC7215_AC_CACHE_POWER_FRAMES == 1
+onFrameReady = false;
+offFrameReady = false;
+#endif
 if ((dataPktCool25C != NULL) && !(ysvohcihtbrc&0x80)) { if (dataPktCool25C->bitLen == 0) { fmt = ((const bc7215CombinedMsg_t*)dataPktCool25C)->body.msg.fmt;
 if (fmt != NULL) { dayyhlonocwg = *fmt;
 formatLoaded = true;
@@ -1679,10 +1688,21 @@ exhfmkybxmek.bitLen = dataPktCool25C->bitLen;
 drkbvldzxnru = (exhfmkybxmek.bitLen+7)/8;
 memcpy(exhfmkybxmek.data, dataPktCool25C->data, drkbvldzxnru);
 pasvjyeomvil = -1;
+anyStateInit = false;
 for (zbsbxrmgwhhr=0; zbsbxrmgwhhr<kbyuvmrshpgh; zbsbxrmgwhhr++) {
 if (gwtlojdyjddv(zbsbxrmgwhhr)) { pasvjyeomvil = zbsbxrmgwhhr;
+cachePowerFrames();
 return true;
-} } } return false;
+} }
+#if BC7215_AC_ANY_STATE_INIT == 1
+anyStateInit = true;
+for (zbsbxrmgwhhr=0; zbsbxrmgwhhr<kbyuvmrshpgh; zbsbxrmgwhhr++) {
+if (gwtlojdyjddv(zbsbxrmgwhhr)) { pasvjyeomvil = zbsbxrmgwhhr;
+cachePowerFrames();
+return true;
+} } anyStateInit = false;
+#endif
+} return false;
 } static bool ubuixaonhsci(uint8_t juostbfhgyaw, const bc7215CombinedMsg_t hundllzjmjvv[], uint8_t yarepiinyowq) { ylalbobacimq = NULL;
 if (hundllzjmjvv[0].body.msg.fmt != NULL) { dayyhlonocwg = *hundllzjmjvv[0].body.msg.fmt;
 if (rthpwldrqgbh(juostbfhgyaw, hundllzjmjvv) && fcfezowamxqr(hundllzjmjvv[0].body.msg.datPkt->bitLen, juostbfhgyaw, yarepiinyowq)) { return unhdgzknbslk(dayyhlonocwg.signature.bits.sig, (const bc7215DataVarPkt_t*)&nheotrjqxqej);
@@ -1691,17 +1711,29 @@ if (rthpwldrqgbh(juostbfhgyaw, hundllzjmjvv) && fcfezowamxqr(hundllzjmjvv[0].bod
 uint8_t jcrmavnazlar;
 uint8_t pnklibodyrgj;
 const struct vsghnouiwbyk* mjtbuhyzuuvb;
+#if BC7215_AC_KEEP_BASE_SEGMENTS == 1
+bool secBaseKept = false;
+#endif
 tmpProtocolUsing = false;
 mjtbuhyzuuvb = ylalbobacimq;
-if ((ckfkxrimjrfl == KEY_MODE) && (ylalbobacimq->rozfsolwsfzh.mcddolhbanax&0x20)) { ylalbobacimq = &((const struct sxpegamfsrfd*)ylalbobacimq->rozfsolwsfzh.hgdodzdmndla)->cssjkjaqtock;
+if ((ckfkxrimjrfl == KEY_MODE) && (FIELD_REC(ylalbobacimq->rozfsolwsfzh).mcddolhbanax&0x20)) { ylalbobacimq = &((const struct sxpegamfsrfd*)FIELD_REC(ylalbobacimq->rozfsolwsfzh).hgdodzdmndla)->cssjkjaqtock;
 tmpProtocolUsing = true;
-} else if (((ckfkxrimjrfl == KEY_PLUS) || (ckfkxrimjrfl == KEY_MINUS)) && (ylalbobacimq->urotzxmebdry.mcddolhbanax&0x20)) { ylalbobacimq = &((const struct sxpegamfsrfd*)ylalbobacimq->urotzxmebdry.hgdodzdmndla)->cssjkjaqtock;
+} else if (((ckfkxrimjrfl == KEY_PLUS) || (ckfkxrimjrfl == KEY_MINUS)) && (FIELD_REC(ylalbobacimq->urotzxmebdry).mcddolhbanax&0x20)) { ylalbobacimq = &((const struct sxpegamfsrfd*)FIELD_REC(ylalbobacimq->urotzxmebdry).hgdodzdmndla)->cssjkjaqtock;
 tmpProtocolUsing = true;
-} else if ((ckfkxrimjrfl == KEY_FAN) && (ylalbobacimq->ofajzwessiol.mcddolhbanax&0x20)) { ylalbobacimq = &((const struct sxpegamfsrfd*)ylalbobacimq->ofajzwessiol.hgdodzdmndla)->cssjkjaqtock;
+} else if ((ckfkxrimjrfl == KEY_FAN) && (FIELD_REC(ylalbobacimq->ofajzwessiol).mcddolhbanax&0x20)) { ylalbobacimq = &((const struct sxpegamfsrfd*)FIELD_REC(ylalbobacimq->ofajzwessiol).hgdodzdmndla)->cssjkjaqtock;
 tmpProtocolUsing = true;
-} if (tmpProtocolUsing) { eokpcvziyoim = exhfmkybxmek;
+} if (tmpProtocolUsing) {
+#if BC7215_AC_KEEP_BASE_SEGMENTS == 1
+/* replace_base() also swaps in the status of the 2nd base (REV decides the inversion) and leaves it as
+ * the base status, the kept segments are only used when it is the same */
+secBaseKept = (ojsszplvqtdq.bitLen != 0) && (ojsszplvqtdq.bitLen <= BC7215_MAX_RX_DATA_SIZE*8) && (umynxtxlzfya == ymndlmvtogxm);
+if (secBaseKept) { loadBaseSegments(&secBaseSegs, ylalbobacimq, umynxtxlzfya, &ojsszplvqtdq);
+encodeBase = &ojsszplvqtdq;
+} else
+#endif
+{ eokpcvziyoim = exhfmkybxmek;
 if (!bc7215_ac_replace_base(umynxtxlzfya, (const bc7215DataVarPkt_t*)&ojsszplvqtdq)) { return NULL;
-} } awafvcglyvyh[0] = cpudhkuyzttv;
+} } } awafvcglyvyh[0] = cpudhkuyzttv;
 awafvcglyvyh[1] = evqflvjabnyp;
 awafvcglyvyh[2] = exmdjjzytohq;
 awafvcglyvyh[3] = ckfkxrimjrfl;
@@ -1718,19 +1750,24 @@ wbcduhhgptha(jcrmavnazlar, pnklibodyrgj);
 daileifiahoj[1] = 0;
 daileifiahoj[2] = 0;
 daileifiahoj[3] = 0;
-if (awafvcglyvyh[0] >= 0) { daileifiahoj[0] = ipnoikyhfvsm(&ylalbobacimq->urotzxmebdry, awafvcglyvyh[0], xclzxnzrkvdh);
-} if ((awafvcglyvyh[1] >= 0) && (awafvcglyvyh[1]<0x0f)) { daileifiahoj[1] = ipnoikyhfvsm(&ylalbobacimq->rozfsolwsfzh, awafvcglyvyh[1], xclzxnzrkvdh);
-if (ylalbobacimq->rozfsolwsfzh.mcddolhbanax & 0x80) { awafvcglyvyh[3] = awafvcglyvyh[1];
-} } if ((awafvcglyvyh[2] >= 0) && (awafvcglyvyh[2] < 0x0f)) { daileifiahoj[2] = ipnoikyhfvsm(&ylalbobacimq->ofajzwessiol, awafvcglyvyh[2], xclzxnzrkvdh);
-if (ylalbobacimq->ofajzwessiol.mcddolhbanax & 0x80) { awafvcglyvyh[3] = awafvcglyvyh[2];
-} } if ((awafvcglyvyh[3] >= 0) && (awafvcglyvyh[3]<0x0f)) { daileifiahoj[3] = ipnoikyhfvsm(&ylalbobacimq->wlujocdbskis, awafvcglyvyh[3], xclzxnzrkvdh);
+if (awafvcglyvyh[0] >= 0) { daileifiahoj[0] = ipnoikyhfvsm(&FIELD_REC(ylalbobacimq->urotzxmebdry), awafvcglyvyh[0], xclzxnzrkvdh);
+} if ((awafvcglyvyh[1] >= 0) && (awafvcglyvyh[1]<0x0f)) { daileifiahoj[1] = ipnoikyhfvsm(&FIELD_REC(ylalbobacimq->rozfsolwsfzh), awafvcglyvyh[1], xclzxnzrkvdh);
+if (FIELD_REC(ylalbobacimq->rozfsolwsfzh).mcddolhbanax & 0x80) { awafvcglyvyh[3] = awafvcglyvyh[1];
+} } if ((awafvcglyvyh[2] >= 0) && (awafvcglyvyh[2] < 0x0f)) { daileifiahoj[2] = ipnoikyhfvsm(&FIELD_REC(ylalbobacimq->ofajzwessiol), awafvcglyvyh[2], xclzxnzrkvdh);
+if (FIELD_REC(ylalbobacimq->ofajzwessiol).mcddolhbanax & 0x80) { awafvcglyvyh[3] = awafvcglyvyh[2];
+} } if ((awafvcglyvyh[3] >= 0) && (awafvcglyvyh[3]<0x0f)) { daileifiahoj[3] = ipnoikyhfvsm(&FIELD_REC(ylalbobacimq->wlujocdbskis), awafvcglyvyh[3], xclzxnzrkvdh);
 } if (ylalbobacimq->urjrhromzium->set.rvrkwqgflpkv != NULL) { gzeafamodmeb(ylalbobacimq);
 } qzuszmtpefbs(ylalbobacimq, xclzxnzrkvdh);
 qswuykmdmlug(ylalbobacimq);
 gefhjoxgjdgt(ylalbobacimq);
 if (tmpProtocolUsing) { ylalbobacimq = mjtbuhyzuuvb;
-if (!bc7215_ac_replace_base(ymndlmvtogxm, (const bc7215DataVarPkt_t*)&eokpcvziyoim)) { return NULL;
-} if (secFmtLoaded) { seuhgjhlwgpz.body.msg.fmt = &tuptfpuregsc;
+#if BC7215_AC_KEEP_BASE_SEGMENTS == 1
+if (secBaseKept) { encodeBase = &exhfmkybxmek;
+baseRestorePending = true;
+} else
+#endif
+{ if (!bc7215_ac_replace_base(ymndlmvtogxm, (const bc7215DataVarPkt_t*)&eokpcvziyoim)) { return NULL;
+} } if (secFmtLoaded) { seuhgjhlwgpz.body.msg.fmt = &tuptfpuregsc;
 seuhgjhlwgpz.body.msg.datPkt = (bc7215DataVarPkt_t*)&nheotrjqxqej;
 return (const bc7215DataVarPkt_t*)&seuhgjhlwgpz;
 } } if (altProtocolUsing) { seuhgjhlwgpz.body.msg.fmt = &dayyhlonocwg;
@@ -1747,12 +1784,12 @@ return unhdgzknbslk(ysvohcihtbrc, cuvimoscpwjs);
 return ubuixaonhsci(juostbfhgyaw, hundllzjmjvv, yarepiinyowq);
 } bool bc7215_ac_init2_f(uint8_t juostbfhgyaw, const bc7215CombinedMsg_t hundllzjmjvv[], uint8_t yarepiinyowq) { fahrenheitInit = true;
 return ubuixaonhsci(juostbfhgyaw, hundllzjmjvv, yarepiinyowq);
-} bool bc7215_ac_find_next(void) { uint16_t zbsbxrmgwhhr;
+} static bool findNextProtocol(void) { uint16_t zbsbxrmgwhhr;
 if (pasvjyeomvil >= 0) { if (altProtocolUsing) { rfbtqpwrfskw();
 altProtocolUsing = false;
-} else if (((ylalbobacimq->wlujocdbskis.mcddolhbanax&0xf0) == 0x80) && formatLoaded) { obnxqalbogab(ylalbobacimq);
+} else if (((FIELD_REC(ylalbobacimq->wlujocdbskis).mcddolhbanax&0xf0) == 0x80) && formatLoaded) { obnxqalbogab(ylalbobacimq);
 return true;
-} else if ((ylalbobacimq->wlujocdbskis.mcddolhbanax&0xf0) == 0xe0) { altProtocolUsing = true;
+} else if ((FIELD_REC(ylalbobacimq->wlujocdbskis).mcddolhbanax&0xf0) == 0xe0) { altProtocolUsing = true;
 return true;
 } for (zbsbxrmgwhhr=pasvjyeomvil+1; zbsbxrmgwhhr<kbyuvmrshpgh; zbsbxrmgwhhr++)
 { if (gwtlojdyjddv(zbsbxrmgwhhr)) { pasvjyeomvil = zbsbxrmgwhhr;
@@ -1760,12 +1797,20 @@ return true;
 } } } pasvjyeomvil = -1;
 ylalbobacimq = NULL;
 return false;
-} const bc7215DataVarPkt_t* bc7215_ac_set(int8_t mdnpbfaooanr, int8_t evqflvjabnyp, int8_t exmdjjzytohq, int8_t ckfkxrimjrfl) { if (mdnpbfaooanr > 14) { mdnpbfaooanr = -1;
+} bool bc7215_ac_find_next(void) { bool found;
+restoreBaseSegments();
+found = findNextProtocol();
+dropBaseSegments();
+cachePowerFrames();
+return found;
+} const bc7215DataVarPkt_t* bc7215_ac_set(int8_t mdnpbfaooanr, int8_t evqflvjabnyp, int8_t exmdjjzytohq, int8_t ckfkxrimjrfl) { restoreBaseSegments();
+if (mdnpbfaooanr > 14) { mdnpbfaooanr = -1;
 } if (evqflvjabnyp > MODE_FAN) { evqflvjabnyp = -1;
 } if (exmdjjzytohq > FAN_HIGH) { exmdjjzytohq = -1;
 } if (ckfkxrimjrfl > KEY_FAN) { ckfkxrimjrfl = -1;
 } return awqedzxswnbr(mdnpbfaooanr, evqflvjabnyp, exmdjjzytohq, ckfkxrimjrfl);
 } const bc7215DataVarPkt_t* bc7215_ac_set_f(int8_t ncpzpizkzeve, int8_t evqflvjabnyp, int8_t exmdjjzytohq, int8_t ckfkxrimjrfl) { uint8_t	mdnpbfaooanr;
+restoreBaseSegments();
 if (evqflvjabnyp > MODE_FAN) { evqflvjabnyp = -1;
 } if (exmdjjzytohq > FAN_HIGH) { exmdjjzytohq = -1;
 } if (ckfkxrimjrfl > KEY_FAN) { ckfkxrimjrfl = -1;
@@ -1774,7 +1819,7 @@ if (evqflvjabnyp > MODE_FAN) { evqflvjabnyp = -1;
 edebutywnedh(&ylalbobacimq->nhaqybpfptll->vzkqjiprdpjc, ncpzpizkzeve, xclzxnzrkvdh);
 } else { mdnpbfaooanr = ghgjjuztaesj.iqhduifjeusb[ncpzpizkzeve];
 } } return awqedzxswnbr(mdnpbfaooanr, evqflvjabnyp, exmdjjzytohq, ckfkxrimjrfl);
-} const bc7215DataVarPkt_t* bc7215_ac_on(void) { uint16_t tldyphszjwnc;
+} static const bc7215DataVarPkt_t* buildOnFrame(void) { uint16_t tldyphszjwnc;
 const uint8_t*	qggtibxkwbxd;
 if (pasvjyeomvil >= 0) { if (ylalbobacimq->spec.ymmnbayvgjbe) { qggtibxkwbxd = (const uint8_t*)ylalbobacimq->lzjiegmlwhzf.jylyhhlxgchq;
 iukuxevqncnf.bitLen = ((*(qggtibxkwbxd+1))<<8)+*qggtibxkwbxd;
@@ -1799,9 +1844,9 @@ seuhgjhlwgpz.bitLen = 0;
 seuhgjhlwgpz.body.msg.fmt = &zakxuesnfusb;
 seuhgjhlwgpz.body.msg.datPkt = (const bc7215DataVarPkt_t*)(&iukuxevqncnf);
 return (const bc7215DataVarPkt_t*)&seuhgjhlwgpz;
-} } } else if (ylalbobacimq->spec.cmdkwamqxjvi || (!((ylalbobacimq->urotzxmebdry.mcddolhbanax | ylalbobacimq->rozfsolwsfzh.mcddolhbanax | ylalbobacimq->ofajzwessiol.mcddolhbanax)&0x80) && (ylalbobacimq->wlujocdbskis.hgdodzdmndla != NULL))) { return rjnjgrjfaldn(5);
+} } } else if (ylalbobacimq->spec.cmdkwamqxjvi || (!((FIELD_REC(ylalbobacimq->urotzxmebdry).mcddolhbanax | FIELD_REC(ylalbobacimq->rozfsolwsfzh).mcddolhbanax | FIELD_REC(ylalbobacimq->ofajzwessiol).mcddolhbanax)&0x80) && (FIELD_REC(ylalbobacimq->wlujocdbskis).hgdodzdmndla != NULL))) { return rjnjgrjfaldn(5);
 } } return NULL;
-} const bc7215DataVarPkt_t* bc7215_ac_off(void) { const uint8_t*	qggtibxkwbxd;
+} static const bc7215DataVarPkt_t* buildOffFrame(void) { const uint8_t*	qggtibxkwbxd;
 if (pasvjyeomvil >= 0) { if (!ylalbobacimq->spec.ymmnbayvgjbe) { return rjnjgrjfaldn(4);
 } else { qggtibxkwbxd = (const uint8_t*)ylalbobacimq->lzjiegmlwhzf.jylyhhlxgchq;
 iukuxevqncnf.bitLen = ((*(qggtibxkwbxd+1))<<8)+*qggtibxkwbxd;
@@ -1821,7 +1866,261 @@ seuhgjhlwgpz.body.msg.fmt = &zakxuesnfusb;
 seuhgjhlwgpz.body.msg.datPkt = (const bc7215DataVarPkt_t*)(&iukuxevqncnf);
 return (const bc7215DataVarPkt_t*)&seuhgjhlwgpz;
 } } } } return NULL;
-} uint8_t bc7215_ac_predefined_cnt(void) { return kqhvphdpbtpb;
+}
+/* ON/OFF frames depend only on the paired protocol and its base data, so they are built once
+ * after a successful init/find_next (or after the base is replaced) and kept ready for sending.
+ * Frames built from the segment buffer leave it holding the base, later set() and parse() rely on
+ * that, so when a kept frame is returned instead, the buffer is restored before it is used again.
+ */
+#if BC7215_AC_CACHE_POWER_FRAMES == 1
+static const bc7215DataVarPkt_t* keepPowerFrame(const bc7215DataVarPkt_t* frame, bc7215DataMaxPkt_t* dataPkt, bc7215FormatPkt_t* fmtPkt, bc7215CombinedMsg_t* msg)
+{
+    const bc7215CombinedMsg_t* combined;
+    if (frame == NULL)
+    {
+        return NULL;
+    }
+    if (frame->bitLen != 0)
+    {
+        memcpy(dataPkt, frame, (frame->bitLen+7)/8+2);
+        return (const bc7215DataVarPkt_t*)dataPkt;
+    }
+    combined = (const bc7215CombinedMsg_t*)frame;
+    memcpy(dataPkt, combined->body.msg.datPkt, (combined->body.msg.datPkt->bitLen+7)/8+2);
+    if (combined->body.msg.fmt == &dayyhlonocwg)        // base format stays valid until next init/find_next
+    {
+        msg->body.msg.fmt = &dayyhlonocwg;
+    }
+    else
+    {
+        *fmtPkt = *combined->body.msg.fmt;
+        msg->body.msg.fmt = fmtPkt;
+    }
+    msg->bitLen = 0;
+    msg->body.msg.datPkt = (const bc7215DataVarPkt_t*)dataPkt;
+    return (const bc7215DataVarPkt_t*)msg;
+}
+
+static void cacheOnFrame(void)
+{
+    bool fromSegments = (pasvjyeomvil >= 0) && !ylalbobacimq->spec.ymmnbayvgjbe;
+    onResult = keepPowerFrame(buildOnFrame(), &onDataPkt, &onFmtPkt, &onMsg);
+    onFromSegments = fromSegments && (onResult != NULL);
+    if (onFromSegments)
+    {
+        baseRestorePending = false;
+    }
+    onFrameReady = true;
+}
+
+static void cacheOffFrame(void)
+{
+    offFromSegments = (pasvjyeomvil >= 0) && !ylalbobacimq->spec.ymmnbayvgjbe;
+    offResult = keepPowerFrame(buildOffFrame(), &offDataPkt, &offFmtPkt, &offMsg);
+    if (offFromSegments)
+    {
+        baseRestorePending = false;
+    }
+    offFrameReady = true;
+}
+#endif
+
+static void cachePowerFrames(void)
+{
+#if BC7215_AC_CACHE_POWER_FRAMES == 1
+    cacheOnFrame();
+    cacheOffFrame();
+#endif
+}
+
+static void restoreBaseSegments(void)
+{
+    if (baseRestorePending)
+    {
+        extractBase();
+        baseRestorePending = false;
+    }
+}
+
+/* The segments of the base and of the 2nd base are kept as extracted, set() edits the working
+ * copy in nhbvuvmcmmez, so switching between the two bases only copies the kept bytes back
+ * instead of extracting the packet again.
+ */
+#if BC7215_AC_KEEP_BASE_SEGMENTS == 1
+static void loadBaseSegments(baseSegments_t* slot, const struct vsghnouiwbyk* desc, uint8_t status, const bc7215DataMaxPkt_t* pkt)
+{
+    uint8_t seg;
+    if (slot->desc != desc)
+    {
+        spitddtdgatl(desc, status, (const bc7215DataVarPkt_t*)pkt);
+        memcpy(slot->segments, nhbvuvmcmmez, sizeof(slot->segments));
+        slot->lenChanged = pktLenChanged;
+        slot->desc = desc;
+    }
+    else
+    {
+        for (seg = 0; seg < 4; seg++)        // same bytes as the extraction writes
+        {
+            memcpy(nhbvuvmcmmez[seg], slot->segments[seg], (desc->kbuoarkttzag[seg]+7)/8);
+        }
+        pktLenChanged = slot->lenChanged;
+    }
+}
+#endif
+
+static void extractBase(void)
+{
+#if BC7215_AC_KEEP_BASE_SEGMENTS == 1
+    loadBaseSegments(&baseSegs, ylalbobacimq, ymndlmvtogxm, &exhfmkybxmek);
+#else
+    spitddtdgatl(ylalbobacimq, ymndlmvtogxm, (const bc7215DataVarPkt_t*)&exhfmkybxmek);
+#endif
+}
+
+static void dropBaseSegments(void)
+{
+#if BC7215_AC_KEEP_BASE_SEGMENTS == 1
+    baseSegs.desc = NULL;
+    secBaseSegs.desc = NULL;
+#endif
+}
+
+/* A capture is complete when every protocol whose first segments have the lengths received so far
+ * ends with the last of them, the protocol defines the segment count and nothing else follows.
+ */
+bool bc7215_ac_segs_complete(uint8_t segCnt, const uint16_t segBits[])
+{
+    uint16_t i, bits;
+    uint8_t  seg, descSeg;
+    bool     found = false;
+    if ((segCnt == 0) || (segCnt > 4))
+    {
+        return false;
+    }
+    for (i = 0; i < kbyuvmrshpgh; i++)
+    {
+        const struct vsghnouiwbyk* desc = jywzwyhwwlhx[i];
+        /* BC7215 merges segments sent with a short gap, each captured segment may be several
+         * consecutive segments of the protocol (init2 splits them again) */
+        descSeg = 0;
+        for (seg = 0; seg < segCnt; seg++)
+        {
+            bits = 0;
+            while ((descSeg < 4) && (desc->kbuoarkttzag[descSeg] != 0) && (bits < segBits[seg]))
+            {
+                bits += desc->kbuoarkttzag[descSeg++];
+            }
+            if ((bits == 0) || (bits != segBits[seg]))
+            {
+                break;
+            }
+        }
+        if (seg == segCnt)
+        {
+            if ((descSeg < 4) && (desc->kbuoarkttzag[descSeg] != 0))        // may need more segments
+            {
+                return false;
+            }
+            found = true;
+        }
+    }
+    return found;
+}
+
+/* The scan of bc7215_ac_init() / bc7215_ac_init2() examines a protocol only if its signature and its
+ * total bit length are those of the capture, checking them alone tells which captures can not match.
+ * One segment is scanned with the signature of its status byte, several segments with the signature
+ * of the first format converted to their count as kkmytcenwsqk() does it, their status bytes are unused.
+ */
+uint8_t bc7215_ac_check_capture(uint8_t msgCnt, const uint8_t status[], const bc7215CombinedMsg_t msgs[])
+{
+    uint16_t i;
+    uint16_t bitLen = 0;
+    uint8_t  sig, special;
+    bool     lengthFound = false;
+    if (msgCnt == 0)
+    {
+        return CAPTURE_EMPTY;
+    }
+    if (msgCnt > 4)
+    {
+        return CAPTURE_BAD_SEGMENTS;
+    }
+    for (i = 0; i < msgCnt; i++)
+    {
+        if ((msgs[i].body.msg.fmt == NULL) || (msgs[i].body.msg.datPkt == NULL))
+        {
+            return CAPTURE_NO_FORMAT;
+        }
+        bitLen += msgs[i].body.msg.datPkt->bitLen;
+    }
+    if (msgCnt == 1)
+    {
+        if (status[0] & 0x80)
+        {
+            return CAPTURE_BAD_STATUS;
+        }
+        sig = status[0] & 0xbf;
+    }
+    else
+    {
+        sig = msgs[0].body.msg.fmt->signature.inByte;
+        special = ((sig & 0x07) ^ 0x05) * msgCnt + msgCnt - 1;
+        if (special > 8)
+        {
+            return CAPTURE_BAD_SEGMENTS;
+        }
+        sig = ((sig & 0xf8) + (special ^ 0x05)) & 0x3f;
+    }
+    for (i = 0; i < kbyuvmrshpgh; i++)
+    {
+        if (jywzwyhwwlhx[i]->bitLen == bitLen)
+        {
+            if (jywzwyhwwlhx[i]->signature == sig)
+            {
+                return CAPTURE_OK;
+            }
+            lengthFound = true;
+        }
+    }
+    return lengthFound ? CAPTURE_BAD_SIGNATURE : CAPTURE_BAD_LENGTH;
+}
+
+const bc7215DataVarPkt_t* bc7215_ac_on(void)
+{
+#if BC7215_AC_CACHE_POWER_FRAMES == 1
+    if (!onFrameReady)
+    {
+        cacheOnFrame();
+    }
+    else if (onFromSegments)
+    {
+        baseRestorePending = true;
+    }
+    return onResult;
+#else
+    return buildOnFrame();
+#endif
+}
+
+const bc7215DataVarPkt_t* bc7215_ac_off(void)
+{
+#if BC7215_AC_CACHE_POWER_FRAMES == 1
+    if (!offFrameReady)
+    {
+        cacheOffFrame();
+    }
+    else if (offFromSegments)
+    {
+        baseRestorePending = true;
+    }
+    return offResult;
+#else
+    return buildOffFrame();
+#endif
+}
+
+uint8_t bc7215_ac_predefined_cnt(void) { return kqhvphdpbtpb;
 } const bc7215DataVarPkt_t* bc7215_ac_predefined_data(uint8_t bjgtqlsnlzdk) { const uint8_t* qggtibxkwbxd;
 if (bjgtqlsnlzdk < kqhvphdpbtpb) { qggtibxkwbxd = (const uint8_t*)shnklcxaqppa[bjgtqlsnlzdk];
 iukuxevqncnf.bitLen = ((*(qggtibxkwbxd+1))<<8)+*qggtibxkwbxd;
@@ -1841,15 +2140,16 @@ return &zakxuesnfusb;
 } else { return "";
 } } uint8_t bc7215_ac_need_extra_sample(void) { uint8_t dskbycvacpfu;
 dskbycvacpfu = 0;
-if (ylalbobacimq != NULL) { if (ylalbobacimq->urotzxmebdry.mcddolhbanax&0x20) { dskbycvacpfu = 1;
-} if (ylalbobacimq->rozfsolwsfzh.mcddolhbanax&0x20) { dskbycvacpfu = 2;
-} if (ylalbobacimq->ofajzwessiol.mcddolhbanax&0x20) { dskbycvacpfu = 3;
-} if (((ylalbobacimq->wlujocdbskis.mcddolhbanax&0xf0) == 0xc0) ||(altProtocolUsing && ((ylalbobacimq->wlujocdbskis.mcddolhbanax&0xf0) == 0xe0))) { dskbycvacpfu = 4;
+if (ylalbobacimq != NULL) { if (FIELD_REC(ylalbobacimq->urotzxmebdry).mcddolhbanax&0x20) { dskbycvacpfu = 1;
+} if (FIELD_REC(ylalbobacimq->rozfsolwsfzh).mcddolhbanax&0x20) { dskbycvacpfu = 2;
+} if (FIELD_REC(ylalbobacimq->ofajzwessiol).mcddolhbanax&0x20) { dskbycvacpfu = 3;
+} if (((FIELD_REC(ylalbobacimq->wlujocdbskis).mcddolhbanax&0xf0) == 0xc0) ||(altProtocolUsing && ((FIELD_REC(ylalbobacimq->wlujocdbskis).mcddolhbanax&0xf0) == 0xe0))) { dskbycvacpfu = 4;
 } } return dskbycvacpfu;
 } bool bc7215_ac_save_2nd_base(uint8_t ysvohcihtbrc, const bc7215CombinedMsg_t* message) { uint8_t drkbvldzxnru;
 if (!(ysvohcihtbrc&0x80) && (message->body.msg.fmt->signature.bits.sig == (ysvohcihtbrc&0x3f))) { drkbvldzxnru = (message->body.msg.datPkt->bitLen+7)/8;
 if (drkbvldzxnru <= BC7215_MAX_RX_DATA_SIZE) { tuptfpuregsc = *message->body.msg.fmt;
 secFmtLoaded = true;
+dropBaseSegments();
 umynxtxlzfya = ysvohcihtbrc;
 ojsszplvqtdq.bitLen = message->body.msg.datPkt->bitLen;
 memcpy(ojsszplvqtdq.data, message->body.msg.datPkt->data, drkbvldzxnru);
@@ -1870,7 +2170,13 @@ exhfmkybxmek.bitLen = wkoutktpiwol->bitLen;
 ymndlmvtogxm = dayyhlonocwg.signature.bits.sig;
 exhfmkybxmek = nheotrjqxqej;
 } else { return false;
-} spitddtdgatl(ylalbobacimq, ymndlmvtogxm, (const bc7215DataVarPkt_t*)&exhfmkybxmek);
+} dropBaseSegments();
+extractBase();
+baseRestorePending = false;
+#if BC7215_AC_CACHE_POWER_FRAMES == 1
+onFrameReady = false;
+offFrameReady = false;
+#endif
 return true;
 } else { return false;
 } } const bc7215FormatPkt_t* bc7215_ac_get_base_fmt(void) { return &dayyhlonocwg;
@@ -1880,10 +2186,11 @@ return true;
 *evqflvjabnyp = -1;
 *exmdjjzytohq = -1;
 *bgohuvkfgymw = -1;
+restoreBaseSegments();
 if (!pktLenChanged) { dskbycvacpfu = qzuszmtpefbs(ylalbobacimq, dieecgizrxee);
-if (dskbycvacpfu) { *cpudhkuyzttv = gvmzfeyguymh(&ylalbobacimq->urotzxmebdry, 15);
-*evqflvjabnyp = gvmzfeyguymh(&ylalbobacimq->rozfsolwsfzh, 5);
-*exmdjjzytohq = gvmzfeyguymh(&ylalbobacimq->ofajzwessiol, 4);
+if (dskbycvacpfu) { *cpudhkuyzttv = gvmzfeyguymh(&FIELD_REC(ylalbobacimq->urotzxmebdry), 15);
+*evqflvjabnyp = gvmzfeyguymh(&FIELD_REC(ylalbobacimq->rozfsolwsfzh), 5);
+*exmdjjzytohq = gvmzfeyguymh(&FIELD_REC(ylalbobacimq->ofajzwessiol), 4);
 *bgohuvkfgymw = iznnydsjihel(ylalbobacimq);
 } } return dskbycvacpfu;
 } bool bc7215_ac_parse_f(int8_t* ncpzpizkzeve, int8_t* evqflvjabnyp, int8_t* exmdjjzytohq, int8_t* bgohuvkfgymw) { bool dskbycvacpfu;
@@ -62,6 +62,23 @@ extern "C" {
 #define KEY_FAN     3  /**< Fan speed selection key */
 /** @} */
 
+/* ================================================================================================
+ * CAPTURE CHECK RESULTS
+ * ================================================================================================ */
+
+/** @defgroup Capture_Check Capture Check Results
+ * @brief Results of bc7215_ac_check_capture(), why a capture can not match any protocol
+ * @{
+ */
+#define CAPTURE_OK              0  /**< Some protocol has this length and signature, initialization is worth trying */
+#define CAPTURE_EMPTY           1  /**< Nothing captured */
+#define CAPTURE_NO_FORMAT       2  /**< A data packet without its format packet */
+#define CAPTURE_BAD_STATUS      3  /**< Status byte with the error bit set, the data packet was lost or incomplete */
+#define CAPTURE_BAD_SEGMENTS    4  /**< More than 4 segments, or more than the format can describe */
+#define CAPTURE_BAD_LENGTH      5  /**< No protocol has this bit length (total of all segments) */
+#define CAPTURE_BAD_SIGNATURE   6  /**< Protocols have this bit length, but none has this signature */
+/** @} */
+
 /* ================================================================================================
  * DATA STRUCTURES
  * ================================================================================================ */
@@ -98,6 +115,8 @@ const char* bc7215_ac_get_ver(void);
  * @param dataPktCool25C Reference data packet for cooling at 25°C
  * @return true if initialization successful, false otherwise
  * @note This function must be called before using any other library functions
+ * @note With BC7215_AC_ANY_STATE_INIT a packet captured at another temperature and mode is also
+ *       accepted if no protocol matches it as the reference packet (also for bc7215_ac_init2())
  * @warning Ensure the dataPktCool25C parameter points to valid data
  */
 bool bc7215_ac_init(uint8_t status, const bc7215DataVarPkt_t* dataPktCool25C);
@@ -108,6 +127,8 @@ bool bc7215_ac_init(uint8_t status, const bc7215DataVarPkt_t* dataPktCool25C);
  * @param dataPktCool25C Reference data packet for cooling at 78°F
  * @return true if initialization successful, false otherwise
  * @note This function must be called before using any other library functions
+ * @note With BC7215_AC_ANY_STATE_INIT a packet captured at another temperature and mode is also
+ *       accepted if no protocol matches it as the reference packet (also for bc7215_ac_init2())
  * @warning Ensure the dataPktCool25C parameter points to valid data
  */
 bool bc7215_ac_init_f(uint8_t status, const bc7215DataVarPkt_t* dataPktCool78F);
@@ -251,9 +272,14 @@ const bc7215DataVarPkt_t* bc7215_ac_get_base_data(void);
  * @brief Initialize the BC7215 AC control library with multiple message configurations (Celsius)
  * @param msgCnt Number of combined messages in the msgs array
  * @param msgs Array of combined messages containing format and data pointers
- * @param segGap Gap value between segments in the IR signal timing, 0 for default 60ms
+ * @param segGap Gap between segments in ms, 0 for default 60ms, limited to 37..72ms. Kept in the base format
+ *               packet, so every command sent afterwards uses it (BC7215AC measures it while capturing)
  * @return true if initialization successful, false otherwise
  * @note This is an enhanced version of bc7215_ac_init() that supports multi-segment protocols
+ * @note BC7215AC times the gap from the report of a segment, which comes 36ms of silence plus the time to
+ *       send its packets (about 21ms, more for long segments) after its end, so the gap it measures is never
+ *       below about 57ms, and passes it only when it is shorter than the default 60ms. Pass a shorter gap
+ *       known for the remote instead
  * @warning Ensure the msgs array contains valid combined message pointers
  * @warning Ensure msgCnt accurately reflects the number of elements in msgs array
  */
@@ -263,14 +289,47 @@ bool bc7215_ac_init2(uint8_t msgCnt, const bc7215CombinedMsg_t msgs[], uint8_t s
  * @brief Initialize the BC7215 AC control library with multiple message configurations (Fahrenheit)
  * @param msgCnt Number of combined messages in the msgs array
  * @param msgs Array of combined messages containing format and data pointers
- * @param segGap Gap value between segments in the IR signal timing, 0 for default 60ms
+ * @param segGap Gap between segments in ms, 0 for default 60ms, limited to 37..72ms. Kept in the base format
+ *               packet, so every command sent afterwards uses it (BC7215AC measures it while capturing)
  * @return true if initialization successful, false otherwise
  * @note This is an enhanced version of bc7215_ac_init() that supports multi-segment protocols
+ * @note BC7215AC times the gap from the report of a segment, which comes 36ms of silence plus the time to
+ *       send its packets (about 21ms, more for long segments) after its end, so the gap it measures is never
+ *       below about 57ms, and passes it only when it is shorter than the default 60ms. Pass a shorter gap
+ *       known for the remote instead
  * @warning Ensure the msgs array contains valid combined message pointers
  * @warning Ensure msgCnt accurately reflects the number of elements in msgs array
  */
 bool bc7215_ac_init2_f(uint8_t msgCnt, const bc7215CombinedMsg_t msgs[], uint8_t segGap);
 
+/**
+ * @brief Check if the segments captured so far complete every protocol starting with them
+ * @param segCnt Number of segments captured so far (1 to 4)
+ * @param segBits Bit length of each of these segments
+ * @return true if at least one protocol has these segments first and none of them has more,
+ *         false if more segments may follow or no protocol has these segments
+ * @note A captured segment may be several consecutive segments of a protocol, merged by BC7215 when
+ *       the gap between them is short. Any protocol these segments can still be the start of, merged
+ *       or not, keeps the capture open until the remote stops
+ * @note Lets a capture end as soon as its last segment is received instead of waiting for the
+ *       remote to stop, the segments are then passed to bc7215_ac_init() / bc7215_ac_init2()
+ */
+bool bc7215_ac_segs_complete(uint8_t segCnt, const uint16_t segBits[]);
+
+/**
+ * @brief Check if a capture can match any protocol, without initializing the library
+ * @param msgCnt Number of captured segments (1 to 4)
+ * @param status Status byte of each segment, only that of a single segment is checked
+ * @param msgs Format and data packet of each segment, as for bc7215_ac_init2()
+ * @return CAPTURE_OK, or the reason no protocol can match (see CAPTURE_* definitions)
+ * @note Checks only the bit length and the signature, which every protocol must match before its
+ *       data is examined. bc7215_ac_init() / bc7215_ac_init2() fail for every capture rejected
+ *       here, a capture passing the check may still fail, e.g. on a checksum
+ * @note Takes one pass over the protocol table without touching the library state, so a bad
+ *       capture can be reported at once and taken again
+ */
+uint8_t bc7215_ac_check_capture(uint8_t msgCnt, const uint8_t status[], const bc7215CombinedMsg_t msgs[]);
+
 /**
  * @brief Parse IR data packet and extract AC control parameters (Celsius)
  * @details This function analyzes the current data packet and extracts the air conditioner
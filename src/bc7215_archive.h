@@ -0,0 +1,54 @@
+/*
+ * bc7215_archive.h
+ * BC7215 Capture Archive - File Format Definitions
+ *
+ * Binary container for IR frames captured by BC7215, shared by the device side writer
+ * (BC7215ArchiveWriter, bc7215archive.h) and host side readers (extras/tools/bc7215_archive_reader.c).
+ * All integers are little-endian and the file is written strictly in order, so it can be
+ * streamed to an SD card or a serial link.
+ *
+ * File layout:
+ * +------------------+----------+----------+-----+---------------------+-----------+
+ * | file header (16) | record 0 | record 1 | ... | index (4 per record)| trailer   |
+ * |                  |          |          |     | optional            | (16)      |
+ * +------------------+----------+----------+-----+---------------------+-----------+
+ *
+ * File header:   magic "BC7215AR" (8), version (1), flags (1, 0), header size (2), reserved (4, 0)
+ * Record:        timestamp in ms (4), status byte (1), record flags (1), bitLen (2),
+ *                format packet (33) if BC7215_ARCHIVE_REC_FORMAT is set,
+ *                data, (bitLen + 7) / 8 bytes
+ * Index:         file offset of every record (4 each)
+ * Trailer:       magic "BC7215IX" (8), record count (4), index offset (4, 0 if no index)
+ *
+ * A capture made of several segments (e.g. the samples BC7215AC collects for pairing) is
+ * stored as consecutive records, all but the last one having BC7215_ARCHIVE_REC_MORE set.
+ * A file without trailer (writer not closed) is still readable by walking the records.
+ *
+ * Author:
+ *   Bitcode
+ *
+ * Version:
+ *   V1.0 Oct 2026
+ *
+ * License:
+ *   MIT License
+ */
+
+#ifndef BC7215_ARCHIVE_H
+#define BC7215_ARCHIVE_H
+
+#include "bc7215_types.h"
+
+#define BC7215_ARCHIVE_MAGIC          "BC7215AR"    /* first 8 bytes of the file */
+#define BC7215_ARCHIVE_INDEX_MAGIC    "BC7215IX"    /* first 8 bytes of the trailer */
+#define BC7215_ARCHIVE_VERSION        1
+#define BC7215_ARCHIVE_HEADER_SIZE    16
+#define BC7215_ARCHIVE_TRAILER_SIZE   16
+#define BC7215_ARCHIVE_REC_HEADER_SIZE 8
+#define BC7215_ARCHIVE_FORMAT_SIZE    33            /* sizeof(bc7215FormatPkt_t) */
+
+/* Record flags */
+#define BC7215_ARCHIVE_REC_FORMAT     0x01          /* format packet stored before the data */
+#define BC7215_ARCHIVE_REC_MORE       0x02          /* next record is the next segment of the same capture */
+
+#endif
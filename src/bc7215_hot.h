@@ -0,0 +1,56 @@
+/*
+ * bc7215_hot.h
+ * BC7215 Library - Placement of hot code and data
+ *
+ * BC7215_HOT_CODE marks the functions run per received/sent byte or per data byte of a frame,
+ * BC7215_HOT_DATA the small lookup tables they read. Both are empty unless BC7215_HOT_PLACEMENT
+ * is 1 in bc7215_lib_config.h. Used by bc7215.cpp and bc7215_ac_lib.c only.
+ *
+ * Author:
+ *   Bitcode
+ *
+ * Version:
+ *   V1.0 Oct 2026
+ *
+ * License:
+ *   MIT License
+ */
+
+#ifndef BC7215_HOT_H
+#define BC7215_HOT_H
+
+#include "bc7215_lib_config.h"
+
+#if BC7215_HOT_PLACEMENT == 1
+#   if defined(BC7215_HOT_SECTION)        /* section given by the user, e.g. ITCM */
+#       define BC7215_HOT_SECTION_ATTR __attribute__((section(BC7215_HOT_SECTION)))
+#   elif defined(ESP_PLATFORM) || defined(ARDUINO_ARCH_ESP32)
+#       include <esp_attr.h>
+#       define BC7215_HOT_SECTION_ATTR IRAM_ATTR
+#       define BC7215_HOT_DATA DRAM_ATTR
+#   elif defined(ARDUINO_ARCH_ESP8266)
+#       include <c_types.h>
+#       define BC7215_HOT_SECTION_ATTR IRAM_ATTR        /* constant data is in RAM already */
+#   else
+#       define BC7215_HOT_SECTION_ATTR
+#   endif
+#   if defined(BC7215_HOT_DATA_SECTION)
+#       undef BC7215_HOT_DATA
+#       define BC7215_HOT_DATA __attribute__((section(BC7215_HOT_DATA_SECTION)))
+#   endif
+#   if (BC7215_HOT_OPTIMIZE > 0) && defined(__GNUC__) && !defined(__clang__)
+#       define BC7215_HOT_OPT_(level) __attribute__((optimize("O" #level)))
+#       define BC7215_HOT_OPT(level) BC7215_HOT_OPT_(level)
+#       define BC7215_HOT_CODE BC7215_HOT_SECTION_ATTR BC7215_HOT_OPT(BC7215_HOT_OPTIMIZE)
+#   else
+#       define BC7215_HOT_CODE BC7215_HOT_SECTION_ATTR
+#   endif
+#else
+#   define BC7215_HOT_CODE
+#endif
+
+#ifndef BC7215_HOT_DATA
+#   define BC7215_HOT_DATA
+#endif
+
+#endif
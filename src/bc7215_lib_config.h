@@ -45,6 +45,25 @@
  */
 #define ENABLE_FORMAT 1
 
+/* If the driver detects IR noise floods and drops the junk packets while flooded, 1 = Yes
+ * flooded when at least BC7215_FLOOD_PACKETS packets arrive within BC7215_FLOOD_WINDOW ms and at least
+ * BC7215_FLOOD_BAD_PERCENT % of them are malformed or shorter than BC7215_FLOOD_MIN_BITS bits (see
+ * setFloodFilter()). such packets are then never reported by dataReady(), the flood ends after a window
+ * below these limits. change this value to '0' to save 8 bytes of RAM per BC7215 object
+ */
+#define BC7215_FLOOD_GUARD 1
+
+#if BC7215_FLOOD_GUARD == 1
+/* flood detection window (ms) */
+#define BC7215_FLOOD_WINDOW 250
+/* packets within a window for a flood, remotes held down send 3 or less */
+#define BC7215_FLOOD_PACKETS 8
+/* share (%) of the packets in a window which must be malformed or too short for a flood */
+#define BC7215_FLOOD_BAD_PERCENT 50
+/* default minimum bit length of the packets accepted while flooded, 12 = the shortest SIRC frame */
+#define BC7215_FLOOD_MIN_BITS 12
+#endif
+
 #endif
 
 /* If IR transmitting is enabled, 1 = Yes
@@ -52,6 +71,12 @@
  */
 #define ENABLE_TRANSMITTING 1
 
+/* Bytes written to the UART at once when BUSY is not connected (8..255), taken from the stack while
+ * sending. Commands are byte stuffed into chunks of this size and left to the UART transmit buffer
+ * instead of being written and flushed one byte at a time.
+ */
+#define BC7215_TX_CHUNK_SIZE 16
+
 /* Maximum processable payload data length in byte, this value must <= 512,
  * most IR remote controllers send less than 42 bytes. The larger this value,
  * the larger memory is required to run this library.
@@ -61,4 +86,81 @@
 /* the polynominal used for CRC calculation, default is 0x07 for CRC-8-CCITT */
 #define BC7215_CRC8_POLY 0x07
 
+/* If the A/C library keeps the ON/OFF frames of the paired protocol ready after init, 1 = Yes
+ * the frames are built once when a protocol is matched, instead of on every on()/off() call.
+ * change this value to '0' to save about 200 bytes of RAM
+ */
+#define BC7215_AC_CACHE_POWER_FRAMES 1
+
+/* If the A/C library keeps the base data (and the 2nd base data) extracted after init, 1 = Yes
+ * set() for keys which need the 2nd sample then switches base without extracting them again.
+ * change this value to '0' to save about 460 bytes of RAM
+ */
+#define BC7215_AC_KEEP_BASE_SEGMENTS 1
+
+/* If BC7215AC ends a capture as soon as the last segment of the protocols starting with the segments
+ * received so far arrives, 1 = Yes. otherwise, and for segments no protocol starts with, the capture
+ * ends after 200ms without signal
+ */
+#define BC7215_AC_STREAM_PAIRING 1
+
+/* If init accepts a capture made at any temperature and mode when none matches as a capture at the
+ * calibration setting (cool 25C / 78F), 1 = Yes. the protocols are then scanned a second time, matching
+ * ones must decode to a valid temperature and mode and pass their checksums, the capture is the base state
+ */
+#define BC7215_AC_ANY_STATE_INIT 1
+
+/* Maximum number of BC7215 receivers merged by one BC7215Diversity object,
+ * every receiver takes about 95 bytes of RAM for the copy of the frame it reported.
+ */
+#define BC7215_DIVERSITY_MAX_RX 3
+
+/* Copies of the same length reported by different receivers within this time (ms) from the
+ * first copy are taken as the same frame. A receiver reporting again always starts a new frame.
+ */
+#define BC7215_DIVERSITY_WINDOW 40
+
+/* If the per-byte paths of the driver and the inner loops of the A/C library run from fast RAM, 1 = Yes
+ * IRAM on ESP32/ESP8266 (no flash cache misses during WiFi activity), or the
+ * section named by BC7215_HOT_SECTION, e.g. #define BC7215_HOT_SECTION ".itcm.text" on a Cortex-M7
+ * (small lookup tables go to BC7215_HOT_DATA_SECTION if defined).
+ * takes about 3KB of IRAM, see extras/tools/iram_report.sh for the exact figure.
+ */
+#define BC7215_HOT_PLACEMENT 0
+
+/* Optimization level of the functions placed by BC7215_HOT_PLACEMENT (GCC only), 1..3 = -O1..-O3,
+ * 0 = same as the rest of the build (usually -Os). -O2 makes the placed code about 30% larger
+ */
+#define BC7215_HOT_OPTIMIZE 0
+
+/* Maximum number of A/C commands waiting in a BC7215ACQueue, two per A/C at most (a power command
+ * and a setting) since a new command replaces the unsent one of the same kind. every command takes
+ * 11 bytes of RAM
+ */
+#define BC7215_ACQUEUE_SIZE 4
+
+/* Number of A/C commands a BC7215ACRing holds between the tasks submitting them and the one sending them,
+ * must be a power of 2. every command takes 12 (AVR) to 16 bytes of RAM
+ */
+#define BC7215_ACRING_SIZE 8
+
+/* Commands a BC7215ACBridge receives within this time (ms) of each other are merged into one IR command,
+ * Home Assistant sends a change of mode and fan speed as separate messages
+ */
+#define BC7215_BRIDGE_COALESCE 150
+
+/* Shortest time (ms) between two state messages of a BC7215ACBridge, a change within it is published
+ * at its end
+ */
+#define BC7215_BRIDGE_PUBLISH_INTERVAL 500
+
+/* Idle time (ms) in transmit mode after which BC7215Power shuts BC7215 down, unless given to its constructor
+ */
+#define BC7215_POWER_IDLE_TIME 10000
+
+/* Settle time (ms) of each step of waking BC7215 up from shutdown: MOD high (receive mode), then
+ * MOD low (transmit mode). The first command after a shutdown waits twice this time at most
+ */
+#define BC7215_WAKE_TIME 50
+
 #endif /* BC7215_LIB_CONFIG_H */
@@ -1,5 +1,41 @@
 #include "bc7215ac.h"
 
+// A BC7215A ends a segment after 36ms without signal and then sends its data and format packets, 11 bits a
+// byte at 19200bps. The time from that report to the first byte of the next segment plus this delay gives the
+// gap between the segments, rather too long than too short since the first byte comes some ms after the start
+// of a segment and part of the data packet may be sent while the segment is still received.
+#define SEG_END_SILENCE 36
+
+// Gap the library uses when none is given. The measurement errs long, so it is only used when it is shorter,
+// a longer one would only make every command longer on air
+#define SEG_GAP_DEFAULT 60
+
+// The end of a command is only known when isBusy() is called, an end seen more than this many ms after
+// isBusy() last found BC7215 busy is too late to give the airtime
+#define TX_END_POLL_MAX 20
+
+// Bytes written to BC7215 for a command, 0x7a and 0x7b are sent as two bytes
+static uint16_t stuffedSize(const uint8_t* data, uint16_t len)
+{
+	uint16_t size = len;
+	for (uint16_t i=0; i<len; i++)
+	{
+		if ((data[i] == 0x7a) || (data[i] == 0x7b))
+		{
+			size++;
+		}
+	}
+	return size;
+}
+
+// Time (ms) from the end of a segment to its report: the silence, then the data packet (data, 3 bytes and
+// 0x7a) and the format packet (33 bytes and 0x7a 0x7a)
+static uint16_t segReportDelay(const bc7215DataMaxPkt_t& data, const bc7215FormatPkt_t& format)
+{
+	uint16_t bytes = stuffedSize(data.data, (data.bitLen + 7) / 8) + 4 + stuffedSize(&format.signature.inByte, 33) + 2;
+	return SEG_END_SILENCE + (bytes * 11UL * 1000 + 19199) / 19200;
+}
+
 BC7215AC::BC7215AC(BC7215& bc7215Chip)
     : bc7215(bc7215Chip)
 {
@@ -10,6 +46,10 @@ BC7215AC::BC7215AC(BC7215& bc7215Chip)
     bc7215.setTx();
     initOK = false;
 	useFahrenheit = false;
+	sampleGap = 0;
+	gapTiming = false;
+	powerManager = NULL;
+	resetCost();
 }
 
 void BC7215AC::setFahrenheit()
@@ -33,6 +73,8 @@ void BC7215AC::setCelsius()
 void BC7215AC::startCapture()
 {
 	sampleCount = 0;
+	sampleGap = 0;
+	gapTiming = false;
     bc7215.setRx();
     delay(50);
     bc7215.setRxMode(1);
@@ -57,9 +99,16 @@ bool BC7215AC::signalCaptured()
 			rcvdMessage[sampleCount].body.msg.fmt = &sampleFormat[sampleCount];
 			rcvdMessage[sampleCount].body.msg.datPkt = reinterpret_cast<const bc7215DataVarPkt_t*>(&sampleData[sampleCount]);
 			sampleCount++;
+			if (segmentsComplete())
+			{
+				isCapturing = false;
+				return true;
+			}
 		}
 		isCapturing = true;
 		timerStartTime = millis();
+		gapStartTime = timerStartTime;
+		gapTiming = true;
     }
     else if (bc7215.dataReady())        // if not receiving Format but only data packet, may need to resend resend Rx
                                         // mode command
@@ -73,6 +122,7 @@ bool BC7215AC::signalCaptured()
 	{
 		if(bc7215.isBusy())
 		{
+			measureGap();
 			timerStartTime = millis();		// if BC7215 is still busy, reset timer
 		}
 		if (millis() - timerStartTime > 200)	// if idle time is more than 200ms
@@ -84,23 +134,127 @@ bool BC7215AC::signalCaptured()
     return false;
 }
 
+void BC7215AC::startCapture(BC7215Diversity& receivers)
+{
+	sampleCount = 0;
+	sampleGap = 0;
+	gapTiming = false;
+	receivers.startCapture();
+}
+
+void BC7215AC::stopCapture(BC7215Diversity& receivers) { receivers.stopCapture(); }
+
+bool BC7215AC::signalCaptured(BC7215Diversity& receivers)
+{
+    if (receivers.frameReady())
+    {
+		if (sampleCount < 4)
+		{
+			sampleStatus[sampleCount] = receivers.getFrame(sampleData[sampleCount], sampleFormat[sampleCount]);
+			rcvdMessage[sampleCount].body.msg.fmt = &sampleFormat[sampleCount];
+			rcvdMessage[sampleCount].body.msg.datPkt = reinterpret_cast<const bc7215DataVarPkt_t*>(&sampleData[sampleCount]);
+			sampleCount++;
+			if (segmentsComplete())
+			{
+				isCapturing = false;
+				return true;
+			}
+		}
+		else
+		{
+			receivers.clrFrame();
+		}
+		isCapturing = true;
+		timerStartTime = millis();
+		gapStartTime = timerStartTime - BC7215_DIVERSITY_WINDOW;		// reported when the merging window closed
+		gapTiming = true;
+    }
+	if (isCapturing)
+	{
+		if (receivers.isBusy())
+		{
+			measureGap();
+			timerStartTime = millis();		// if any receiver is still busy, reset timer
+		}
+		if (millis() - timerStartTime > 200)	// if idle time is more than 200ms
+		{
+			isCapturing = false;
+			return true;
+		}
+	}
+    return false;
+}
+
 void BC7215AC::sendAcCmd(const bc7215DataVarPkt_t* dataPkt)
 {
+	const bc7215FormatPkt_t* format;
+	uint8_t					 bitLen[2];
+	uint16_t				 bytes;
+	uint16_t				 uartMs;
+	if (powerManager != NULL)
+	{
+		powerManager->waitReady();
+	}
     if (dataPkt->bitLen == 0)
     {
-        bc7215.loadFormat(*(reinterpret_cast<const bc7215CombinedMsg_t*>(dataPkt)->body.msg.fmt));
-        bc7215.irTx(reinterpret_cast<const bc7215CombinedMsg_t*>(dataPkt)->body.msg.datPkt);
+		format = reinterpret_cast<const bc7215CombinedMsg_t*>(dataPkt)->body.msg.fmt;
+		dataPkt = reinterpret_cast<const bc7215CombinedMsg_t*>(dataPkt)->body.msg.datPkt;
     }
     else
     {
-        bc7215.loadFormat(*bc7215_ac_get_base_fmt());
-        bc7215.irTx(dataPkt);
+		format = bc7215_ac_get_base_fmt();
     }
+	bc7215.irTx(*format, dataPkt);
+	bitLen[0] = dataPkt->bitLen & 0xff;
+	bitLen[1] = dataPkt->bitLen >> 8;
+	bytes = 2 + stuffedSize(&format->signature.inByte, 33) + 2 + stuffedSize(bitLen, 2)		// f6 01 format, f5 02 bitLen data
+		+ stuffedSize(dataPkt->data, (dataPkt->bitLen + 7) / 8);
+	uartMs = (bytes * 11UL * 1000 + 19199) / 19200;		// 11 bits a byte at 19200bps
+	noteCost(cost.frameBytes, bytes);
+	noteCost(cost.uartMs, uartMs);
+	txBusyTime = millis();
+	txEndTime = txBusyTime + uartMs;
+	txTiming = true;
+}
+
+void BC7215AC::measureGap()
+{
+	unsigned long gap;
+	if (gapTiming)		// first byte of the segment following the last captured one
+	{
+		gap = millis() - gapStartTime + segReportDelay(sampleData[sampleCount-1], sampleFormat[sampleCount-1]);
+		if ((gap < SEG_GAP_DEFAULT) && ((sampleGap == 0) || (gap < sampleGap)))		// the shortest gap the remote used
+		{
+			sampleGap = gap;
+		}
+		gapTiming = false;
+	}
 }
 
+bool BC7215AC::segmentsComplete()
+{
+#if BC7215_AC_STREAM_PAIRING == 1
+	uint16_t segBits[4];
+	for (int i=0; i<sampleCount; i++)
+	{
+		segBits[i] = sampleData[i].bitLen;
+	}
+	return bc7215_ac_segs_complete(sampleCount, segBits);
+#else
+	return false;
+#endif
+}
+
+uint8_t BC7215AC::checkCapture() { return bc7215_ac_check_capture(sampleCount, sampleStatus, rcvdMessage); }
+
 bool BC7215AC::init()
 {
 	initOK = false;
+	resetCost();
+	if (checkCapture() != CAPTURE_OK)		// no protocol can match, skip the scan
+	{
+		return false;
+	}
     if (sampleCount == 1)
     {
 		if (useFahrenheit)
@@ -127,11 +281,11 @@ bool BC7215AC::init()
 		}
 		if (useFahrenheit)
 		{
-			initOK = bc7215_ac_init2_f(sampleCount, rcvdMessage, 0);
+			initOK = bc7215_ac_init2_f(sampleCount, rcvdMessage, sampleGap);
 		}
 		else
 		{
-			initOK = bc7215_ac_init2(sampleCount, rcvdMessage, 0);
+			initOK = bc7215_ac_init2(sampleCount, rcvdMessage, sampleGap);
 		}
 	}
     return initOK;
@@ -141,6 +295,7 @@ bool BC7215AC::init(const bc7215DataMaxPkt_t& data, const bc7215FormatPkt_t& for
 {
     rcvdMessage[0].body.msg.datPkt = reinterpret_cast<const bc7215DataVarPkt_t*>(&data);
     rcvdMessage[0].body.msg.fmt = &format;
+	resetCost();
 	if (useFahrenheit)
 	{
 		initOK = bc7215_ac_init_f(format.signature.inByte, reinterpret_cast<const bc7215DataVarPkt_t*>(&rcvdMessage[0]));
@@ -157,6 +312,7 @@ bool BC7215AC::matchNext()
 	if (initOK)
 	{
 		initOK = bc7215_ac_find_next(); 
+		resetCost();
 	}
 	return initOK;
 }
@@ -196,8 +352,11 @@ bool BC7215AC::initPredef(uint8_t index)
 const bc7215DataVarPkt_t* BC7215AC::setTo(int temp, int mode, int fan, int key)
 {
     const bc7215DataVarPkt_t* dataPkt;
+    unsigned long             start;
     if (initOK)
     {
+		wake();		// BC7215 settles while the command is encoded
+		start = micros();
 		if (useFahrenheit)
 		{
         	dataPkt = bc7215_ac_set_f(temp - 60, mode, fan, key);
@@ -206,6 +365,7 @@ const bc7215DataVarPkt_t* BC7215AC::setTo(int temp, int mode, int fan, int key)
 		{
         	dataPkt = bc7215_ac_set(temp - 16, mode, fan, key);
 		}
+		noteCost(cost.encodeUs, micros() - start);
         sendAcCmd(dataPkt);
         return dataPkt;
     }
@@ -215,13 +375,17 @@ const bc7215DataVarPkt_t* BC7215AC::setTo(int temp, int mode, int fan, int key)
 const bc7215DataVarPkt_t* BC7215AC::on()
 {
     const bc7215DataVarPkt_t* dataPkt;
+    unsigned long             start;
     if (initOK)
     {
+		wake();		// BC7215 settles while the command is encoded
+		start = micros();
         dataPkt = bc7215_ac_on();
         if (dataPkt == NULL)
         {
             dataPkt = bc7215_ac_get_base_data();
         }
+		noteCost(cost.encodeUs, micros() - start);
         sendAcCmd(dataPkt);
         return dataPkt;
     }
@@ -231,9 +395,13 @@ const bc7215DataVarPkt_t* BC7215AC::on()
 const bc7215DataVarPkt_t* BC7215AC::off()
 {
     const bc7215DataVarPkt_t* dataPkt;
+    unsigned long             start;
     if (initOK)
     {
+		wake();		// BC7215 settles while the command is encoded
+		start = micros();
         dataPkt = bc7215_ac_off();
+		noteCost(cost.encodeUs, micros() - start);
         sendAcCmd(dataPkt);
         return dataPkt;
     }
@@ -244,8 +412,10 @@ bool BC7215AC::parse(int& temp, int& mode, int& fan, int& power)
 {
 	int8_t t, m, f, p;
 	bool result = false;
+	unsigned long start;
 	if (initOK)
 	{
+		start = micros();		// loading the captured frame is part of the parsing
     	if (sampleCount == 1)
     	{
     	    bc7215_ac_replace_base(sampleStatus[0], reinterpret_cast<const bc7215DataVarPkt_t*>(&sampleData[0]));
@@ -275,6 +445,7 @@ bool BC7215AC::parse(int& temp, int& mode, int& fan, int& power)
 			result = bc7215_ac_parse(&t, &m, &f, &p);
 			temp = t+16;
 		}
+		noteCost(cost.parseUs, micros() - start);
 		mode = m;
 		fan = f;
 		power = p;
@@ -282,7 +453,39 @@ bool BC7215AC::parse(int& temp, int& mode, int& fan, int& power)
 	return result;
 }
 
-bool BC7215AC::isBusy() { return bc7215.isBusy(); }
+bool BC7215AC::isBusy()
+{
+	unsigned long now;
+	if ((powerManager != NULL) && powerManager->isWaking())
+	{
+		return true;
+	}
+	now = millis();
+	if (bc7215.isBusy())
+	{
+		txBusyTime = now;
+		return true;
+	}
+	if (txTiming)		// end of the last command
+	{
+		if (now - txBusyTime <= TX_END_POLL_MAX)
+		{
+			noteCost(cost.airtimeMs, ((long)(now - txEndTime) > 0) ? now - txEndTime : 0);
+		}
+		txTiming = false;
+	}
+	return false;
+}
+
+void BC7215AC::usePower(BC7215Power& manager) { powerManager = &manager; }
+
+void BC7215AC::wake()
+{
+	if (powerManager != NULL)
+	{
+		powerManager->wake();
+	}
+}
 
 bool BC7215AC::isCelsius() { return !useFahrenheit; }
 
@@ -291,3 +494,23 @@ const bc7215DataVarPkt_t* BC7215AC::getDataPkt() { return bc7215_ac_get_base_dat
 const bc7215FormatPkt_t* BC7215AC::getFormatPkt() { return bc7215_ac_get_base_fmt(); }
 
 const char* BC7215AC::getLibVer() { return bc7215_ac_get_ver(); }
+
+BC7215ACCost BC7215AC::costProfile() { return cost; }
+
+void BC7215AC::resetCost()
+{
+	memset(&cost, 0, sizeof(cost));
+	txTiming = false;
+}
+
+void BC7215AC::noteCost(uint16_t& longest, unsigned long value)
+{
+	if (value > 0xffff)
+	{
+		value = 0xffff;
+	}
+	if (value > longest)
+	{
+		longest = value;
+	}
+}
@@ -4,6 +4,19 @@
 #include <Arduino.h>
 #include <bc7215.h>
 #include <bc7215_ac_lib.h>
+#include <bc7215diversity.h>
+#include <bc7215power.h>
+
+// Cost of the commands of the paired protocol, the longest seen since it was paired. A value stays 0
+// until the operation it measures has been done once
+struct BC7215ACCost
+{
+	uint16_t	encodeUs;		// encoding a command, setTo(), on() or off() (us)
+	uint16_t	parseUs;		// parse() (us)
+	uint16_t	frameBytes;		// format and data commands written to BC7215, byte stuffing included
+	uint16_t	uartMs;			// writing frameBytes at 19200bps 8N2 (ms)
+	uint16_t	airtimeMs;		// from the end of the writing to BC7215 finishing the command (ms)
+};
 
 class BC7215AC
 {
@@ -14,6 +27,7 @@ public:
 	uint8_t				sampleStatus[4];		// Storage for captured data status
 	bc7215DataMaxPkt_t  sampleData[4];          // Storage for captured IR data
 	bc7215FormatPkt_t   sampleFormat[4];        // Storage for captured IR format
+	uint8_t				sampleGap;				// shortest gap between captured segments (ms, about 57..59), 0 if not measured shorter than 60
 
 	// Set system temperature unit
 	void					  setFahrenheit();
@@ -25,10 +39,20 @@ public:
 	// Stop capturing, exit RX mode
     void                      stopCapture();
 
-	// Check if IR signal has been successfully captured
+	// Check if IR signal has been successfully captured, as soon as its last segment is received if the
+	// protocol defines the segment count, otherwise after 200ms without signal
     bool                      signalCaptured();
 
-	// Initialize(pair) A/C library with last captured data & format
+	// Capture through several receivers, each frame is taken once from the best copy heard
+    void                      startCapture(BC7215Diversity& receivers);
+    void                      stopCapture(BC7215Diversity& receivers);
+    bool                      signalCaptured(BC7215Diversity& receivers);
+
+	// Check if the last captured samples can match any protocol, CAPTURE_OK or why they can not (CAPTURE_*).
+	// init() fails at once for those rejected, they are worth capturing again
+    uint8_t                   checkCapture();
+
+	// Initialize(pair) A/C library with last captured data & format, segments are sent with the measured sampleGap
     bool                      init();
 
 	// Initialize(pair) A/C library with 'data' and 'format'
@@ -56,9 +80,16 @@ public:
 	// Parsing the last captured IR signal
 	bool					  parse(int& temp, int& mode, int& fan, int& power);
     
-	// Check if the BC7215A is busing receiving or transmitting
+	// Check if the BC7215A is busing receiving or transmitting, or waking up from shutdown (no side effect on
+	// the power manager, whose poll() moves the waking on)
 	bool                      isBusy();
 
+	// Let 'manager' shut BC7215 down when idle, commands wake it up first
+	void					  usePower(BC7215Power& manager);
+
+	// Start waking BC7215 up for a coming command, does nothing without a power manager
+	void					  wake();
+
 	// Check if library is current in Celsius mode
 	bool					  isCelsius();
 
@@ -71,13 +102,28 @@ public:
 	// Get the version of the A/C Control Library
 	const char*				  getLibVer();
 
+	// Get the cost of the paired protocol, measured on the commands sent and parsed since init(). Airtime is
+	// only measured if isBusy() is called at least every 20ms while BC7215 sends a command
+	BC7215ACCost			  costProfile();
+
 private:
     BC7215&             bc7215;
     bc7215CombinedMsg_t rcvdMessage[4];
 	unsigned long		timerStartTime;
 	bool				isCapturing;
 	bool				useFahrenheit;			// is system temperature Fahrenheit
+	unsigned long		gapStartTime;			// when the last segment was reported
+	bool				gapTiming;				// waiting for the next segment to measure the gap
+	BC7215Power*		powerManager;			// NULL if BC7215 is always powered
+	BC7215ACCost		cost;					// longest costs since the protocol was paired
+	unsigned long		txEndTime;				// when the last command is written to BC7215
+	unsigned long		txBusyTime;				// when isBusy() last found BC7215 sending the last command
+	bool				txTiming;				// waiting for BC7215 to finish the last command
     void                sendAcCmd(const bc7215DataVarPkt_t* dataPkt);
+	void				resetCost();
+	void				noteCost(uint16_t& longest, unsigned long value);
+	void				measureGap();
+	bool				segmentsComplete();		// no protocol starting with the captured segments has more
 };
 
 #endif
@@ -0,0 +1,249 @@
+#include "bc7215acbridge.h"
+
+static const char* const HA_MODES[] = {"auto", "cool", "heat", "dry", "fan_only"};
+static const char* const HA_FANS[] = {"auto", "low", "medium", "high"};
+
+BC7215ACBridge::BC7215ACBridge(BC7215AC& target, BC7215ACBridgeLink& transport, const char* baseTopic)
+	: ac(target), link(transport), base(baseTopic)
+{
+	state.temp = 25;
+	state.mode = MODE_COOL;
+	state.fan = FAN_AUTO;
+	state.power = true;
+	sent = state;
+	published = state;
+	publishedValid = false;
+	commandTime = 0;
+	publishTime = 0;
+	coalescedCount = 0;
+}
+
+void BC7215ACBridge::online()
+{
+	char topic[96];
+	if (!tempValid(state.temp))		// set to Fahrenheit after the bridge was constructed
+	{
+		state.temp = ac.isCelsius() ? 25 : 78;
+		sent.temp = state.temp;
+	}
+	makeTopic(topic, sizeof(topic), "/available");
+	link.publish(topic, "online", true);
+	makeTopic(topic, sizeof(topic), "/temperature/set");
+	link.subscribe(topic);
+	makeTopic(topic, sizeof(topic), "/mode/set");
+	link.subscribe(topic);
+	makeTopic(topic, sizeof(topic), "/fan/set");
+	link.subscribe(topic);
+	publishedValid = false;		// the broker may have lost the retained state
+	poll();
+}
+
+bool BC7215ACBridge::publishDiscovery(const char* uniqueId, const char* name)
+{
+	char topic[96];
+	char config[1024];
+	bool celsius = ac.isCelsius();
+	snprintf(topic, sizeof(topic), "homeassistant/climate/%s/config", uniqueId);
+	int  len = snprintf(config, sizeof(config),
+		"{\"name\":\"%s\",\"unique_id\":\"%s\",\"~\":\"%s\","
+		"\"mode_command_topic\":\"~/mode/set\",\"mode_state_topic\":\"~/state\","
+		"\"mode_state_template\":\"{{value_json.mode}}\","
+		"\"modes\":[\"off\",\"auto\",\"cool\",\"heat\",\"dry\",\"fan_only\"],"
+		"\"temperature_command_topic\":\"~/temperature/set\",\"temperature_state_topic\":\"~/state\","
+		"\"temperature_state_template\":\"{{value_json.temperature}}\","
+		"\"temperature_unit\":\"%s\",\"min_temp\":%d,\"max_temp\":%d,\"temp_step\":1,"
+		"\"fan_mode_command_topic\":\"~/fan/set\",\"fan_mode_state_topic\":\"~/state\","
+		"\"fan_mode_state_template\":\"{{value_json.fan_mode}}\","
+		"\"fan_modes\":[\"auto\",\"low\",\"medium\",\"high\"],"
+		"\"availability_topic\":\"~/available\","
+		"\"device\":{\"identifiers\":[\"%s\"],\"name\":\"%s\",\"manufacturer\":\"Bitcode\",\"model\":\"BC7215AC\"}}",
+		name, uniqueId, base, celsius ? "C" : "F", celsius ? 16 : 60, celsius ? 30 : 88, uniqueId, name);
+	if (len >= (int)sizeof(config))		// name or topics too long
+	{
+		return false;
+	}
+	return link.publish(topic, config, true);
+}
+
+bool BC7215ACBridge::received(const char* topic, const uint8_t* payload, unsigned int length)
+{
+	char    val[16];
+	uint8_t i;
+	State   before = state;
+	bool    waiting = commandPending();
+	if (length >= sizeof(val))
+	{
+		length = sizeof(val) - 1;
+	}
+	memcpy(val, payload, length);
+	val[length] = '\0';
+
+	if (isCommand(topic, "/temperature/set"))
+	{
+		int value = atoi(val);		// "24.0" from Home Assistant is 24
+		if (tempValid(value))
+		{
+			state.temp = value;
+		}
+	}
+	else if (isCommand(topic, "/mode/set"))
+	{
+		if (strcmp(val, "off") == 0)
+		{
+			state.power = false;
+		}
+		for (i = 0; i < 5; i++)
+		{
+			if (strcmp(val, HA_MODES[i]) == 0)
+			{
+				state.mode = i;
+				state.power = true;
+			}
+		}
+	}
+	else if (isCommand(topic, "/fan/set"))
+	{
+		for (i = 0; i < 4; i++)
+		{
+			if (strcmp(val, HA_FANS[i]) == 0)
+			{
+				state.fan = i;
+			}
+		}
+	}
+	else
+	{
+		return false;
+	}
+	if (!sameState(before, state))
+	{
+		if (waiting)		// merged with the command still waiting
+		{
+			coalescedCount++;
+		}
+		commandTime = millis();
+	}
+	return true;
+}
+
+void BC7215ACBridge::report(int temp, int mode, int fan, int power)
+{
+	if (tempValid(temp))
+	{
+		state.temp = temp;
+		sent.temp = temp;
+	}
+	if ((mode >= 0) && (mode <= 4))
+	{
+		state.mode = mode;
+		sent.mode = mode;
+	}
+	if ((fan >= 0) && (fan <= 3))
+	{
+		state.fan = fan;
+		sent.fan = fan;
+	}
+	if ((power == 0) || (power == 1))
+	{
+		state.power = power;
+		sent.power = power;
+	}
+}
+
+bool BC7215ACBridge::commandPending() { return (state.power != sent.power) || (state.power && !sameState(state, sent)); }
+
+bool BC7215ACBridge::commandDue()
+{
+	return commandPending() && ac.initOK && (millis() - commandTime >= BC7215_BRIDGE_COALESCE) && !ac.isBusy();
+}
+
+bool BC7215ACBridge::send()
+{
+	int key;
+	if (!commandDue())
+	{
+		return false;
+	}
+	if (state.power != sent.power)
+	{
+		sent.power = state.power;
+		if (state.power)
+		{
+			ac.on();		// settings changed with the power follow in the next call
+		}
+		else
+		{
+			ac.off();		// settings changed while off are sent when the power is turned on
+		}
+		return true;
+	}
+	if (state.mode != sent.mode)		// key of the most significant setting changed
+	{
+		key = KEY_MODE;
+	}
+	else if (state.fan != sent.fan)
+	{
+		key = KEY_FAN;
+	}
+	else
+	{
+		key = (state.temp > sent.temp) ? KEY_PLUS : KEY_MINUS;
+	}
+	ac.setTo(state.temp, state.mode, state.fan, key);
+	sent = state;
+	return true;
+}
+
+void BC7215ACBridge::poll()
+{
+	char topic[96];
+	char json[72];
+	if (publishedValid && (sameState(state, published) || (millis() - publishTime < BC7215_BRIDGE_PUBLISH_INTERVAL)))
+	{
+		return;
+	}
+	makeTopic(topic, sizeof(topic), "/state");
+	snprintf(json, sizeof(json), "{\"mode\":\"%s\",\"temperature\":%d,\"fan_mode\":\"%s\"}",
+		state.power ? HA_MODES[state.mode] : "off", state.temp, HA_FANS[state.fan]);
+	if (link.publish(topic, json, true))
+	{
+		published = state;
+		publishedValid = true;
+		publishTime = millis();
+	}
+}
+
+int BC7215ACBridge::temp() { return state.temp; }
+
+int BC7215ACBridge::mode() { return state.mode; }
+
+int BC7215ACBridge::fan() { return state.fan; }
+
+bool BC7215ACBridge::power() { return state.power; }
+
+uint16_t BC7215ACBridge::coalesced() { return coalescedCount; }
+
+bool BC7215ACBridge::isCommand(const char* topic, const char* suffix)
+{
+	size_t len = strlen(base);
+	return (strncmp(topic, base, len) == 0) && (strcmp(topic + len, suffix) == 0);
+}
+
+bool BC7215ACBridge::tempValid(int value)
+{
+	if (ac.isCelsius())
+	{
+		return (value >= 16) && (value <= 30);
+	}
+	return (value >= 60) && (value <= 88);
+}
+
+bool BC7215ACBridge::sameState(const State& a, const State& b)
+{
+	return (a.temp == b.temp) && (a.mode == b.mode) && (a.fan == b.fan) && (a.power == b.power);
+}
+
+void BC7215ACBridge::makeTopic(char* topic, uint8_t size, const char* suffix)
+{
+	snprintf(topic, size, "%s%s", base, suffix);
+}
@@ -0,0 +1,91 @@
+#ifndef BC7215ACBRIDGE_H
+#define BC7215ACBRIDGE_H
+
+#include <Arduino.h>
+#include <bc7215ac.h>
+
+// Publish/subscribe transport of a BC7215ACBridge, implemented by the sketch on top of its MQTT
+// client (or of a local stand-in of the broker when testing the bridge)
+class BC7215ACBridgeLink
+{
+public:
+	// Publish 'payload' on 'topic', true if it was accepted
+    virtual bool              publish(const char* topic, const char* payload, bool retained) = 0;
+
+	// Subscribe to 'topic', true if it was accepted
+    virtual bool              subscribe(const char* topic) = 0;
+};
+
+// Home Assistant (MQTT climate) bridge of a BC7215AC. The whole state is published as one retained
+// JSON object on <base>/state, only when it has changed and at most once every
+// BC7215_BRIDGE_PUBLISH_INTERVAL ms. Commands arrive on <base>/temperature/set, <base>/mode/set and
+// <base>/fan/set, those arriving within BC7215_BRIDGE_COALESCE ms of each other are merged into one
+// IR command (plus the ON/OFF frame when the power changes).
+class BC7215ACBridge
+{
+public:
+    BC7215ACBridge(BC7215AC& target, BC7215ACBridgeLink& transport, const char* baseTopic);
+
+	// Publish "online" on <base>/available, subscribe to the command topics and publish the state, call it
+	// every time the transport (re)connects. The sketch sets "offline" as its last will on <base>/available
+    void                      online();
+
+	// Publish the Home Assistant discovery config of the A/C on homeassistant/climate/<uniqueId>/config
+    bool                      publishDiscovery(const char* uniqueId, const char* name);
+
+	// Pass an incoming message to the bridge, from the message callback. True if it is a command of the bridge
+    bool                      received(const char* topic, const uint8_t* payload, unsigned int length);
+
+	// Report a state the A/C was set to without the bridge (buttons, remote controller parsed), it is published
+	// but not sent. Values out of range (-1 as from BC7215AC::parse()) are left unchanged, power is 0 = off, 1 = on
+    void                      report(int temp, int mode, int fan, int power);
+
+	// Check if the merged command is due, the commands have settled and the transmitter is idle.
+	// A sketch which keeps BC7215 capturing stops the capture before calling send()
+    bool                      commandDue();
+
+	// Check if a command is waiting, being merged or for the transmitter, false once the A/C is in the commanded state
+    bool                      commandPending();
+
+	// Send the merged command if it is due, true if an IR frame was sent. Turning the power on and
+	// changing a setting at the same time takes two calls, ON frame first
+    bool                      send();
+
+	// Publish the state if it has changed, call it in loop()
+    void                      poll();
+
+	// Current state, as commanded or reported
+    int                       temp();
+    int                       mode();
+    int                       fan();
+    bool                      power();
+
+	// Number of commands merged into another one instead of being sent on their own
+    uint16_t                  coalesced();
+
+private:
+    struct State
+    {
+        int8_t    temp;
+        int8_t    mode;
+        int8_t    fan;
+        bool      power;
+    };
+
+    BC7215AC&           ac;
+    BC7215ACBridgeLink& link;
+    const char*         base;
+    State               state;           // current state
+    State               sent;            // state the A/C was last set to
+    State               published;       // state last published
+    bool                publishedValid;  // false until the state is published the first time after online()
+    unsigned long       commandTime;     // arrival of the last command
+    unsigned long       publishTime;     // last state published
+    uint16_t            coalescedCount;
+    bool                isCommand(const char* topic, const char* suffix);
+    bool                tempValid(int value);
+    bool                sameState(const State& a, const State& b);
+    void                makeTopic(char* topic, uint8_t size, const char* suffix);
+};
+
+#endif
@@ -0,0 +1,207 @@
+#include "bc7215acqueue.h"
+
+BC7215ACQueue::BC7215ACQueue()
+{
+	clear();
+	nextOrder = 0;
+	supersededCount = 0;
+}
+
+bool BC7215ACQueue::setTo(BC7215AC& target, int temp, int mode, int fan, int key, Priority priority)
+{
+	return push(target, CMD_SET, priority, temp, mode, fan, key);
+}
+
+bool BC7215ACQueue::on(BC7215AC& target, Priority priority) { return push(target, CMD_ON, priority, 0, -1, -1, 0); }
+
+bool BC7215ACQueue::off(BC7215AC& target, Priority priority) { return push(target, CMD_OFF, priority, 0, -1, -1, 0); }
+
+bool BC7215ACQueue::poll()
+{
+	bool sent = false;
+	while (true)
+	{
+		Entry* next = NULL;
+		for (uint8_t i = 0; i < BC7215_ACQUEUE_SIZE; i++)
+		{
+			Entry& e = entry[i];
+			if ((e.target != NULL) && !e.held && ((next == NULL) || (e.priority > next->priority)
+										  || ((e.priority == next->priority) && ((int16_t)(e.order - next->order) < 0))))
+			{
+				if (!e.target->isBusy()		// a transmitter sends one frame at a time
+					&& ((e.command != CMD_SET) || (find(*e.target, true) == NULL)))		// power command first
+				{
+					next = &e;
+				}
+			}
+		}
+		if (next == NULL)
+		{
+			return sent;
+		}
+		BC7215AC* target = next->target;
+		next->target = NULL;		// free the slot first, the target may be queued again while sending
+		switch (next->command)
+		{
+			case CMD_SET:
+				target->setTo(next->temp, next->mode, next->fan, next->key);
+				break;
+			case CMD_ON:
+				target->on();
+				break;
+			default:
+				target->off();
+				break;
+		}
+		sent = true;
+	}
+}
+
+uint8_t BC7215ACQueue::pending()
+{
+	uint8_t count = 0;
+	for (uint8_t i = 0; i < BC7215_ACQUEUE_SIZE; i++)
+	{
+		if (entry[i].target != NULL)
+		{
+			count++;
+		}
+	}
+	return count;
+}
+
+uint8_t BC7215ACQueue::pending(BC7215AC& target)
+{
+	uint8_t count = 0;
+	for (uint8_t i = 0; i < BC7215_ACQUEUE_SIZE; i++)
+	{
+		if (entry[i].target == &target)
+		{
+			count++;
+		}
+	}
+	return count;
+}
+
+void BC7215ACQueue::clear()
+{
+	for (uint8_t i = 0; i < BC7215_ACQUEUE_SIZE; i++)
+	{
+		entry[i].target = NULL;
+	}
+}
+
+void BC7215ACQueue::clear(BC7215AC& target)
+{
+	for (uint8_t i = 0; i < BC7215_ACQUEUE_SIZE; i++)
+	{
+		if (entry[i].target == &target)
+		{
+			entry[i].target = NULL;
+		}
+	}
+}
+
+uint16_t BC7215ACQueue::superseded() { return supersededCount; }
+
+BC7215ACQueue::Entry* BC7215ACQueue::find(BC7215AC& target, bool power)
+{
+	for (uint8_t i = 0; i < BC7215_ACQUEUE_SIZE; i++)
+	{
+		if ((entry[i].target == &target) && ((entry[i].command != CMD_SET) == power))
+		{
+			return &entry[i];
+		}
+	}
+	return NULL;
+}
+
+bool BC7215ACQueue::push(BC7215AC& target, uint8_t command, uint8_t priority, int temp, int mode, int fan, int key)
+{
+	bool   held = false;
+	Entry* other;
+	Entry* slot = find(target, command != CMD_SET);		// unsent command of the same kind, replaced by the new one
+	if (slot != NULL)
+	{
+		if (command == CMD_SET)		// settings left unchanged (-1) are kept from the old one
+		{
+			if (mode < 0)
+			{
+				mode = slot->mode;
+			}
+			if (fan < 0)
+			{
+				fan = slot->fan;
+			}
+			held = slot->held;
+		}
+		if (slot->priority > priority)		// keeps its place in the queue
+		{
+			priority = slot->priority;
+		}
+		supersededCount++;
+	}
+	other = find(target, command == CMD_SET);		// unsent command of the other kind
+	if (other != NULL)
+	{
+		if (command == CMD_SET)
+		{
+			held = held || (other->command == CMD_OFF);		// would turn the A/C on again, wait for on()
+		}
+		else if (other->priority > priority)		// sent ahead of the setting
+		{
+			priority = other->priority;
+		}
+	}
+	if (slot == NULL)
+	{
+		for (uint8_t i = 0; i < BC7215_ACQUEUE_SIZE; i++)
+		{
+			if (entry[i].target == NULL)
+			{
+				slot = &entry[i];
+				break;
+			}
+		}
+		if (slot == NULL)		// queue full, drop the newest of the least urgent commands if less urgent than this one
+		{
+			for (uint8_t i = 0; i < BC7215_ACQUEUE_SIZE; i++)
+			{
+				Entry& e = entry[i];
+				if ((e.priority < priority)
+					&& ((slot == NULL) || (e.priority < slot->priority)
+						|| ((e.priority == slot->priority) && ((int16_t)(e.order - slot->order) > 0))))
+				{
+					slot = &e;
+				}
+			}
+			if (slot == NULL)
+			{
+				return false;
+			}
+			supersededCount++;
+		}
+		slot->order = nextOrder++;
+	}
+	if ((other != NULL) && (other != slot))
+	{
+		if (command != CMD_SET)
+		{
+			other->held = (command == CMD_OFF);
+		}
+		else if (other->priority < priority)
+		{
+			other->priority = priority;
+		}
+	}
+	target.wake();		// BC7215 wakes up while the command waits
+	slot->target = &target;
+	slot->command = command;
+	slot->held = held;
+	slot->priority = priority;
+	slot->temp = temp;
+	slot->mode = mode;
+	slot->fan = fan;
+	slot->key = key;
+	return true;
+}
@@ -0,0 +1,62 @@
+#ifndef BC7215ACQUEUE_H
+#define BC7215ACQUEUE_H
+
+#include <Arduino.h>
+#include <bc7215ac.h>
+
+// Transmit queue for A/C commands from several producers (automations, buttons, schedules).
+// Commands are sent from poll() by priority, oldest first within the same priority, as soon as the
+// BC7215 of their target is idle. Every A/C has at most one unsent power command and one unsent
+// setting, a new one replaces the unsent one of the same kind so only the latest state is sent.
+// The power command is sent ahead of the setting. Settings queued along with off() wait for the
+// next on(), since sending them would turn the A/C on again. The frame is built when the command
+// is sent, an urgent command waits at most for the frame its transmitter is sending.
+class BC7215ACQueue
+{
+public:
+	enum Priority {PRIORITY_LOW, PRIORITY_NORMAL, PRIORITY_URGENT};
+
+    BC7215ACQueue();
+
+	// Queue a command for 'target', false if the queue is full of commands of the same or higher priority
+    bool                      setTo(BC7215AC& target, int temp, int mode = -1, int fan = -1, int key = 0, Priority priority = PRIORITY_NORMAL);
+    bool                      on(BC7215AC& target, Priority priority = PRIORITY_NORMAL);
+    bool                      off(BC7215AC& target, Priority priority = PRIORITY_URGENT);
+
+	// Send the next command(s) whose transmitter is idle, call it in loop(). True if any was sent
+    bool                      poll();
+
+	// Number of commands waiting, for all targets or for one
+    uint8_t                   pending();
+    uint8_t                   pending(BC7215AC& target);
+
+	// Drop the waiting commands, of all targets or of one
+    void                      clear();
+    void                      clear(BC7215AC& target);
+
+	// Number of commands replaced before being sent, or dropped for a more urgent one
+    uint16_t                  superseded();
+
+private:
+	enum Command {CMD_SET, CMD_ON, CMD_OFF};
+    struct Entry
+    {
+        BC7215AC* target;        // NULL if the slot is free
+        uint8_t   command;
+        bool      held;          // setting waiting for on()
+        uint8_t   priority;
+        uint16_t  order;         // queueing order, oldest is sent first within a priority
+        int8_t    temp;
+        int8_t    mode;
+        int8_t    fan;
+        int8_t    key;
+    };
+
+    Entry               entry[BC7215_ACQUEUE_SIZE];
+    uint16_t            nextOrder;
+    uint16_t            supersededCount;
+    Entry*              find(BC7215AC& target, bool power);
+    bool                push(BC7215AC& target, uint8_t command, uint8_t priority, int temp, int mode, int fan, int key);
+};
+
+#endif
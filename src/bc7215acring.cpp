@@ -0,0 +1,192 @@
+#include "bc7215acring.h"
+
+#if defined(__AVR__)
+// AVR has no atomic instructions for 32 bit values, interrupts are held off for the few cycles
+// of each access instead (producers are interrupt handlers there, there is a single core)
+static inline uint32_t ringLoad(uint32_t* value)
+{
+	uint8_t  sreg = SREG;
+	uint32_t result;
+	cli();
+	result = *(volatile uint32_t*)value;
+	SREG = sreg;
+	return result;
+}
+
+static inline void ringStore(uint32_t* value, uint32_t newValue)
+{
+	uint8_t sreg = SREG;
+	cli();
+	*(volatile uint32_t*)value = newValue;
+	SREG = sreg;
+}
+
+static inline bool ringClaim(uint32_t* tail, uint32_t& pos)
+{
+	uint8_t sreg = SREG;
+	bool    claimed;
+	cli();
+	claimed = (*(volatile uint32_t*)tail == pos);
+	if (claimed)
+	{
+		*(volatile uint32_t*)tail = pos + 1;
+	}
+	else
+	{
+		pos = *(volatile uint32_t*)tail;
+	}
+	SREG = sreg;
+	return claimed;
+}
+
+static inline void ringCount(uint16_t* value)
+{
+	uint8_t sreg = SREG;
+	cli();
+	(*(volatile uint16_t*)value)++;
+	SREG = sreg;
+}
+#else
+static inline uint32_t ringLoad(uint32_t* value) { return __atomic_load_n(value, __ATOMIC_ACQUIRE); }
+
+static inline void ringStore(uint32_t* value, uint32_t newValue) { __atomic_store_n(value, newValue, __ATOMIC_RELEASE); }
+
+// On failure 'pos' is reloaded with the current tail
+static inline bool ringClaim(uint32_t* tail, uint32_t& pos)
+{
+	return __atomic_compare_exchange_n(tail, &pos, pos + 1, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+}
+
+static inline void ringCount(uint16_t* value) { __atomic_fetch_add(value, 1, __ATOMIC_RELAXED); }
+#endif
+
+BC7215ACRing::BC7215ACRing()
+{
+	for (uint32_t i = 0; i < BC7215_ACRING_SIZE; i++)
+	{
+		slot[i].sequence = i;
+	}
+	tail = 0;
+	head = 0;
+	droppedCount = 0;
+}
+
+bool BC7215ACRing::setTo(BC7215AC& target, int temp, int mode, int fan, int key, BC7215ACQueue::Priority priority)
+{
+	return push(target, CMD_SET, priority, temp, mode, fan, key);
+}
+
+bool BC7215ACRing::on(BC7215AC& target, BC7215ACQueue::Priority priority)
+{
+	return push(target, CMD_ON, priority, 0, -1, -1, 0);
+}
+
+bool BC7215ACRing::off(BC7215AC& target, BC7215ACQueue::Priority priority)
+{
+	return push(target, CMD_OFF, priority, 0, -1, -1, 0);
+}
+
+bool BC7215ACRing::push(BC7215AC& target, uint8_t command, uint8_t priority, int temp, int mode, int fan, int key)
+{
+	Slot*    s;
+	uint32_t pos;
+	int32_t  diff;
+
+	pos = ringLoad(&tail);
+	while (true)
+	{
+		s = &slot[pos & (BC7215_ACRING_SIZE - 1)];
+		diff = (int32_t)(ringLoad(&s->sequence) - pos);
+		if (diff == 0)		// free, try to claim it
+		{
+			if (ringClaim(&tail, pos))
+			{
+				break;
+			}
+		}
+		else if (diff < 0)		// still holding the command of the previous round, ring full
+		{
+			ringCount(&droppedCount);
+			return false;
+		}
+		else		// claimed by another producer meanwhile
+		{
+			pos = ringLoad(&tail);
+		}
+	}
+	s->target = &target;
+	s->command = command;
+	s->priority = priority;
+	s->temp = temp;
+	s->mode = mode;
+	s->fan = fan;
+	s->key = key;
+	ringStore(&s->sequence, pos + 1);		// publish to the consumer
+	return true;
+}
+
+BC7215ACRing::Slot* BC7215ACRing::front()
+{
+	Slot* s = &slot[head & (BC7215_ACRING_SIZE - 1)];
+	if (ringLoad(&s->sequence) != head + 1)		// empty, or claimed but not filled yet
+	{
+		return NULL;
+	}
+	return s;
+}
+
+void BC7215ACRing::release(Slot* filled)
+{
+	ringStore(&filled->sequence, head + BC7215_ACRING_SIZE);		// free for the next round
+	head++;
+}
+
+bool BC7215ACRing::poll()
+{
+	Slot* s;
+	bool  sent = false;
+	while (((s = front()) != NULL) && !s->target->isBusy())		// in order, wait for the transmitter of the oldest one
+	{
+		switch (s->command)
+		{
+			case CMD_SET:
+				s->target->setTo(s->temp, s->mode, s->fan, s->key);
+				break;
+			case CMD_ON:
+				s->target->on();
+				break;
+			default:
+				s->target->off();
+				break;
+		}
+		release(s);
+		sent = true;
+	}
+	return sent;
+}
+
+uint8_t BC7215ACRing::drainTo(BC7215ACQueue& queue)
+{
+	Slot*   s;
+	uint8_t count = 0;
+	while ((s = front()) != NULL)
+	{
+		switch (s->command)
+		{
+			case CMD_SET:
+				queue.setTo(*s->target, s->temp, s->mode, s->fan, s->key, (BC7215ACQueue::Priority)s->priority);
+				break;
+			case CMD_ON:
+				queue.on(*s->target, (BC7215ACQueue::Priority)s->priority);
+				break;
+			default:
+				queue.off(*s->target, (BC7215ACQueue::Priority)s->priority);
+				break;
+		}
+		release(s);
+		count++;
+	}
+	return count;
+}
+
+uint16_t BC7215ACRing::dropped() { return droppedCount; }
@@ -0,0 +1,60 @@
+#ifndef BC7215ACRING_H
+#define BC7215ACRING_H
+
+#include <Arduino.h>
+#include <bc7215ac.h>
+#include <bc7215acqueue.h>
+
+#if (BC7215_ACRING_SIZE & (BC7215_ACRING_SIZE - 1)) != 0
+#	error "BC7215_ACRING_SIZE must be a power of 2"
+#endif
+
+// Lock-free ring of A/C commands, submitted by any number of tasks or interrupt handlers and
+// sent by a single consumer, so no task touches the UART or the A/C library (which are not
+// thread safe) but the consumer. Commands are sent in the order they were submitted, a producer
+// never waits: submit() returns false if the ring is full. Every slot carries a sequence number
+// which tells its owner, a producer claims a slot with one compare-and-swap on the tail.
+class BC7215ACRing
+{
+public:
+    BC7215ACRing();
+
+	// Submit a command for 'target', from any task or ISR. False if the ring is full
+    bool                      setTo(BC7215AC& target, int temp, int mode = -1, int fan = -1, int key = 0,
+                                  BC7215ACQueue::Priority priority = BC7215ACQueue::PRIORITY_NORMAL);
+    bool                      on(BC7215AC& target, BC7215ACQueue::Priority priority = BC7215ACQueue::PRIORITY_NORMAL);
+    bool                      off(BC7215AC& target, BC7215ACQueue::Priority priority = BC7215ACQueue::PRIORITY_URGENT);
+
+	// Consumer only: send the submitted commands in order while their transmitter is idle. True if any was sent
+    bool                      poll();
+
+	// Consumer only: move all submitted commands into 'queue', which orders and merges them. Returns how many
+    uint8_t                   drainTo(BC7215ACQueue& queue);
+
+	// Number of commands dropped because the ring was full
+    uint16_t                  dropped();
+
+private:
+	enum Command {CMD_SET, CMD_ON, CMD_OFF};
+    struct Slot
+    {
+        uint32_t  sequence;      // position + 1 when filled, position + BC7215_ACRING_SIZE when free again
+        BC7215AC* target;
+        uint8_t   command;
+        uint8_t   priority;
+        int8_t    temp;
+        int8_t    mode;
+        int8_t    fan;
+        int8_t    key;
+    };
+
+    Slot                slot[BC7215_ACRING_SIZE];
+    uint32_t            tail;            // next position to claim, shared by the producers
+    uint32_t            head;            // next position to send, consumer only
+    uint16_t            droppedCount;
+    bool                push(BC7215AC& target, uint8_t command, uint8_t priority, int temp, int mode, int fan, int key);
+    Slot*               front();
+    void                release(Slot* filled);
+};
+
+#endif
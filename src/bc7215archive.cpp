@@ -0,0 +1,97 @@
+#include "bc7215archive.h"
+
+BC7215ArchiveWriter::BC7215ArchiveWriter(Print& output, uint32_t* indexBuffer, uint32_t indexSize)
+    : out(output)
+{
+	index = indexBuffer;
+	this->indexSize = (indexBuffer != NULL) ? indexSize : 0;
+	records = 0;
+	offset = 0;
+	failed = false;
+}
+
+bool BC7215ArchiveWriter::begin()
+{
+	uint8_t header[BC7215_ARCHIVE_HEADER_SIZE] = { 0 };
+	records = 0;
+	offset = 0;
+	failed = false;
+	memcpy(header, BC7215_ARCHIVE_MAGIC, 8);
+	header[8] = BC7215_ARCHIVE_VERSION;
+	header[10] = BC7215_ARCHIVE_HEADER_SIZE;
+	put(header, sizeof(header));
+	return !failed;
+}
+
+bool BC7215ArchiveWriter::add(uint8_t status, const bc7215DataVarPkt_t* data, const bc7215FormatPkt_t* format, uint32_t timestamp, bool more)
+{
+	uint8_t recHeader[BC7215_ARCHIVE_REC_HEADER_SIZE - 4];
+	if (records < indexSize)
+	{
+		index[records] = offset;
+	}
+	putU32(timestamp);
+	recHeader[0] = status;
+	recHeader[1] = (format != NULL ? BC7215_ARCHIVE_REC_FORMAT : 0) | (more ? BC7215_ARCHIVE_REC_MORE : 0);
+	recHeader[2] = data->bitLen & 0xff;
+	recHeader[3] = data->bitLen >> 8;
+	put(recHeader, sizeof(recHeader));
+	if (format != NULL)
+	{
+		put(format, BC7215_ARCHIVE_FORMAT_SIZE);
+	}
+	put(data->data, (data->bitLen + 7) / 8);		// trimmed to bitLen
+	records++;
+	return !failed;
+}
+
+bool BC7215ArchiveWriter::add(uint8_t status, const bc7215DataMaxPkt_t& data, const bc7215FormatPkt_t* format, uint32_t timestamp, bool more)
+{
+	return add(status, reinterpret_cast<const bc7215DataVarPkt_t*>(&data), format, timestamp, more);
+}
+
+bool BC7215ArchiveWriter::addGroup(uint8_t count, const uint8_t status[], const bc7215DataMaxPkt_t data[], const bc7215FormatPkt_t format[], uint32_t timestamp)
+{
+	for (uint8_t i = 0; i < count; i++)
+	{
+		add(status[i], data[i], (format != NULL) ? &format[i] : NULL, timestamp, i + 1 < count);
+	}
+	return !failed;
+}
+
+bool BC7215ArchiveWriter::end()
+{
+	uint32_t indexOffset = 0;
+	if ((records != 0) && (records <= indexSize))		// index only if every offset was kept
+	{
+		indexOffset = offset;
+		for (uint32_t i = 0; i < records; i++)
+		{
+			putU32(index[i]);
+		}
+	}
+	put(BC7215_ARCHIVE_INDEX_MAGIC, 8);
+	putU32(records);
+	putU32(indexOffset);
+	out.flush();
+	return !failed;
+}
+
+uint32_t BC7215ArchiveWriter::count() { return records; }
+
+uint32_t BC7215ArchiveWriter::size() { return offset; }
+
+void BC7215ArchiveWriter::put(const void* buf, uint16_t len)
+{
+	if (out.write(static_cast<const uint8_t*>(buf), len) != len)
+	{
+		failed = true;
+	}
+	offset += len;
+}
+
+void BC7215ArchiveWriter::putU32(uint32_t value)
+{
+	uint8_t bytes[4] = { (uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24) };
+	put(bytes, 4);
+}
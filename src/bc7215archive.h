@@ -0,0 +1,47 @@
+#ifndef BC7215ARCHIVE_H
+#define BC7215ARCHIVE_H
+
+#include <Arduino.h>
+#include <bc7215.h>
+#include <bc7215_archive.h>
+
+// Streams captured frames into a BC7215 capture archive (format in bc7215_archive.h) on any
+// Print target, e.g. an SD card File. Record offsets are kept in a buffer given by the caller,
+// the index is written on end() if all of them fitted, otherwise readers rebuild it.
+class BC7215ArchiveWriter
+{
+public:
+    BC7215ArchiveWriter(Print& output, uint32_t* indexBuffer = NULL, uint32_t indexSize = 0);
+
+	// Write the file header, false if the output did not take it
+    bool                      begin();
+
+	// Append one frame, 'format' can be NULL. 'more' marks the next frame as the next segment
+	// of the same capture
+    bool                      add(uint8_t status, const bc7215DataVarPkt_t* data, const bc7215FormatPkt_t* format, uint32_t timestamp, bool more = false);
+    bool                      add(uint8_t status, const bc7215DataMaxPkt_t& data, const bc7215FormatPkt_t* format, uint32_t timestamp, bool more = false);
+
+	// Append a capture of 'count' segments as one group, e.g. BC7215AC sampleStatus/Data/Format
+    bool                      addGroup(uint8_t count, const uint8_t status[], const bc7215DataMaxPkt_t data[], const bc7215FormatPkt_t format[], uint32_t timestamp);
+
+	// Write the index (if kept) and the trailer, false if the output did not take them
+    bool                      end();
+
+	// Records written since begin()
+    uint32_t                  count();
+
+	// Bytes written since begin(), also the file offset of the next record
+    uint32_t                  size();
+
+private:
+    Print&              out;
+    uint32_t*           index;
+    uint32_t            indexSize;
+    uint32_t            records;
+    uint32_t            offset;
+    bool                failed;
+    void                put(const void* buf, uint16_t len);
+    void                putU32(uint32_t value);
+};
+
+#endif
@@ -0,0 +1,196 @@
+#include "bc7215diversity.h"
+
+#if (ENABLE_RECEIVING == 1) && (ENABLE_FORMAT == 1)
+
+BC7215Diversity::BC7215Diversity(BC7215* const receivers[], uint8_t count)
+{
+	if (count > BC7215_DIVERSITY_MAX_RX)
+	{
+		count = BC7215_DIVERSITY_MAX_RX;
+	}
+	for (uint8_t i = 0; i < count; i++)
+	{
+		rx[i] = receivers[i];
+	}
+	rxCount = count;
+	groupSize = 0;
+	mergedHead = 0;
+	mergedCount = 0;
+	lastCopies = 0;
+}
+
+void BC7215Diversity::startCapture()
+{
+	for (uint8_t i = 0; i < rxCount; i++)
+	{
+		rx[i]->setRx();
+	}
+	delay(50);
+	for (uint8_t i = 0; i < rxCount; i++)
+	{
+		rx[i]->setRxMode(1);
+		rx[i]->clrData();
+		rx[i]->clrFormat();
+	}
+	groupSize = 0;
+	mergedCount = 0;
+}
+
+void BC7215Diversity::stopCapture()
+{
+	for (uint8_t i = 0; i < rxCount; i++)
+	{
+		rx[i]->setTx();
+	}
+	delay(50);
+}
+
+bool BC7215Diversity::frameReady()
+{
+	poll();
+	if ((groupSize != 0) && (millis() - groupStartTime > BC7215_DIVERSITY_WINDOW))		// no more copies expected
+	{
+		closeGroup();
+	}
+	return mergedCount != 0;
+}
+
+uint8_t BC7215Diversity::getFrame(bc7215DataMaxPkt_t& data, bc7215FormatPkt_t& format)
+{
+	uint8_t status = 0xff;
+	if (mergedCount != 0)
+	{
+		status = merged[mergedHead].status;
+		memcpy(&data, &merged[mergedHead].data, BC7215::calSize(merged[mergedHead].data));
+		format = merged[mergedHead].format;
+		lastCopies = mergedCopies[mergedHead];
+		clrFrame();
+	}
+	return status;
+}
+
+void BC7215Diversity::clrFrame()
+{
+	if (mergedCount != 0)
+	{
+		mergedHead = (mergedHead + 1) % 2;
+		mergedCount--;
+	}
+}
+
+uint8_t BC7215Diversity::copies() { return lastCopies; }
+
+bool BC7215Diversity::isBusy()
+{
+	if (groupSize != 0)
+	{
+		return true;
+	}
+	for (uint8_t i = 0; i < rxCount; i++)
+	{
+		if (rx[i]->isBusy())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void BC7215Diversity::poll()
+{
+	for (uint8_t i = 0; i < rxCount; i++)
+	{
+		if (rx[i]->formatReady())
+		{
+			for (uint8_t j = 0; j < groupSize; j++)
+			{
+				if (groupRx[j] == i)		// a receiver reporting twice has moved on to the next frame
+				{
+					closeGroup();
+					break;
+				}
+			}
+			Copy& copy = group[groupSize];
+			rx[i]->getFormat(copy.format);
+			copy.status = rx[i]->getData(copy.data);
+			if ((groupSize != 0) && !sameFrame(copy))
+			{
+				closeGroup();
+				group[0] = copy;
+			}
+			if (groupSize == 0)
+			{
+				groupStartTime = millis();
+			}
+			groupRx[groupSize] = i;
+			groupSize++;
+		}
+		else if (rx[i]->dataReady())		// data packet without format packet, resend RX mode command
+		{
+			rx[i]->setRxMode(1);
+			rx[i]->clrData();
+			rx[i]->clrFormat();
+		}
+	}
+}
+
+bool BC7215Diversity::sameFrame(const Copy& copy)
+{
+	if (millis() - groupStartTime > BC7215_DIVERSITY_WINDOW)
+	{
+		return false;
+	}
+	if ((copy.status & 0x80) || (group[0].status & 0x80))		// a broken copy can not be compared by content
+	{
+		return true;
+	}
+	return (copy.data.bitLen == group[0].data.bitLen) && ((copy.status & 0x3f) == (group[0].status & 0x3f));
+}
+
+void BC7215Diversity::closeGroup()
+{
+	uint8_t tail;
+	if (groupSize == 0)
+	{
+		return;
+	}
+	if (mergedCount < 2)		// if the merged frames are not read in time, the new one is dropped
+	{
+		tail = (mergedHead + mergedCount) % 2;
+		merged[tail] = group[bestCopy()];
+		mergedCopies[tail] = groupSize;
+		mergedCount++;
+	}
+	groupSize = 0;
+}
+
+// A copy received without error is preferred, then the one most other copies agree with,
+// then the first one received
+uint8_t BC7215Diversity::bestCopy()
+{
+	uint8_t best = 0;
+	uint8_t bestScore = 0;
+	for (uint8_t i = 0; i < groupSize; i++)
+	{
+		uint8_t score = 0;
+		if (!(group[i].status & 0x80))
+		{
+			score = 0x80;
+			for (uint8_t j = 0; j < groupSize; j++)
+			{
+				if ((j != i) && !(group[j].status & 0x80) && BC7215::compareDpkt(group[i].status, group[i].data, group[j].data))
+				{
+					score++;
+				}
+			}
+		}
+		if ((i == 0) || (score > bestScore))
+		{
+			best = i;
+			bestScore = score;
+		}
+	}
+	return best;
+}
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef BC7215DIVERSITY_H
+#define BC7215DIVERSITY_H
+
+#include <Arduino.h>
+#include <bc7215.h>
+
+#if (ENABLE_RECEIVING == 1) && (ENABLE_FORMAT == 1)
+
+// Merges the frames heard by several BC7215 receivers into one stream. Copies of the same
+// frame are correlated by arrival time and content, and only the best copy is passed on.
+class BC7215Diversity
+{
+public:
+    BC7215Diversity(BC7215* const receivers[], uint8_t count);
+
+	// Put all receivers into RX mode, waiting for format & data packets
+    void                      startCapture();
+
+	// Put all receivers back into TX mode
+    void                      stopCapture();
+
+	// Poll the receivers, true if a merged frame is ready. Call it as often as signalCaptured()
+    bool                      frameReady();
+
+	// Get the best copy of the oldest merged frame, returns its status byte (0xff if none)
+    uint8_t                   getFrame(bc7215DataMaxPkt_t& data, bc7215FormatPkt_t& format);
+
+	// Drop the oldest merged frame without reading it
+    void                      clrFrame();
+
+	// How many receivers reported the frame last returned by getFrame()
+    uint8_t                   copies();
+
+	// Check if any receiver is still receiving, or copies of a frame are still being collected
+    bool                      isBusy();
+
+private:
+    struct Copy
+    {
+        uint8_t            status;
+        bc7215DataMaxPkt_t data;
+        bc7215FormatPkt_t  format;
+    };
+
+    BC7215*             rx[BC7215_DIVERSITY_MAX_RX];
+    uint8_t             rxCount;
+    Copy                group[BC7215_DIVERSITY_MAX_RX];     // copies of the frame being collected, in arrival order
+    uint8_t             groupRx[BC7215_DIVERSITY_MAX_RX];   // receiver of each copy
+    uint8_t             groupSize;
+    unsigned long       groupStartTime;
+    Copy                merged[2];                          // merged frames waiting to be read
+    uint8_t             mergedCopies[2];
+    uint8_t             mergedHead;
+    uint8_t             mergedCount;
+    uint8_t             lastCopies;
+    void                poll();
+    bool                sameFrame(const Copy& copy);
+    void                closeGroup();
+    uint8_t             bestCopy();
+};
+
+#endif
+#endif
@@ -0,0 +1,63 @@
+/*
+ * bc7215format.h
+ * BC7215 Library - Compile time format packets
+ *
+ * Builds a format packet from the timing of a known format and the documented carrier control of the
+ * signature byte (38kHz, 56kHz or none). The 32 timing bytes of a format packet are not documented and
+ * can only come from a captured signal (BC7215::getFormat()), e.g. the NEC format of the comm example.
+ * The bit order (LSB first for PWM, MSB first for PPM signals) is part of the timing, bitOrder() reads it.
+ *
+ *     constexpr bc7215FormatPkt_t NECFormat = { { { 0x34 } }, { 0x14, 0x5D, ... } };
+ *     constexpr bc7215FormatPkt_t NEC56K = BC7215Format::make(NECFormat, BC7215Format::CARRIER_56K);
+ *
+ * The packet is built by the compiler when the timing is constexpr.
+ *
+ * Author:
+ *   Bitcode
+ *
+ * Version:
+ *   V1.0 Oct 2026
+ *
+ * License:
+ *   MIT License
+ */
+
+#ifndef BC7215FORMAT_H
+#define BC7215FORMAT_H
+
+#include <bc7215_types.h>
+
+class BC7215Format
+{
+public:
+	enum Carrier {CARRIER_38K, CARRIER_56K, CARRIER_NONE};
+	enum BitOrder {LSB_FIRST, MSB_FIRST};
+
+	// Bit order of the signals sent with 'format', TP1:TP0 = 11 (PWM) is LSB first
+	static constexpr BitOrder bitOrder(const bc7215FormatPkt_t& format)
+	{
+		return ((format.signature.bits.sig & 0x30) == 0x30) ? LSB_FIRST : MSB_FIRST;
+	}
+
+	// Carrier of 'format', no carrier if NOCA is set whatever C56K is
+	static constexpr Carrier carrier(const bc7215FormatPkt_t& format)
+	{
+		return format.signature.bits.noCA ? CARRIER_NONE : (format.signature.bits.c56k ? CARRIER_56K : CARRIER_38K);
+	}
+
+	// Format packet with the timing (and bit order) of 'timing', sent on 'carrier'
+	static constexpr bc7215FormatPkt_t make(const bc7215FormatPkt_t& timing, Carrier carrier)
+	{
+		return bc7215FormatPkt_t { { { static_cast<uint8_t>(timing.signature.bits.sig), static_cast<uint8_t>(carrier == CARRIER_56K),
+								  static_cast<uint8_t>(carrier == CARRIER_NONE) } },
+				  { timing.format[0], timing.format[1], timing.format[2], timing.format[3], timing.format[4],
+					  timing.format[5], timing.format[6], timing.format[7], timing.format[8], timing.format[9],
+					  timing.format[10], timing.format[11], timing.format[12], timing.format[13], timing.format[14],
+					  timing.format[15], timing.format[16], timing.format[17], timing.format[18], timing.format[19],
+					  timing.format[20], timing.format[21], timing.format[22], timing.format[23], timing.format[24],
+					  timing.format[25], timing.format[26], timing.format[27], timing.format[28], timing.format[29],
+					  timing.format[30], timing.format[31] } };
+	}
+};
+
+#endif
@@ -0,0 +1,95 @@
+#include "bc7215power.h"
+
+BC7215Power::BC7215Power(BC7215& bc7215Chip, unsigned long idle)
+    : chip(bc7215Chip)
+{
+	idleTime = idle;
+	stateTime = millis();
+	state = AWAKE;
+	shutDownCount = 0;
+}
+
+void BC7215Power::poll()
+{
+	if (!chip.hasModPin())		// could not be woken up again, never shut down
+	{
+		return;
+	}
+	if (!chip.isTxMode() && (state != WAKE_RX))		// receiving, or woken up by someone else (e.g. BC7215AC::startCapture())
+	{
+		state = AWAKE;
+		stateTime = millis();
+		return;
+	}
+	switch (state)
+	{
+		case AWAKE:
+			if (chip.isBusy())
+			{
+				stateTime = millis();
+			}
+			else if (millis() - stateTime >= idleTime)
+			{
+				chip.setShutDown();
+				state = SHUTTING;
+				stateTime = millis();
+			}
+			break;
+		case SHUTTING:		// BC7215 confirms with 0x7a, assume it is down if it does not
+			if (!chip.isBusy() || (millis() - stateTime >= BC7215_WAKE_TIME))
+			{
+				state = ASLEEP;
+				shutDownCount++;
+			}
+			break;
+		case WAKE_RX:
+			if (millis() - stateTime >= BC7215_WAKE_TIME)
+			{
+				chip.setTx();
+				state = WAKE_TX;
+				stateTime = millis();
+			}
+			break;
+		case WAKE_TX:
+			if (millis() - stateTime >= BC7215_WAKE_TIME)
+			{
+				state = AWAKE;
+				stateTime = millis();
+			}
+			break;
+		default:
+			break;
+	}
+}
+
+void BC7215Power::wake()
+{
+	if ((state == SHUTTING) || (state == ASLEEP))
+	{
+		chip.setRx();		// MOD high wakes BC7215 up in receive mode
+		state = WAKE_RX;
+		stateTime = millis();
+	}
+}
+
+bool BC7215Power::ready()
+{
+	wake();
+	poll();
+	return state == AWAKE;
+}
+
+void BC7215Power::waitReady()
+{
+	while (!ready())
+	{
+		yield();
+	}
+	stateTime = millis();		// about to be used, restart the idle time
+}
+
+bool BC7215Power::isAsleep() { return (state == SHUTTING) || (state == ASLEEP); }
+
+bool BC7215Power::isWaking() { return (state == WAKE_RX) || (state == WAKE_TX); }
+
+uint16_t BC7215Power::shutDowns() { return shutDownCount; }
@@ -0,0 +1,48 @@
+#ifndef BC7215POWER_H
+#define BC7215POWER_H
+
+#include <Arduino.h>
+#include <bc7215.h>
+
+// Shuts BC7215 down after it has been idle in transmit mode for a while, and wakes it up again
+// when it is needed. Waking takes two MOD toggles with BC7215_WAKE_TIME to settle after each,
+// they run in the background while the next command is prepared (e.g. while the A/C library
+// encodes it), see BC7215AC::usePower(). Needs the MOD pin of BC7215 connected to a pin.
+class BC7215Power
+{
+public:
+    BC7215Power(BC7215& chip, unsigned long idleTime = BC7215_POWER_IDLE_TIME);
+
+	// Track activity and shut BC7215 down when idle, call it in loop()
+    void                      poll();
+
+	// Start waking BC7215 up if it is shut down, returns at once
+    void                      wake();
+
+	// Start waking BC7215 up if needed, true once it is awake in transmit mode
+    bool                      ready();
+
+	// Wake BC7215 up and wait until it is ready (BC7215_WAKE_TIME twice at most), then restart the idle
+	// time since a command is about to be sent
+    void                      waitReady();
+
+	// Check if BC7215 is shut down (or being shut down)
+    bool                      isAsleep();
+
+	// Check if BC7215 is waking up, poll() moves it on
+    bool                      isWaking();
+
+	// Number of times BC7215 has been shut down
+    uint16_t                  shutDowns();
+
+private:
+	enum State {AWAKE, SHUTTING, ASLEEP, WAKE_RX, WAKE_TX};
+
+    BC7215&             chip;
+    unsigned long       idleTime;
+    unsigned long       stateTime;        // last activity when AWAKE, start of the current step otherwise
+    uint8_t             state;
+    uint16_t            shutDownCount;
+};
+
+#endif